@@ -0,0 +1,44 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Rte.h"
+#include "cabinButton.h"
+
+/* Modes set by the gestures, published every run */
+static ECU_STATE u8 cabinLampForced = 0;
+static ECU_STATE u8 doorTriggerEnabled = 1;
+
+void CabinButton_MainFunction (void)
+{
+  u8 switchNum;
+  u8 gesture;
+  
+  /* Every gesture made since the last run, oldest first */
+  while (Switch_GetGesture(&switchNum, &gesture) == ERR_STAT_OK)
+  {
+    if (switchNum != SWITCH_CABIN)
+    {
+      continue;
+    }
+    switch (gesture)
+    {
+      case SWITCH_GESTURE_LONG:
+        cabinLampForced = 1;
+      break;
+      
+      case SWITCH_GESTURE_DOUBLE:
+        doorTriggerEnabled = !doorTriggerEnabled;
+      break;
+      
+      default:
+        cabinLampForced = 0;
+        doorTriggerEnabled = 1;
+      break;
+    }
+  }
+  
+  Rte_IWrite_CabinButton_CabinLampForced(cabinLampForced);
+  Rte_IWrite_CabinButton_DoorTriggerEnabled(doorTriggerEnabled);
+}
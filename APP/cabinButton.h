@@ -0,0 +1,13 @@
+/* 
+  Description: This function shall turn the gestures of the cabin button into
+  the CabinLampForced and DoorTriggerEnabled ports, run through
+  Rte_Run_CabinButton: a long press forces the lamp on, a double press
+  turns the door trigger off or on again, a short press goes back to
+  automatic (lamp not forced, door trigger on)
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void CabinButton_MainFunction (void);
@@ -0,0 +1,20 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "Lamp.h"
+#include "Lamp_config.h"
+#include "Rte.h"
+#include "doorDimmer.h"
+#include "dimmerLamp.h"
+
+void DimmerLamp_MainFunction (void)
+{
+  if (Rte_IRead_DimmerLamp_LampRequest() == LAMP_ON)
+  {
+    Lamp_SwitchOn(Lamp_DIMMER);
+  }
+  else
+  {
+    Lamp_SwitchOff(Lamp_DIMMER);
+  }
+}
@@ -0,0 +1,10 @@
+/* 
+  Description: This function shall drive the dimmer lamp to the state
+  requested on the LampRequest port, run through Rte_Run_DimmerLamp
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void DimmerLamp_MainFunction (void);
@@ -7,39 +7,119 @@
 #include "SWITCH_config.h"
 #include "Lamp.h"
 #include "Lamp_config.h"
+#include "LampChain.h"
+#include "can.h"
+#include "Door.h"
+#include "Door_config.h"
+
+#include "Det.h"
+#include "Det_config.h"
+#include "Perf.h"
+#include "TimerWheel.h"
+#include "udma.h"
+#include "gpt.h"
+#include "nvic.h"
+#include "Trace.h"
+#include "Capture.h"
+#include "Capture_config.h"
+#include "Telemetry.h"
+#include "Diag.h"
+#include "EventLog.h"
+#include "Rte.h"
 
 #include "leftDoor.h"
 #include "rightDoor.h"
+#include "dimmerLamp.h"
+#include "doorDimmer.h"
+#include "cabinButton.h"
+#include "usageReport.h"
 
-void main ()
+void DoorDimmer_Init (void)
 {
-  u8 rightDoor, leftDoor;
-  
+#if (DET_DEV_ERROR_DETECT == 1)
+  Det_Init();
+#endif
   SYSCTL_setSystemClock(SYSCTL_MAIN_OSCILLATOR_CLOCK);
   
-  Switch_Init(SWITCH_LEFTDOOR);
-  Switch_Init(SWITCH_RIGHTDOOR);
+  Rte_Init();
+  Perf_Init();
+  TimerWheel_Init();
+  Telemetry_Init();
+  Diag_Init();
+  /* Needs the timer wheel, logs the cause of this reset */
+  EventLog_Init();
+  
+  Door_Init(DOOR_LEFT);
+  Door_Init(DOOR_RIGHT);
+  /* Gesture recognition, needs the timer wheel */
+  Switch_Init(SWITCH_CABIN);
+  /* After the doors, the traced switch pins must be configured */
+  Trace_Init();
+#if (CAPTURE_MODE == 1)
+  /* Switch characterisation, samples the switch pins in the background */
+  UDMA_Init();
+  Capture_Init();
+  Capture_Start();
+#endif
   
   Lamp_init(Lamp_DIMMER);
+}
+
+void DoorDimmer_MainFunction (void)
+{
+  u8 rightDoor, leftDoor, lamp;
   
-  while (1)
+  leftDoor = Rte_IRead_DoorDimmer_LeftDoorStatus();
+  rightDoor = Rte_IRead_DoorDimmer_RightDoorStatus();
+  
+  if (Rte_IRead_DoorDimmer_CabinLampForced())
   {
-      LeftDoor_ReadStatus(&leftDoor);
-      RightDoor_ReadStatus(&rightDoor);
-      
-      if (leftDoor == DOOR_CLOSED && rightDoor == DOOR_CLOSED)
-      {
-        Lamp_SwitchOff(Lamp_DIMMER);
-          //GPIO_PinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, 0x00);
-      }
-      else
-      {
-        Lamp_SwitchOn(Lamp_DIMMER);
-          //GPIO_PinWrite(GPIO_PORTF_BASE, GPIO_PIN_2, 0xff);
-      }
+    lamp = LAMP_ON;
   }
+  else if (!Rte_IRead_DoorDimmer_DoorTriggerEnabled() ||
+           (leftDoor == DOOR_CLOSED && rightDoor == DOOR_CLOSED))
+  {
+    lamp = LAMP_OFF;
+  }
+  else
+  {
+    lamp = LAMP_ON;
+  }
+  Rte_IWrite_DoorDimmer_LampRequest(lamp);
+}
+
+void DoorDimmer_Schedule (void)
+{
+  Perf_LoopMark();
+  Trace_Sample();
+  /* Senders before receivers, a door change reaches the lamp in the same iteration */
+  Rte_Run_LeftDoor();
+  Rte_Run_RightDoor();
+  Rte_Run_CabinButton();
+  Rte_Run_DoorDimmer();
+  Rte_Run_DimmerLamp();
+  Rte_Run_UsageReport();
+  /* All lamp changes of this iteration leave in one frame */
+  LampChain_MainFunction();
+  Telemetry_MainFunction();
+#if (CAPTURE_MODE == 1)
+  Capture_MainFunction();
+#endif
+  /* Lowest priority work last, bounded per iteration */
+  Diag_MainFunction();
+  /* At most one EEPROM write started, never waited for */
+  EventLog_MainFunction();
+}
+
+/* The host simulators (HOST/) have their own main and drive the schedule */
+#ifndef HOST_BUILD
+void main ()
+{
+  DoorDimmer_Init();
   
-  
-  
-  
+  while (1)
+  {
+      DoorDimmer_Schedule();
+  }
 }
+#endif
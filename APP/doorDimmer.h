@@ -0,0 +1,37 @@
+
+#define LAMP_OFF 0
+#define LAMP_ON  1
+
+
+/* 
+  Description: This function shall initiate the door switches and the dimmer lamp
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void DoorDimmer_Init (void);
+
+/* 
+  Description: This function shall request the dimmer lamp from both door
+  ports, the lamp is on while any door is opened; the cabin button can force
+  it on or turn the door trigger off; run through Rte_Run_DoorDimmer
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void DoorDimmer_MainFunction (void);
+
+/* 
+  Description: This function shall run one main loop iteration: every main
+  function once, in priority order
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void DoorDimmer_Schedule (void);
@@ -3,13 +3,18 @@
 #include "gpio.h"
 #include "SWITCH.h"
 #include "SWITCH_config.h"
+#include "can.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "Rte.h"
 #include "leftDoor.h"
 
-extern errStat LeftDoor_ReadStatus (u8* leftDoorStatus)
+void LeftDoor_MainFunction (void)
 {
-  errStat status = ERR_STAT_OK;
+  u8 leftDoorStatus;
   
-  status = Switch_GetSwitchState (SWITCH_LEFTDOOR,leftDoorStatus);
+  /* A lost remote door still fills in its timeout state */
+  Door_GetStatus (DOOR_LEFT,&leftDoorStatus);
   
-  return status;
+  Rte_IWrite_LeftDoor_LeftDoorStatus(leftDoorStatus);
 }
\ No newline at end of file
@@ -1,6 +1,14 @@
-
 #define DOOR_OPENED 0
 #define DOOR_CLOSED 1
 
 
-extern errStat LeftDoor_ReadStatus (u8* leftDoorStatus);
\ No newline at end of file
+/* 
+  Description: This function shall read the left door once and publish its
+  state on the LeftDoorStatus port, run through Rte_Run_LeftDoor
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void LeftDoor_MainFunction (void);
\ No newline at end of file
@@ -3,13 +3,18 @@
 #include "gpio.h"
 #include "SWITCH.h"
 #include "SWITCH_config.h"
+#include "can.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "Rte.h"
 #include "rightDoor.h"
 
-extern errStat RightDoor_ReadStatus (u8* rightDoorStatus)
+void RightDoor_MainFunction (void)
 {
-  errStat status = ERR_STAT_OK;
+  u8 rightDoorStatus;
   
-  status = Switch_GetSwitchState (SWITCH_RIGHTDOOR,rightDoorStatus);
+  /* A lost remote door still fills in its timeout state */
+  Door_GetStatus (DOOR_RIGHT,&rightDoorStatus);
   
-  return status;
+  Rte_IWrite_RightDoor_RightDoorStatus(rightDoorStatus);
 }
\ No newline at end of file
@@ -1,6 +1,14 @@
-
 #define DOOR_OPENED 0
 #define DOOR_CLOSED 1
 
 
-extern errStat RightDoor_ReadStatus (u8* rightDoorStatus);
\ No newline at end of file
+/* 
+  Description: This function shall read the right door once and publish its
+  state on the RightDoorStatus port, run through Rte_Run_RightDoor
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void RightDoor_MainFunction (void);
\ No newline at end of file
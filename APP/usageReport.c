@@ -0,0 +1,41 @@
+#include "STD_TYPES.h"
+#include "Lamp.h"
+#include "Lamp_config.h"
+#include "Door_config.h"
+#include "Telemetry.h"
+#include "EventLog.h"
+#include "Rte.h"
+#include "leftDoor.h"
+#include "doorDimmer.h"
+#include "usageReport.h"
+
+/* Last reported states, used to report changes only */
+static ECU_STATE u8 lastLeftDoor = DOOR_CLOSED;
+static ECU_STATE u8 lastRightDoor = DOOR_CLOSED;
+static ECU_STATE u8 lastLamp = LAMP_OFF;
+
+void UsageReport_MainFunction (void)
+{
+  u8 leftDoor = Rte_IRead_UsageReport_LeftDoorStatus();
+  u8 rightDoor = Rte_IRead_UsageReport_RightDoorStatus();
+  u8 lamp = Rte_IRead_UsageReport_LampRequest();
+  
+  if (leftDoor != lastLeftDoor)
+  {
+    Telemetry_ReportDoorEdge(DOOR_LEFT, leftDoor);
+    EventLog_ReportDoorEdge(DOOR_LEFT, (leftDoor == DOOR_OPENED));
+    lastLeftDoor = leftDoor;
+  }
+  if (rightDoor != lastRightDoor)
+  {
+    Telemetry_ReportDoorEdge(DOOR_RIGHT, rightDoor);
+    EventLog_ReportDoorEdge(DOOR_RIGHT, (rightDoor == DOOR_OPENED));
+    lastRightDoor = rightDoor;
+  }
+  if (lamp != lastLamp)
+  {
+    Telemetry_ReportLampState(Lamp_DIMMER, lamp);
+    EventLog_ReportLampState(Lamp_DIMMER, (lamp == LAMP_ON));
+    lastLamp = lamp;
+  }
+}
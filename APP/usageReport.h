@@ -0,0 +1,11 @@
+/* 
+  Description: This function shall report door edges and lamp changes to the
+  telemetry stream and the event log, from the LeftDoorStatus,
+  RightDoorStatus and LampRequest ports; run through Rte_Run_UsageReport
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void UsageReport_MainFunction (void);
@@ -0,0 +1,255 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "can.h"
+#include "dwt.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Door.h"
+#include "Door_config.h"
+
+
+/* Core clock cycles per millisecond, the unit of the remote timeouts */
+#define DOOR_CYCLES_PER_MS   (SYSCTL_MAIN_OSCILLATOR_HZ / 1000)
+
+/* Last frame of every remote door, written by the CAN receive interrupt */
+static ECU_STATE volatile u8 doorRemoteState[DOOR_NUM];
+static ECU_STATE volatile u32 doorRemoteStamp[DOOR_NUM];
+static ECU_STATE volatile u8 doorRemoteValid[DOOR_NUM];
+
+static ECU_STATE u8 doorCanReady;
+
+
+/* 
+  Description: This function shall be called from the CAN interrupt for every
+  message object that received a frame and stores the state of its door
+  
+  Input: objNum the message object holding the frame
+  
+  Output: void
+
+ */
+static void Door_RxNotification(u8 objNum)
+{
+  canMessage_t msg;
+  const doormap_t * doorMapElement;
+  u8 doorNum;
+  
+  /* Reading the object also releases it for the next frame */
+  if (CAN_MessageGet(DOOR_CAN_BASE, objNum, &msg) != ERR_STAT_OK)
+  {
+    return;
+  }
+  
+  for (doorNum = 0; doorNum < DOOR_NUM; doorNum++)
+  {
+    doorMapElement = getDoorMap(doorNum);
+    if ((doorMapElement->source == DOOR_SOURCE_REMOTE) && (doorMapElement->canObj == objNum))
+    {
+      if ((msg.len >= 1) && ((msg.data[0] == DOOR_OPENED) || (msg.data[0] == DOOR_CLOSED)))
+      {
+        doorRemoteState[doorNum] = msg.data[0];
+        doorRemoteStamp[doorNum] = DWT_CycleCountGet();
+        doorRemoteValid[doorNum] = 1;
+      }
+      else
+      {
+        ErrCnt_Report(MODULE_ID_DOOR);
+      }
+      return;
+    }
+  }
+}
+
+/* 
+  Description: This function shall bring up the CAN controller once, for the
+  first remote door or the first published door
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+static errStat Door_CanInit(void)
+{
+  errStat status = ERR_STAT_OK;
+  
+  if (doorCanReady)
+  {
+    return status;
+  }
+  
+  /* Enabling peripheral clocks of the controller and its port */
+  status |= SYSCTL_controlGPIO(DOOR_CAN_GPIO_SYSCTL,SYSCTL_GPIO_ENABLE);
+  status |= SYSCTL_controlCAN(DOOR_CAN_SYSCTL,SYSCTL_CAN_ENABLE);
+  
+  /* Handing the pins over to the controller */
+  status |= GPIO_AltFunctionSet(DOOR_CAN_GPIO_PORT,DOOR_CAN_GPIO_PINS,DOOR_CAN_GPIO_FUNC);
+  
+  status |= CAN_Init(DOOR_CAN_BASE,SYSCTL_MAIN_OSCILLATOR_HZ,DOOR_CAN_BITRATE);
+  status |= CAN_IntRegister(DOOR_CAN_BASE,Door_RxNotification);
+  status |= NVIC_IntPrioritySet(DOOR_CAN_INT,DOOR_CAN_PRIORITY);
+  status |= NVIC_IntEnable(DOOR_CAN_INT);
+  
+  doorCanReady = (status == ERR_STAT_OK);
+  
+  return status;
+}
+
+/* 
+  Description: This function shall initiate the specified door, a local door
+  initiates its switch, a remote door sets up the CAN acceptance filter of its
+  message object
+  
+  Input: doorNum which holds the index of the door in the door array 
+  
+  Output: errStat
+
+ */
+extern errStat Door_Init(u8 doorNum)
+{
+  errStat status = ERR_STAT_OK;
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (doorNum >= DOOR_NUM)
+  {
+    Det_ReportError(MODULE_ID_DOOR, DOOR_API_INIT, DOOR_E_PARAM_DOOR);
+    return ERR_STAT_NOK;
+  }
+#endif
+  /* Getting required door configurations */
+  const doormap_t * doorMapElement = getDoorMap(doorNum);
+  
+  if (doorMapElement->source == DOOR_SOURCE_LOCAL)
+  {
+    status = Switch_Init(doorMapElement->switchNum);
+  }
+  else
+  {
+    /* A remote door is lost until its first frame arrives */
+    doorRemoteValid[doorNum] = 0;
+    status = Door_CanInit();
+    status |= CAN_RxObjectSet(DOOR_CAN_BASE,doorMapElement->canObj,doorMapElement->canId,CAN_STD_ID_MAX);
+  }
+  
+  return status;
+}
+
+/* 
+  Description: This function shall return the state of the specified door which can
+  be DOOR_OPENED or DOOR_CLOSED. A remote door whose last frame is older than
+  its timeout reports its timeout state and ERR_STAT_NOK.
+  
+  Input: 
+        1- doorNum which holds the index of the door in the door array 
+        2- doorStatus a pointer that receives the door state
+        
+  Output: errStat
+
+ */
+extern errStat Door_GetStatus(u8 doorNum, u8* doorStatus)
+{
+  u32 priMask;
+  u32 stamp;
+  u8 state;
+  u8 valid;
+  u8 lost;
+  
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (doorNum >= DOOR_NUM)
+  {
+    Det_ReportError(MODULE_ID_DOOR, DOOR_API_GET_STATUS, DOOR_E_PARAM_DOOR);
+    return ERR_STAT_NOK;
+  }
+  if (doorStatus == 0)
+  {
+    Det_ReportError(MODULE_ID_DOOR, DOOR_API_GET_STATUS, DOOR_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+  /* Getting required door configurations */
+  const doormap_t * doorMapElement = getDoorMap(doorNum);
+  
+  if (doorMapElement->source == DOOR_SOURCE_LOCAL)
+  {
+    return Switch_GetSwitchState(doorMapElement->switchNum, doorStatus);
+  }
+  
+  /* State and stamp are written together by the receive interrupt, the loss
+     is decided and cleared under the same mask so a frame stored meanwhile
+     is never thrown away */
+  lost = 0;
+  priMask = NVIC_IntMasterDisable();
+  valid = doorRemoteValid[doorNum];
+  stamp = doorRemoteStamp[doorNum];
+  state = doorRemoteState[doorNum];
+  if (valid && ((u32)(DWT_CycleCountGet() - stamp) > ((u32)doorMapElement->timeoutMs * DOOR_CYCLES_PER_MS)) &&
+      (doorRemoteStamp[doorNum] == stamp))
+  {
+    /* Counted once per loss, the door stays lost until a new frame arrives */
+    doorRemoteValid[doorNum] = 0;
+    valid = 0;
+    lost = 1;
+  }
+  NVIC_IntMasterRestore(priMask);
+  
+  if (lost)
+  {
+    ErrCnt_Report(MODULE_ID_DOOR);
+  }
+  
+  if (!valid)
+  {
+    *doorStatus = doorMapElement->timeoutState;
+    return ERR_STAT_NOK;
+  }
+  *doorStatus = state;
+  
+  return ERR_STAT_OK;
+}
+
+/* 
+  Description: This function shall send the state of a local door on CAN with the
+  identifier of the door, it is used by door modules publishing their switch
+  
+  Input: doorNum which holds the index of the door in the door array 
+  
+  Output: errStat, ERR_STAT_NOK if the previous frame is still pending
+
+ */
+extern errStat Door_SendStatus(u8 doorNum)
+{
+  errStat status = ERR_STAT_OK;
+  canMessage_t msg = {0};
+  
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (doorNum >= DOOR_NUM)
+  {
+    Det_ReportError(MODULE_ID_DOOR, DOOR_API_SEND_STATUS, DOOR_E_PARAM_DOOR);
+    return ERR_STAT_NOK;
+  }
+  if (getDoorMap(doorNum)->source != DOOR_SOURCE_LOCAL)
+  {
+    Det_ReportError(MODULE_ID_DOOR, DOOR_API_SEND_STATUS, DOOR_E_NOT_LOCAL);
+    return ERR_STAT_NOK;
+  }
+#endif
+  /* Getting required door configurations */
+  const doormap_t * doorMapElement = getDoorMap(doorNum);
+  
+  status |= Door_CanInit();
+  status |= Switch_GetSwitchState(doorMapElement->switchNum, &msg.data[0]);
+  msg.id = doorMapElement->canId;
+  msg.len = 1;
+  
+  if (status == ERR_STAT_OK)
+  {
+    status = CAN_MessageSend(DOOR_CAN_BASE,DOOR_CAN_TX_OBJ,&msg);
+  }
+  
+  return status;
+}
@@ -0,0 +1,73 @@
+#define DOOR_OPENED 0
+#define DOOR_CLOSED 1
+
+/* Values of the source field */
+#define DOOR_SOURCE_LOCAL   0
+#define DOOR_SOURCE_REMOTE  1
+
+/* API and error ids reported to the Development Error Tracer */
+#define DOOR_API_INIT        0x00
+#define DOOR_API_GET_STATUS  0x01
+#define DOOR_API_SEND_STATUS 0x02
+
+#define DOOR_E_PARAM_DOOR    0x0A
+#define DOOR_E_PARAM_POINTER 0x0B
+#define DOOR_E_NOT_LOCAL     0x0C
+
+typedef struct 
+{
+  u8 source;          /* DOOR_SOURCE_LOCAL or DOOR_SOURCE_REMOTE */
+  u8 switchNum;       /* local: index of the switch in the switch array */
+  u16 canId;          /* remote: identifier of the door status frame */
+  u8 canObj;          /* remote: message object receiving the frame */
+  u16 timeoutMs;      /* remote: frame age after which the door is lost */
+  u8 timeoutState;    /* remote: state reported while the door is lost */
+} doormap_t;
+
+
+/* 
+  Description: This function shall initiate the specified door, a local door
+  initiates its switch, a remote door sets up the CAN acceptance filter of its
+  message object
+  
+  Input: doorNum which holds the index of the door in the door array 
+  
+  Output: errStat
+
+ */
+extern errStat Door_Init(u8 doorNum);
+
+/* 
+  Description: This function shall return the state of the specified door which can
+  be DOOR_OPENED or DOOR_CLOSED. A remote door whose last frame is older than
+  its timeout reports its timeout state and ERR_STAT_NOK.
+  
+  Input: 
+        1- doorNum which holds the index of the door in the door array 
+        2- doorStatus a pointer that receives the door state
+        
+  Output: errStat
+
+ */
+extern errStat Door_GetStatus(u8 doorNum, u8* doorStatus);
+
+/* 
+  Description: This function shall send the state of a local door on CAN with the
+  identifier of the door, it is used by door modules publishing their switch
+  
+  Input: doorNum which holds the index of the door in the door array 
+  
+  Output: errStat, ERR_STAT_NOK if the previous frame is still pending
+
+ */
+extern errStat Door_SendStatus(u8 doorNum);
+
+/* 
+  Description: This function shall return an element of door from doorMap array
+  
+  Input: doorNum which holds the index of the door in the door array 
+  
+  Output: Address of door struct that maps the doorNum 
+
+ */
+extern const doormap_t * getDoorMap (u8 doorNum);
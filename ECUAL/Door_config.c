@@ -0,0 +1,32 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "can.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Door.h"
+#include "Door_config.h"
+
+
+
+/*
+  Creating an array of door struct that holds doors in the system
+*/
+const doormap_t doorMap [DOOR_NUM] = {
+  {DOOR_LEFT_SOURCE,DOOR_LEFT_SWITCH,DOOR_LEFT_CAN_ID,DOOR_LEFT_CAN_OBJ,DOOR_LEFT_TIMEOUT_MS,DOOR_LEFT_TIMEOUT_STATE},
+  {DOOR_RIGHT_SOURCE,DOOR_RIGHT_SWITCH,DOOR_RIGHT_CAN_ID,DOOR_RIGHT_CAN_OBJ,DOOR_RIGHT_TIMEOUT_MS,DOOR_RIGHT_TIMEOUT_STATE}
+};
+
+
+/* 
+  Description: This function shall return an element of door from doorMap array
+  
+  Input: doorNum which holds the index of the door in the door array 
+  
+  Output: Address of door struct that maps the doorNum 
+
+ */
+extern const doormap_t * getDoorMap (u8 doorNum)
+{
+  return &doorMap[doorNum];
+}
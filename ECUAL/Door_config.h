@@ -0,0 +1,40 @@
+#define DOOR_NUM                    2
+
+/*
+  Every door is either a local switch of this ECU or a remote door module
+  that sends its state on CAN. The sources can be overridden from the build,
+  e.g. -DDOOR_LEFT_SOURCE=DOOR_SOURCE_REMOTE.
+*/
+#define DOOR_LEFT                   0
+#ifndef DOOR_LEFT_SOURCE
+#define DOOR_LEFT_SOURCE            DOOR_SOURCE_LOCAL
+#endif
+#define DOOR_LEFT_SWITCH            SWITCH_LEFTDOOR
+#define DOOR_LEFT_CAN_ID            0x310
+#define DOOR_LEFT_CAN_OBJ           1
+#define DOOR_LEFT_TIMEOUT_MS        100
+#define DOOR_LEFT_TIMEOUT_STATE     DOOR_CLOSED
+
+#define DOOR_RIGHT                  1
+#ifndef DOOR_RIGHT_SOURCE
+#define DOOR_RIGHT_SOURCE           DOOR_SOURCE_LOCAL
+#endif
+#define DOOR_RIGHT_SWITCH           SWITCH_RIGHTDOOR
+#define DOOR_RIGHT_CAN_ID           0x311
+#define DOOR_RIGHT_CAN_OBJ          2
+#define DOOR_RIGHT_TIMEOUT_MS       100
+#define DOOR_RIGHT_TIMEOUT_STATE    DOOR_CLOSED
+
+/* CAN0 on PE4 (Rx) / PE5 (Tx) */
+#define DOOR_CAN_BASE               CAN0_BASE
+#define DOOR_CAN_SYSCTL             SYSCTL_CAN_0
+#define DOOR_CAN_INT                NVIC_INT_CAN0
+#define DOOR_CAN_PRIORITY           2
+#define DOOR_CAN_BITRATE            500000
+#define DOOR_CAN_GPIO_SYSCTL        SYSCTL_GPIO_E
+#define DOOR_CAN_GPIO_PORT          GPIO_PORTE_BASE
+#define DOOR_CAN_GPIO_PINS          (GPIO_PIN_4 | GPIO_PIN_5)
+#define DOOR_CAN_GPIO_FUNC          8
+
+/* Message object used by Door_SendStatus */
+#define DOOR_CAN_TX_OBJ             32
@@ -1,14 +1,47 @@
 #include "STD_TYPES.h"
 #include "sysctl.h"
 #include "gpio.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+#include "LampChain.h"
 
 #include "Lamp.h"
 #include "Lamp_config.h"
 
 
+/* Last state commanded to every lamp */
+static ECU_STATE u8 lampState[Lamps_NUM];
+
+/* Set once the shift register chain is up, it is shared by all chain lamps */
+static ECU_STATE u8 lampChainReady;
+
+/* 
+  Description: This function shall drive a lamp to the given level on its backend,
+  a chain lamp only changes the frame buffer sent by LampChain_MainFunction
+  
+  Input: 
+        1- lampMapElement the lamp configuration
+        2- level ON or OFF of the lamp configuration
+  
+  Output: errStat
+
+ */
+static errStat Lamp_Write(lampmap_t * lampMapElement, u32 level)
+{
+  if (lampMapElement->backend == LAMP_BACKEND_CHAIN)
+  {
+    return LampChain_SetOutput(lampMapElement->chainOutput,(level != 0) ? 1 : 0);
+  }
+  return GPIO_PinWrite(lampMapElement->port,lampMapElement->pin,level);
+}
+
+
 /* 
   Description: This function shall initiate the specified lamp num by setting its
-  pin, port, mode and configuration in a GPIO object and passing it to GPIO module
+  pin, port, mode and configuration in a GPIO object and passing it to GPIO module,
+  a chain lamp brings up the shift register chain
   
   Input: lampNum which holds the index of the lamp in the lamp array 
   
@@ -18,21 +51,34 @@
 extern errStat Lamp_init(u8 lampNum)
 {
   errStat status = ERR_STAT_OK;
+#if (DET_DEV_ERROR_DETECT == 1)
   if (lampNum >= Lamps_NUM)
   {
-    status = ERR_STAT_NOK;
+    Det_ReportError(MODULE_ID_LAMP, LAMP_API_INIT, LAMP_E_PARAM_LAMP);
+    return ERR_STAT_NOK;
   }
+#endif
   /* Creating Lamp element */
   lampmap_t * lampMapElement; 
   
-  /* Enabling peripheral clock on PORTF */
-  SYSCTL_controlGPIO(SYSCTL_GPIO_F,SYSCTL_GPIO_ENABLE);
-  
   /* Getting required lamp configurations */
   lampMapElement = getLampMap(lampNum);
+  
+  if (lampMapElement->backend == LAMP_BACKEND_CHAIN)
+  {
+    if (!lampChainReady)
+    {
+      status = LampChain_Init();
+      lampChainReady = (status == ERR_STAT_OK);
+    }
+    return status;
+  }
+  
+  /* Enabling peripheral clock on PORTF */
+  SYSCTL_controlGPIO(SYSCTL_GPIO_F,SYSCTL_GPIO_ENABLE);
 
   /* Initiating GPIO element */
-  GPIO_DirModeSet(lampMapElement->port,lampMapElement->pin,GPIO_DIR_MODE_OUT);
+  status = GPIO_DirModeSet(lampMapElement->port,lampMapElement->pin,GPIO_DIR_MODE_OUT);
   
   return status;
 }
@@ -48,10 +94,13 @@ extern errStat Lamp_init(u8 lampNum)
 extern errStat Lamp_SwitchOn(u8 lampNum)
 {
   errStat status = ERR_STAT_OK;
+#if (DET_DEV_ERROR_DETECT == 1)
   if (lampNum >= Lamps_NUM)
   {
-    status = ERR_STAT_NOK;
+    Det_ReportError(MODULE_ID_LAMP, LAMP_API_SWITCH_ON, LAMP_E_PARAM_LAMP);
+    return ERR_STAT_NOK;
   }
+#endif
   
   /* Creating lamp element */
   lampmap_t * lampMapElement; 
@@ -59,7 +108,11 @@ extern errStat Lamp_SwitchOn(u8 lampNum)
   lampMapElement = getLampMap(lampNum);
 
   /* Setting the lamp on */
-  GPIO_PinWrite(lampMapElement->port,lampMapElement->pin,lampMapElement->ON);
+  status = Lamp_Write(lampMapElement,lampMapElement->ON);
+  if (status == ERR_STAT_OK)
+  {
+    lampState[lampNum] = LAMP_STATE_ON;
+  }
   
   return status;
 }
@@ -76,10 +129,13 @@ extern errStat Lamp_SwitchOff(u8 lampNum)
 {
   
   errStat status = ERR_STAT_OK;
+#if (DET_DEV_ERROR_DETECT == 1)
   if (lampNum >= Lamps_NUM)
   {
-    status = ERR_STAT_NOK;
+    Det_ReportError(MODULE_ID_LAMP, LAMP_API_SWITCH_OFF, LAMP_E_PARAM_LAMP);
+    return ERR_STAT_NOK;
   }
+#endif
   
   /* Creating lamp element */
   lampmap_t * lampMapElement; 
@@ -88,7 +144,43 @@ extern errStat Lamp_SwitchOff(u8 lampNum)
  
   
   /* Setting the lamp off */
-  GPIO_PinWrite(lampMapElement->port,lampMapElement->pin,lampMapElement->OFF);
+  status = Lamp_Write(lampMapElement,lampMapElement->OFF);
+  if (status == ERR_STAT_OK)
+  {
+    lampState[lampNum] = LAMP_STATE_OFF;
+  }
+  
+  return status;
+}
+
+/* 
+  Description: This function shall return the last state commanded to the specified
+  lamp, without accessing the hardware
+  
+  Input: 
+        1- lampNum which holds the index of the lamp in the lamp array 
+        2- lampValue a pointer that receives LAMP_STATE_ON or LAMP_STATE_OFF
+  
+  Output: errStat
+
+ */
+extern errStat Lamp_GetState(u8 lampNum, u8* lampValue)
+{
+  errStat status = ERR_STAT_OK;
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (lampNum >= Lamps_NUM)
+  {
+    Det_ReportError(MODULE_ID_LAMP, LAMP_API_GET_STATE, LAMP_E_PARAM_LAMP);
+    return ERR_STAT_NOK;
+  }
+  if (lampValue == 0)
+  {
+    Det_ReportError(MODULE_ID_LAMP, LAMP_API_GET_STATE, LAMP_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  *lampValue = lampState[lampNum];
   
   return status;
 }
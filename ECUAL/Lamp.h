@@ -1,18 +1,37 @@
 #define pinSet 0xff
 #define pinReset 0x00
 
+#define LAMP_STATE_OFF 0
+#define LAMP_STATE_ON  1
+
+/* Values of the backend field */
+#define LAMP_BACKEND_GPIO    0
+#define LAMP_BACKEND_CHAIN   1
+
+/* API and error ids reported to the Development Error Tracer */
+#define LAMP_API_INIT        0x00
+#define LAMP_API_SWITCH_ON   0x01
+#define LAMP_API_SWITCH_OFF  0x02
+#define LAMP_API_GET_STATE   0x03
+
+#define LAMP_E_PARAM_LAMP    0x0A
+#define LAMP_E_PARAM_POINTER 0x0B
+
 typedef struct 
 {
-  u8 pin;
-  u32 port;
-  u32 ON;
-  u32 OFF;
+  u8 pin;             /* GPIO: pin of the lamp */
+  u32 port;           /* GPIO: port of the lamp */
+  u32 ON;             /* level that lights the lamp, chain: nonzero is high */
+  u32 OFF;            /* level that turns the lamp off */
+  u8 backend;         /* LAMP_BACKEND_GPIO or LAMP_BACKEND_CHAIN */
+  u16 chainOutput;    /* chain: output of the lamp in the shift register chain */
 } lampmap_t;
 
 
 /* 
   Description: This function shall initiate the specified lamp num by setting its
-  pin, port, mode and configuration in a GPIO object and passing it to GPIO module
+  pin, port, mode and configuration in a GPIO object and passing it to GPIO module,
+  a chain lamp brings up the shift register chain
   
   Input: lampNum which holds the index of the lamp in the lamp array 
   
@@ -41,6 +60,19 @@ extern errStat Lamp_SwitchOn(u8 lampNum);
  */
 extern errStat Lamp_SwitchOff(u8 lampNum);
 
+/* 
+  Description: This function shall return the last state commanded to the specified
+  lamp, without accessing the hardware
+  
+  Input: 
+        1- lampNum which holds the index of the lamp in the lamp array 
+        2- lampValue a pointer that receives LAMP_STATE_ON or LAMP_STATE_OFF
+  
+  Output: errStat
+
+ */
+extern errStat Lamp_GetState(u8 lampNum, u8* lampValue);
+
 /* 
   Description: This function shall return an element of lamp from lampMap array
   
@@ -50,3 +82,16 @@ extern errStat Lamp_SwitchOff(u8 lampNum);
 
  */
 extern lampmap_t * getLampMap (u8 lampNum);
+
+#ifdef HOST_BUILD
+/* 
+  Description: This function shall replace the lamp table for the calling thread,
+  used by host simulations of several vehicle variants
+  
+  Input: table an array of Lamps_NUM elements, 0 to go back to lampMap
+  
+  Output: void
+
+ */
+extern void setLampMap (const lampmap_t * table);
+#endif
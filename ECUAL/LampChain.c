@@ -0,0 +1,184 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "ssi.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+#include "LampChain.h"
+#include "LampChain_config.h"
+
+
+/* Frame buffer, byte 0 is shifted out first and ends in the farthest register */
+static ECU_STATE u8 lampChainFrame[LAMPCHAIN_BYTES];
+
+/* Copy of the frame on the wire, the frame buffer stays writable meanwhile */
+static ECU_STATE u8 lampChainTx[LAMPCHAIN_BYTES];
+static ECU_STATE volatile u16 lampChainTxIndex;
+static ECU_STATE volatile u8 lampChainBusy;
+static ECU_STATE volatile u8 lampChainDirty;
+
+
+/*
+  Description: This function shall put as many bytes of the frame on the wire
+  as the transmit FIFO takes
+
+  Input: void
+
+  Output: void
+
+ */
+static void LampChain_Fill(void)
+{
+  while ((lampChainTxIndex < LAMPCHAIN_BYTES) &&
+         (SSI_DataPutNonBlocking(LAMPCHAIN_SSI_BASE,lampChainTx[lampChainTxIndex]) == ERR_STAT_OK))
+  {
+    lampChainTxIndex++;
+  }
+}
+
+/*
+  Description: SSI interrupt, entered when the transmit FIFO has run empty and
+  the shifter is idle: refills the FIFO, or latches the completed frame
+
+  Input: void
+
+  Output: void
+
+ */
+static void LampChain_TxNotification(void)
+{
+  if (lampChainTxIndex < LAMPCHAIN_BYTES)
+  {
+    LampChain_Fill();
+    return;
+  }
+
+  /* Every bit is in place, move them to the outputs at once */
+  GPIO_PinWrite(LAMPCHAIN_LATCH_PORT,LAMPCHAIN_LATCH_PIN,LAMPCHAIN_LATCH_PIN);
+  GPIO_PinWrite(LAMPCHAIN_LATCH_PORT,LAMPCHAIN_LATCH_PIN,0);
+
+  SSI_IntDisable(LAMPCHAIN_SSI_BASE,SSI_INT_TXEOT);
+  lampChainBusy = 0;
+}
+
+/*
+  Description: This function shall configure the SSI, its pins, the latch pin
+  and the SSI interrupt, all outputs go low with the first frame
+
+  Input: void
+
+  Output: errStat
+
+ */
+extern errStat LampChain_Init(void)
+{
+  errStat status = ERR_STAT_OK;
+  u16 i;
+
+  NVIC_IntDisable(LAMPCHAIN_SSI_INT);
+
+  /* The registers power up with random outputs, the first frame clears them */
+  for (i = 0; i < LAMPCHAIN_BYTES; i++)
+  {
+    lampChainFrame[i] = 0;
+  }
+  lampChainTxIndex = 0;
+  lampChainBusy = 0;
+  lampChainDirty = 1;
+
+  /* Enabling peripheral clocks of the SSI and its port */
+  status |= SYSCTL_controlGPIO(LAMPCHAIN_GPIO_SYSCTL,SYSCTL_GPIO_ENABLE);
+  status |= SYSCTL_controlSSI(LAMPCHAIN_SSI_SYSCTL,SYSCTL_SSI_ENABLE);
+
+  /* Clock and data to the SSI, the latch stays a GPIO output idling low */
+  status |= GPIO_AltFunctionSet(LAMPCHAIN_GPIO_PORT,LAMPCHAIN_GPIO_PINS,LAMPCHAIN_GPIO_FUNC);
+  status |= GPIO_DirModeSet(LAMPCHAIN_LATCH_PORT,LAMPCHAIN_LATCH_PIN,GPIO_DIR_MODE_OUT);
+  status |= GPIO_PinWrite(LAMPCHAIN_LATCH_PORT,LAMPCHAIN_LATCH_PIN,0);
+
+  status |= SSI_Init(LAMPCHAIN_SSI_BASE,SYSCTL_MAIN_OSCILLATOR_HZ,LAMPCHAIN_BITRATE);
+  status |= SSI_IntRegister(LAMPCHAIN_SSI_BASE,LampChain_TxNotification);
+  status |= NVIC_IntPrioritySet(LAMPCHAIN_SSI_INT,LAMPCHAIN_SSI_PRIORITY);
+  status |= NVIC_IntEnable(LAMPCHAIN_SSI_INT);
+
+  return status;
+}
+
+/*
+  Description: This function shall set an output in the frame buffer, the
+  buffer is marked dirty when the output changes
+
+  Input:
+        1- output which holds the index of the output in the chain
+        2- level 1 to drive the output high, 0 to drive it low
+
+  Output: errStat
+
+ */
+extern errStat LampChain_SetOutput(u16 output, u8 level)
+{
+  u8 mask;
+  u8 * byte;
+  u8 old;
+  u32 priMask;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (output >= LAMPCHAIN_OUTPUTS)
+  {
+    Det_ReportError(MODULE_ID_LAMPCHAIN, LAMPCHAIN_API_SET_OUTPUT, LAMPCHAIN_E_PARAM_OUTPUT);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  /* The register next to the ECU receives the last byte */
+  byte = &lampChainFrame[LAMPCHAIN_BYTES - 1 - (output / 8)];
+  mask = (u8)(1 << (output % 8));
+
+  /* Lamps may also be switched from timer callbacks */
+  priMask = NVIC_IntMasterDisable();
+  old = *byte;
+  *byte = level ? (old | mask) : (old & ~mask);
+  if (*byte != old)
+  {
+    lampChainDirty = 1;
+  }
+  NVIC_IntMasterRestore(priMask);
+
+  return ERR_STAT_OK;
+}
+
+/*
+  Description: This function shall be called from the main loop, it starts
+  sending the frame buffer when it is dirty and no frame is on the wire
+
+  Input: void
+
+  Output: void
+
+ */
+extern void LampChain_MainFunction(void)
+{
+  u32 priMask;
+  u16 i;
+
+  if (!lampChainDirty || lampChainBusy)
+  {
+    return;
+  }
+
+  priMask = NVIC_IntMasterDisable();
+  for (i = 0; i < LAMPCHAIN_BYTES; i++)
+  {
+    lampChainTx[i] = lampChainFrame[i];
+  }
+  lampChainDirty = 0;
+  NVIC_IntMasterRestore(priMask);
+
+  /* A short chain fits the FIFO, the interrupt then only latches */
+  lampChainTxIndex = 0;
+  lampChainBusy = 1;
+  LampChain_Fill();
+  SSI_IntEnable(LAMPCHAIN_SSI_BASE,SSI_INT_TXEOT);
+}
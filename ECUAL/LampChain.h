@@ -0,0 +1,54 @@
+/*
+  Lamps on a daisy chain of shift registers (74HC595 or LED drivers with the
+  same interface) clocked by an SSI. The state of every output is kept in a
+  frame buffer; setting an output only changes the buffer and marks it
+  dirty. LampChain_MainFunction sends a dirty buffer as one frame: the
+  first SSI_FIFO_DEPTH bytes go straight into the transmit FIFO and the
+  end-of-transmission interrupt refills it, so a 64 output chain costs one
+  interrupt per frame. When the last bit has been shifted the latch pin is
+  pulsed and all outputs change together.
+
+  Output 0 is the first output (QA) of the register next to the ECU. Lamps
+  changed while a frame is on the wire go out with the next frame.
+*/
+
+/* API and error ids reported to the Development Error Tracer */
+#define LAMPCHAIN_API_SET_OUTPUT    0x00
+
+#define LAMPCHAIN_E_PARAM_OUTPUT    0x0A
+
+
+/*
+  Description: This function shall configure the SSI, its pins, the latch pin
+  and the SSI interrupt, all outputs go low with the first frame
+
+  Input: void
+
+  Output: errStat
+
+ */
+extern errStat LampChain_Init(void);
+
+/*
+  Description: This function shall set an output in the frame buffer, the
+  buffer is marked dirty when the output changes
+
+  Input:
+        1- output which holds the index of the output in the chain
+        2- level 1 to drive the output high, 0 to drive it low
+
+  Output: errStat
+
+ */
+extern errStat LampChain_SetOutput(u16 output, u8 level);
+
+/*
+  Description: This function shall be called from the main loop, it starts
+  sending the frame buffer when it is dirty and no frame is on the wire
+
+  Input: void
+
+  Output: void
+
+ */
+extern void LampChain_MainFunction(void);
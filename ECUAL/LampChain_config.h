@@ -0,0 +1,25 @@
+/*
+  Outputs of the chain, 8 per 74HC595 (or compatible LED driver). Can be
+  overridden from the build, e.g. -DLAMPCHAIN_OUTPUTS=200.
+*/
+#ifndef LAMPCHAIN_OUTPUTS
+#define LAMPCHAIN_OUTPUTS           64
+#endif
+#define LAMPCHAIN_BYTES             ((LAMPCHAIN_OUTPUTS + 7) / 8)
+
+/* SSI0 clock on PA2 and data on PA5, the latch (RCLK) on PA3 as a GPIO */
+#define LAMPCHAIN_SSI_BASE          SSI0_BASE
+#define LAMPCHAIN_SSI_SYSCTL        SYSCTL_SSI_0
+#define LAMPCHAIN_SSI_INT           NVIC_INT_SSI0
+#define LAMPCHAIN_SSI_PRIORITY      5
+#define LAMPCHAIN_BITRATE           4000000
+#define LAMPCHAIN_GPIO_SYSCTL       SYSCTL_GPIO_A
+#define LAMPCHAIN_GPIO_PORT         GPIO_PORTA_BASE
+#define LAMPCHAIN_GPIO_PINS         (GPIO_PIN_2 | GPIO_PIN_5)
+#define LAMPCHAIN_GPIO_FUNC         2
+#define LAMPCHAIN_LATCH_PORT        GPIO_PORTA_BASE
+#define LAMPCHAIN_LATCH_PIN         GPIO_PIN_3
+
+#if (LAMPCHAIN_OUTPUTS == 0) || (LAMPCHAIN_BYTES > 0xFF)
+#error "LAMPCHAIN_OUTPUTS must be 1 to 2040"
+#endif
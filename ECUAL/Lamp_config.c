@@ -10,9 +10,14 @@
   Creating an array of Lamp struct that holds Lamps in the system
 */
 const lampmap_t lampMap [Lamps_NUM] = {
-  {Lamp_DIMMER_PIN,Lamp_DIMMER_PORT,Lamp_DIMMER_ON,Lamp_DIMMER_OFF}
+  {Lamp_DIMMER_PIN,Lamp_DIMMER_PORT,Lamp_DIMMER_ON,Lamp_DIMMER_OFF,Lamp_DIMMER_BACKEND,Lamp_DIMMER_OUTPUT}
 };
 
+#ifdef HOST_BUILD
+/* Table in use, host simulations can give every ECU its own (HOST/fleet_sim.c) */
+static ECU_STATE const lampmap_t * lampMapActive = lampMap;
+#endif
+
 
 /* 
   Description: This function shall return an element of Lamp from LampMap array
@@ -24,5 +29,25 @@ const lampmap_t lampMap [Lamps_NUM] = {
  */
 extern lampmap_t * getLampMap (u8 lampNum)
 {
+#ifdef HOST_BUILD
+  return &lampMapActive[lampNum];
+#else
   return &lampMap[lampNum];
+#endif
+}
+
+#ifdef HOST_BUILD
+/* 
+  Description: This function shall replace the lamp table for the calling thread,
+  used by host simulations of several vehicle variants
+  
+  Input: table an array of Lamps_NUM elements, 0 to go back to lampMap
+  
+  Output: void
+
+ */
+extern void setLampMap (const lampmap_t * table)
+{
+  lampMapActive = (table != 0) ? table : lampMap;
 }
+#endif
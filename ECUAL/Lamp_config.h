@@ -5,4 +5,6 @@
 #define Lamp_DIMMER_PORT     GPIO_PORTF_BASE
 #define Lamp_DIMMER_ON       pinSet
 #define Lamp_DIMMER_OFF      pinReset
+#define Lamp_DIMMER_BACKEND  LAMP_BACKEND_GPIO
+#define Lamp_DIMMER_OUTPUT   0
 
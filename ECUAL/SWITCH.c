@@ -1,47 +1,586 @@
 #include "STD_TYPES.h"
 #include "sysctl.h"
 #include "gpio.h"
+#include "nvic.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+#include "TimerWheel.h"
+#include "TimerWheel_config.h"
 #include "SWITCH.h"
 #include "SWITCH_config.h"
 
 
+/* Matrix scan state, a set bit is a pressed switch on that column pin */
+static ECU_STATE u8 switchMatrixReady;
+static ECU_STATE u8 switchMatrixRowPin[SWITCH_MATRIX_ROW_NUM];
+static ECU_STATE u8 switchMatrixRow;
+static ECU_STATE u8 switchMatrixScan[SWITCH_MATRIX_ROW_NUM];
+static ECU_STATE volatile u8 switchMatrixState[SWITCH_MATRIX_ROW_NUM];
+static ECU_STATE u8 switchMatrixGhosted;
+
+/* States of the gesture state machine */
+#define SWITCH_GESTURE_IDLE          0
+#define SWITCH_GESTURE_PRESSED       1  /* first press, long timer running */
+#define SWITCH_GESTURE_RELEASED      2  /* short press over, double timer running */
+#define SWITCH_GESTURE_HELD          3  /* long or double reported, waiting for release */
+
+/* GPIO ports that can carry gesture switches and their interrupts */
+#define SWITCH_PORT_NUM              6
+static const u32 switchPortBase[SWITCH_PORT_NUM] = {
+  GPIO_PORTA_BASE, GPIO_PORTB_BASE, GPIO_PORTC_BASE,
+  GPIO_PORTD_BASE, GPIO_PORTE_BASE, GPIO_PORTF_BASE
+};
+static const u8 switchPortInt[SWITCH_PORT_NUM] = {
+  NVIC_INT_GPIOA, NVIC_INT_GPIOB, NVIC_INT_GPIOC,
+  NVIC_INT_GPIOD, NVIC_INT_GPIOE, NVIC_INT_GPIOF
+};
+
+/* Switch behind an edge, switchNum + 1 or 0 if the pin has no gesture switch */
+static ECU_STATE u8 switchPinSwitch[SWITCH_PORT_NUM][8];
+static ECU_STATE u8 switchMatrixSwitch[SWITCH_MATRIX_ROW_NUM][8];
+static ECU_STATE u8 switchTimerSwitch[TIMERWHEEL_TIMER_NUM];
+
+/* Gesture state per switch */
+static ECU_STATE u8 switchGestureReady[SWITCH_NUM];
+static ECU_STATE u8 switchGestureState[SWITCH_NUM];
+static ECU_STATE switchState switchGestureLevel[SWITCH_NUM];
+static ECU_STATE volatile u8 switchSettling[SWITCH_NUM];
+static ECU_STATE volatile u32 switchEdgeTicks[SWITCH_NUM];
+static ECU_STATE u32 switchMarkTicks[SWITCH_NUM];
+static ECU_STATE u16 switchSettleTimer[SWITCH_NUM];
+static ECU_STATE u16 switchGestureTimer[SWITCH_NUM];
+
+/* Gesture events, written in the timer interrupt and read by the main loop */
+static ECU_STATE u8 switchGestureRingSwitch[SWITCH_GESTURE_RING_SIZE];
+static ECU_STATE u8 switchGestureRingEvent[SWITCH_GESTURE_RING_SIZE];
+static ECU_STATE volatile u8 switchGestureHead;
+static ECU_STATE volatile u8 switchGestureTail;
+
+
 /* 
-  Description: This function shall initiate the specified switch num by setting its
-  pin, port, mode and configuration in a GPIO object and passing it to GPIO module
+  Description: This function shall note an edge of a gesture switch: the first
+  edge of a burst is stamped and every edge restarts the settle timer
+  
+  Input: switchNum which holds the index of the switch in the switch array 
+  
+  Output: void
+
+ */
+static void Switch_GestureEdge(u8 switchNum)
+{
+  u32 priMask;
+  u32 now;
+  
+  TimerWheel_GetTicks(&now);
+  
+  /* The settle timer may expire in between on the timer interrupt */
+  priMask = NVIC_IntMasterDisable();
+  if (!switchSettling[switchNum])
+  {
+    switchEdgeTicks[switchNum] = now;
+    switchSettling[switchNum] = 1;
+  }
+  TimerWheel_Start(switchSettleTimer[switchNum],getSwitchGesture(switchNum)->settleMs,TIMERWHEEL_ONE_SHOT);
+  NVIC_IntMasterRestore(priMask);
+}
+
+/* 
+  Description: GPIO interrupt of a port with gesture switches, called with the
+  pins whose edge was pending
+  
+  Input: 
+        1- port the base address of the port
+        2- pins the pins that saw an edge
+  
+  Output: void
+
+ */
+static void Switch_EdgeNotification(u32 port, u8 pins)
+{
+  u8 portIndex;
+  u8 bit;
+  
+  for (portIndex = 0; (portIndex < SWITCH_PORT_NUM) && (switchPortBase[portIndex] != port); portIndex++)
+  {
+  }
+  if (portIndex == SWITCH_PORT_NUM)
+  {
+    return;
+  }
+  
+  for (bit = 0; pins != 0; bit++, pins >>= 1)
+  {
+    if ((pins & 1) && switchPinSwitch[portIndex][bit])
+    {
+      Switch_GestureEdge(switchPinSwitch[portIndex][bit] - 1);
+    }
+  }
+}
+
+/* 
+  Description: This function shall queue a gesture event, the event is lost
+  and counted as an error when the ring is full
+  
+  Input: 
+        1- switchNum which holds the index of the switch in the switch array 
+        2- gesture the SWITCH_GESTURE_ event
+  
+  Output: void
+
+ */
+static void Switch_GesturePut(u8 switchNum, u8 gesture)
+{
+  u8 head = switchGestureHead;
+  
+  if ((u8)(head - switchGestureTail) >= SWITCH_GESTURE_RING_SIZE)
+  {
+    ErrCnt_Report(MODULE_ID_SWITCH);
+    return;
+  }
+  switchGestureRingSwitch[head & (SWITCH_GESTURE_RING_SIZE - 1)] = switchNum;
+  switchGestureRingEvent[head & (SWITCH_GESTURE_RING_SIZE - 1)] = gesture;
+  switchGestureHead = head + 1;
+}
+
+/* 
+  Description: This function shall start the gesture timer to expire a given
+  time after an edge, the settle time is added so that an edge inside the
+  threshold has always settled when the timer expires
+  
+  Input: 
+        1- switchNum which holds the index of the switch in the switch array 
+        2- edgeTicks the time of the edge
+        3- thresholdMs the time after the edge
+  
+  Output: void
+
+ */
+static void Switch_GestureArm(u8 switchNum, u32 edgeTicks, u16 thresholdMs)
+{
+  u32 delay = (u32)thresholdMs + getSwitchGesture(switchNum)->settleMs;
+  u32 elapsed;
+  u32 now;
+  
+  TimerWheel_GetTicks(&now);
+  elapsed = now - edgeTicks;
+  TimerWheel_Start(switchGestureTimer[switchNum],(elapsed < delay) ? (delay - elapsed) : 1,TIMERWHEEL_ONE_SHOT);
+}
+
+/* 
+  Description: This function shall run the gesture state machine on a settled
+  press or release
+  
+  Input: 
+        1- switchNum which holds the index of the switch in the switch array 
+        2- level the new level, PRESSED or RELEASED
+        3- edgeTicks the time of the first edge of the burst
+  
+  Output: void
+
+ */
+static void Switch_GestureStep(u8 switchNum, switchState level, u32 edgeTicks)
+{
+  const switchgesture_t * gestureElement = getSwitchGesture(switchNum);
+  u8 state = switchGestureState[switchNum];
+  
+  if (level == PRESSED)
+  {
+    if (state == SWITCH_GESTURE_RELEASED)
+    {
+      TimerWheel_Stop(switchGestureTimer[switchNum]);
+      if ((edgeTicks - switchMarkTicks[switchNum]) <= gestureElement->doubleMs)
+      {
+        Switch_GesturePut(switchNum,SWITCH_GESTURE_DOUBLE);
+        switchGestureState[switchNum] = SWITCH_GESTURE_HELD;
+        return;
+      }
+      /* Too late for a double, the first press was a short one */
+      Switch_GesturePut(switchNum,SWITCH_GESTURE_SHORT);
+      state = SWITCH_GESTURE_IDLE;
+    }
+    if (state == SWITCH_GESTURE_IDLE)
+    {
+      switchMarkTicks[switchNum] = edgeTicks;
+      switchGestureState[switchNum] = SWITCH_GESTURE_PRESSED;
+      if (gestureElement->longMs != 0)
+      {
+        Switch_GestureArm(switchNum,edgeTicks,gestureElement->longMs);
+      }
+    }
+    return;
+  }
+  
+  if (state == SWITCH_GESTURE_PRESSED)
+  {
+    TimerWheel_Stop(switchGestureTimer[switchNum]);
+    if ((gestureElement->longMs != 0) &&
+        ((edgeTicks - switchMarkTicks[switchNum]) >= gestureElement->longMs))
+    {
+      Switch_GesturePut(switchNum,SWITCH_GESTURE_LONG);
+      switchGestureState[switchNum] = SWITCH_GESTURE_IDLE;
+    }
+    else if (gestureElement->doubleMs != 0)
+    {
+      switchMarkTicks[switchNum] = edgeTicks;
+      switchGestureState[switchNum] = SWITCH_GESTURE_RELEASED;
+      Switch_GestureArm(switchNum,edgeTicks,gestureElement->doubleMs);
+    }
+    else
+    {
+      Switch_GesturePut(switchNum,SWITCH_GESTURE_SHORT);
+      switchGestureState[switchNum] = SWITCH_GESTURE_IDLE;
+    }
+  }
+  else if (state == SWITCH_GESTURE_HELD)
+  {
+    switchGestureState[switchNum] = SWITCH_GESTURE_IDLE;
+  }
+}
+
+/* 
+  Description: Timer wheel callback of the settle and gesture timers: a settled
+  burst is handed to the state machine if the level changed, an expired
+  gesture timer decides a long or a short press
+  
+  Input: timerId the expired timer
+  
+  Output: void
+
+ */
+static void Switch_GestureTimeout(u16 timerId)
+{
+  u8 switchNum = switchTimerSwitch[timerId] - 1;
+  switchState level;
+  
+  if (timerId == switchSettleTimer[switchNum])
+  {
+    switchSettling[switchNum] = 0;
+    Switch_GetSwitchState(switchNum,&level);
+    /* A burst that ends on the level it started from is noise */
+    if (level != switchGestureLevel[switchNum])
+    {
+      switchGestureLevel[switchNum] = level;
+      Switch_GestureStep(switchNum,level,switchEdgeTicks[switchNum]);
+    }
+    return;
+  }
+  
+  if (switchGestureState[switchNum] == SWITCH_GESTURE_PRESSED)
+  {
+    Switch_GesturePut(switchNum,SWITCH_GESTURE_LONG);
+    switchGestureState[switchNum] = SWITCH_GESTURE_HELD;
+  }
+  else if (switchGestureState[switchNum] == SWITCH_GESTURE_RELEASED)
+  {
+    Switch_GesturePut(switchNum,SWITCH_GESTURE_SHORT);
+    switchGestureState[switchNum] = SWITCH_GESTURE_IDLE;
+  }
+}
+
+/* 
+  Description: This function shall create the timers of a gesture switch and
+  hook its edges, the pin interrupt for a pin switch or the scan for a
+  matrix switch
   
   Input: switchNum which holds the index of the switch in the switch array 
   
   Output: errStat
 
  */
-extern errStat Switch_Init(u8 switchNum)
+static errStat Switch_GestureInit(u8 switchNum)
 {
   errStat status = ERR_STAT_OK;
-  if (switchNum >= SWITCH_NUM)
+  switchmap_t * switchMapElement = getSwitchMap(switchNum);
+  u8 portIndex;
+  u8 bit;
+  
+#if (DET_DEV_ERROR_DETECT == 1)
+  const switchgesture_t * gestureElement = getSwitchGesture(switchNum);
+  
+  /* An edge inside the settle time would end the gesture early */
+  if (((gestureElement->longMs != 0) && (gestureElement->longMs <= gestureElement->settleMs)) ||
+      ((gestureElement->doubleMs != 0) && (gestureElement->doubleMs <= gestureElement->settleMs)))
   {
-    status = ERR_STAT_NOK;
+    Det_ReportError(MODULE_ID_SWITCH, SWITCH_API_INIT, SWITCH_E_PARAM_GESTURE);
+    return ERR_STAT_NOK;
   }
-  /* Creating switch element */
-  switchmap_t * switchMapElement; 
+#endif
+  
+  if (switchGestureReady[switchNum])
+  {
+    return status;
+  }
+  
+  status |= TimerWheel_Create(Switch_GestureTimeout,&switchSettleTimer[switchNum]);
+  status |= TimerWheel_Create(Switch_GestureTimeout,&switchGestureTimer[switchNum]);
+  if (status != ERR_STAT_OK)
+  {
+    return status;
+  }
+  switchTimerSwitch[switchSettleTimer[switchNum]] = switchNum + 1;
+  switchTimerSwitch[switchGestureTimer[switchNum]] = switchNum + 1;
+  
+  switchGestureState[switchNum] = SWITCH_GESTURE_IDLE;
+  switchSettling[switchNum] = 0;
+  Switch_GetSwitchState(switchNum,&switchGestureLevel[switchNum]);
+  
+  for (bit = 0; (bit < 8) && !(switchMapElement->pin & (1 << bit)); bit++)
+  {
+  }
+  
+  if (switchMapElement->source == SWITCH_SOURCE_MATRIX)
+  {
+    switchMatrixSwitch[switchMapElement->matrixRow][bit] = switchNum + 1;
+  }
+  else
+  {
+    for (portIndex = 0; (portIndex < SWITCH_PORT_NUM) && (switchPortBase[portIndex] != switchMapElement->port); portIndex++)
+    {
+    }
+    if (portIndex == SWITCH_PORT_NUM)
+    {
+      return ERR_STAT_NOK;
+    }
+    switchPinSwitch[portIndex][bit] = switchNum + 1;
+    
+    status |= GPIO_IntTypeSet(switchMapElement->port,switchMapElement->pin,GPIO_BOTH_EDGES);
+    status |= GPIO_IntRegister(switchMapElement->port,Switch_EdgeNotification);
+    status |= GPIO_IntEnable(switchMapElement->port,switchMapElement->pin);
+    status |= NVIC_IntPrioritySet(switchPortInt[portIndex],SWITCH_GESTURE_INT_PRIORITY);
+    status |= NVIC_IntEnable(switchPortInt[portIndex]);
+  }
+  
+  switchGestureReady[switchNum] = (status == ERR_STAT_OK);
+  
+  return status;
+}
+
+
+/* 
+  Description: This function shall take over a complete scan, rows that form a
+  rectangle with another row (two shared pressed columns) keep their state
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void Switch_MatrixPublish(void)
+{
+  u8 ghostRows = 0;
+  u8 common;
+  u8 changed;
+  u8 bit;
+  u8 i, j;
+  
+  for (i = 0; i < SWITCH_MATRIX_ROW_NUM; i++)
+  {
+    for (j = i + 1; j < SWITCH_MATRIX_ROW_NUM; j++)
+    {
+      common = switchMatrixScan[i] & switchMatrixScan[j];
+      /* More than one bit set */
+      if (common & (common - 1))
+      {
+        ghostRows |= (u8)((1 << i) | (1 << j));
+      }
+    }
+  }
+  
+  for (i = 0; i < SWITCH_MATRIX_ROW_NUM; i++)
+  {
+    if (!(ghostRows & (1 << i)))
+    {
+      changed = switchMatrixState[i] ^ switchMatrixScan[i];
+      switchMatrixState[i] = switchMatrixScan[i];
+      
+      /* Changed columns are the edges of gesture switches */
+      for (bit = 0; changed != 0; bit++, changed >>= 1)
+      {
+        if ((changed & 1) && switchMatrixSwitch[i][bit])
+        {
+          Switch_GestureEdge(switchMatrixSwitch[i][bit] - 1);
+        }
+      }
+    }
+  }
+  
+  /* Counted once per ambiguous episode, not on every scan */
+  if (ghostRows && !switchMatrixGhosted)
+  {
+    ErrCnt_Report(MODULE_ID_SWITCH);
+  }
+  switchMatrixGhosted = (ghostRows != 0);
+}
+
+/* 
+  Description: Timer wheel callback, reads the columns of the row driven since
+  the last tick and drives the next row
+  
+  Input: timerId the scan timer
+  
+  Output: void
+
+ */
+static void Switch_MatrixScan(u16 timerId)
+{
+  u8 columns;
+  
+  (void)timerId;
+  
+  /* Pressed switches pull their column low */
+  GPIO_PinRead(SWITCH_MATRIX_COLUMN_PORT,SWITCH_MATRIX_COLUMN_PINS,&columns);
+  switchMatrixScan[switchMatrixRow] = (u8)(~columns) & SWITCH_MATRIX_COLUMN_PINS;
+  
+  switchMatrixRow++;
+  if (switchMatrixRow == SWITCH_MATRIX_ROW_NUM)
+  {
+    switchMatrixRow = 0;
+    Switch_MatrixPublish();
+  }
+  
+  /* Release every row but the next one */
+  GPIO_PinWrite(SWITCH_MATRIX_ROW_PORT,SWITCH_MATRIX_ROW_PINS,
+                (u8)(SWITCH_MATRIX_ROW_PINS & ~switchMatrixRowPin[switchMatrixRow]));
+}
+
+/* 
+  Description: This function shall configure the matrix pins and start the scan
+  timer once, for the first matrix switch
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+static errStat Switch_MatrixInit(void)
+{
+  errStat status = ERR_STAT_OK;
+  u16 timerId;
+  u8 pin;
+  u8 i = 0;
+  
+  if (switchMatrixReady)
+  {
+    return status;
+  }
+  
+  for (pin = 1; pin != 0; pin <<= 1)
+  {
+    if (SWITCH_MATRIX_ROW_PINS & pin)
+    {
+      switchMatrixRowPin[i] = pin;
+      switchMatrixScan[i] = 0;
+      switchMatrixState[i] = 0;
+      i++;
+    }
+  }
+  switchMatrixRow = 0;
+  switchMatrixGhosted = 0;
+  
+  /* Rows released (open drain high) but the first, columns pulled up */
+  status |= SYSCTL_controlGPIO(SWITCH_MATRIX_ROW_SYSCTL,SYSCTL_GPIO_ENABLE);
+  status |= SYSCTL_controlGPIO(SWITCH_MATRIX_COLUMN_SYSCTL,SYSCTL_GPIO_ENABLE);
+  status |= GPIO_PinWrite(SWITCH_MATRIX_ROW_PORT,SWITCH_MATRIX_ROW_PINS,
+                          (u8)(SWITCH_MATRIX_ROW_PINS & ~switchMatrixRowPin[0]));
+  status |= GPIO_DirModeSet(SWITCH_MATRIX_ROW_PORT,SWITCH_MATRIX_ROW_PINS,GPIO_DIR_MODE_OUT);
+  status |= GPIO_PadConfigSet(SWITCH_MATRIX_ROW_PORT,SWITCH_MATRIX_ROW_PINS,GPIO_STRENGTH_2MA,GPIO_PIN_TYPE_OD);
+  status |= GPIO_DirModeSet(SWITCH_MATRIX_COLUMN_PORT,SWITCH_MATRIX_COLUMN_PINS,GPIO_DIR_MODE_IN);
+  status |= GPIO_PadConfigSet(SWITCH_MATRIX_COLUMN_PORT,SWITCH_MATRIX_COLUMN_PINS,GPIO_STRENGTH_2MA,GPIO_PIN_TYPE_STD_WPU);
+  
+  status |= TimerWheel_Create(Switch_MatrixScan,&timerId);
+  if (status == ERR_STAT_OK)
+  {
+    status = TimerWheel_Start(timerId,SWITCH_MATRIX_ROW_TICKS,SWITCH_MATRIX_ROW_TICKS);
+  }
+  
+  switchMatrixReady = (status == ERR_STAT_OK);
+  
+  return status;
+}
+
+
+/* 
+  Description: This function shall configure the pin of a pin switch
+  
+  Input: switchMapElement the switch
+  
+  Output: errStat
+
+ */
+static errStat Switch_PinInit(switchmap_t * switchMapElement)
+{
+  errStat status = ERR_STAT_OK;
   
   /* Enabling peripheral clock on PORTA */
   SYSCTL_controlGPIO(SYSCTL_GPIO_F,SYSCTL_GPIO_ENABLE);
-  
-  /* Getting required switch configurations */
-  switchMapElement = getSwitchMap(switchNum);
 
   /* Initiating GPIO element */
-  GPIO_DirModeSet(switchMapElement->port,switchMapElement->pin,GPIO_DIR_MODE_IN);
-  GPIO_PadConfigSet(switchMapElement->port,switchMapElement->pin,GPIO_STRENGTH_2MA,switchMapElement->pullState);
+  status |= GPIO_DirModeSet(switchMapElement->port,switchMapElement->pin,GPIO_DIR_MODE_IN);
+  status |= GPIO_PadConfigSet(switchMapElement->port,switchMapElement->pin,GPIO_STRENGTH_2MA,switchMapElement->pullState);
   
   /* Setting bit in ODR in case of pull up switch and reseting it in case of pull down switch */
   if (GPIO_PIN_TYPE_STD_WPU == switchMapElement->pullState)
   {
-    GPIO_PinWrite(switchMapElement->port,switchMapElement->pin,pinSet);
+    status |= GPIO_PinWrite(switchMapElement->port,switchMapElement->pin,pinSet);
   }
   else if (GPIO_PIN_TYPE_STD_WPD == switchMapElement->pullState)
   {
-    GPIO_PinWrite(switchMapElement->port,switchMapElement->pin,pinReset);
+    status |= GPIO_PinWrite(switchMapElement->port,switchMapElement->pin,pinReset);
+  }
+  
+  return status;
+}
+
+
+
+/* 
+  Description: This function shall initiate the specified switch num by setting its
+  pin, port, mode and configuration in a GPIO object and passing it to GPIO module,
+  the first matrix switch starts the matrix scan, a switch with a settle time
+  starts its gesture recognition
+  
+  Input: switchNum which holds the index of the switch in the switch array 
+  
+  Output: errStat
+
+ */
+extern errStat Switch_Init(u8 switchNum)
+{
+  errStat status = ERR_STAT_OK;
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (switchNum >= SWITCH_NUM)
+  {
+    Det_ReportError(MODULE_ID_SWITCH, SWITCH_API_INIT, SWITCH_E_PARAM_SWITCH);
+    return ERR_STAT_NOK;
+  }
+#endif
+  /* Creating switch element */
+  switchmap_t * switchMapElement; 
+  
+  /* Getting required switch configurations */
+  switchMapElement = getSwitchMap(switchNum);
+  
+  if (switchMapElement->source == SWITCH_SOURCE_MATRIX)
+  {
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (switchMapElement->matrixRow >= SWITCH_MATRIX_ROW_NUM)
+    {
+      Det_ReportError(MODULE_ID_SWITCH, SWITCH_API_INIT, SWITCH_E_PARAM_ROW);
+      return ERR_STAT_NOK;
+    }
+#endif
+    status = Switch_MatrixInit();
+  }
+  else
+  {
+    status = Switch_PinInit(switchMapElement);
+  }
+  
+  if ((status == ERR_STAT_OK) && (getSwitchGesture(switchNum)->settleMs != 0))
+  {
+    status = Switch_GestureInit(switchNum);
   }
   
   return status;
@@ -60,17 +599,31 @@ extern errStat Switch_Init(u8 switchNum)
 extern errStat Switch_GetSwitchState(u8 switchNum, switchState* switchValue)
 {
   errStat status = ERR_STAT_OK;
+#if (DET_DEV_ERROR_DETECT == 1)
   if (switchNum >= SWITCH_NUM)
   {
-    status = ERR_STAT_NOK;
+    Det_ReportError(MODULE_ID_SWITCH, SWITCH_API_GET_SWITCH_STATE, SWITCH_E_PARAM_SWITCH);
+    return ERR_STAT_NOK;
+  }
+  if (switchValue == 0)
+  {
+    Det_ReportError(MODULE_ID_SWITCH, SWITCH_API_GET_SWITCH_STATE, SWITCH_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
   }
+#endif
   /* Creating switch element */
   switchmap_t * switchMapElement;  
   /* Getting required switch configurations */
   switchMapElement = getSwitchMap(switchNum);
+  
+  if (switchMapElement->source == SWITCH_SOURCE_MATRIX)
+  {
+    *switchValue = (switchMatrixState[switchMapElement->matrixRow] & switchMapElement->pin) ? PRESSED : RELEASED;
+    return status;
+  }
 
   /* Reading GPIO value */
-  GPIO_PinRead(switchMapElement->port,switchMapElement->pin,switchValue);
+  status |= GPIO_PinRead(switchMapElement->port,switchMapElement->pin,switchValue);
   
   /* The switchValue holds the pin mask which won't equal fixed number all time
      if not zero, then it has a value equals to the pin mask
@@ -90,3 +643,37 @@ extern errStat Switch_GetSwitchState(u8 switchNum, switchState* switchValue)
   
 }
 
+
+/* 
+  Description: This function shall take the oldest gesture event out of the
+  gesture ring
+  
+  Input: 
+        1- switchNum receives the index of the switch in the switch array 
+        2- gesture receives SWITCH_GESTURE_SHORT, _LONG or _DOUBLE
+        
+  Output: errStat, ERR_STAT_NOK when no gesture is waiting
+
+ */
+extern errStat Switch_GetGesture(u8* switchNum, u8* gesture)
+{
+  u8 tail = switchGestureTail;
+  
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((switchNum == 0) || (gesture == 0))
+  {
+    Det_ReportError(MODULE_ID_SWITCH, SWITCH_API_GET_GESTURE, SWITCH_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  if (tail == switchGestureHead)
+  {
+    return ERR_STAT_NOK;
+  }
+  *switchNum = switchGestureRingSwitch[tail & (SWITCH_GESTURE_RING_SIZE - 1)];
+  *gesture = switchGestureRingEvent[tail & (SWITCH_GESTURE_RING_SIZE - 1)];
+  switchGestureTail = tail + 1;
+  
+  return ERR_STAT_OK;
+}
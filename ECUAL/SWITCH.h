@@ -6,16 +6,76 @@
 #define PRESSED  1
 #define RELEASED 0 
 
+/* Values of the source field */
+#define SWITCH_SOURCE_PIN     0
+#define SWITCH_SOURCE_MATRIX  1
+
+/* Gesture events returned by Switch_GetGesture */
+#define SWITCH_GESTURE_SHORT  1
+#define SWITCH_GESTURE_LONG   2
+#define SWITCH_GESTURE_DOUBLE 3
+
+/* API and error ids reported to the Development Error Tracer */
+#define SWITCH_API_INIT              0x00
+#define SWITCH_API_GET_SWITCH_STATE  0x01
+#define SWITCH_API_GET_GESTURE       0x02
+
+#define SWITCH_E_PARAM_SWITCH        0x0A
+#define SWITCH_E_PARAM_POINTER       0x0B
+#define SWITCH_E_PARAM_ROW           0x0C
+#define SWITCH_E_PARAM_GESTURE       0x0D
+
 typedef struct 
 {
-  u8 pin;
-  u32 port;
-  u32 pullState;
+  u8 pin;             /* pin of the switch, matrix: its column pin */
+  u32 port;           /* port of the switch, matrix: SWITCH_MATRIX_COLUMN_PORT */
+  u32 pullState;      /* pin: pull of the input, unused in the matrix */
+  u8 source;          /* SWITCH_SOURCE_PIN or SWITCH_SOURCE_MATRIX */
+  u8 matrixRow;       /* matrix: row of the switch, 0 is the lowest row pin */
 } switchmap_t;
 
+typedef struct
+{
+  u16 settleMs;       /* quiet time that ends a bounce burst, 0: no gestures */
+  u16 longMs;         /* held this long: SWITCH_GESTURE_LONG, 0: never long */
+  u16 doubleMs;       /* pressed again within this gap: SWITCH_GESTURE_DOUBLE, 0: never double */
+} switchgesture_t;
+
+/*
+  Switches on a row/column matrix share pins: the rows (open drain, active
+  low) are pulled low one at a time and the pressed switches of that row
+  pull their columns low, read in one access through the masked DATA
+  window. A periodic software timer (TimerWheel, in the timer interrupt)
+  reads the row driven on the previous tick and drives the next, so a full
+  scan takes SWITCH_MATRIX_ROW_NUM ticks and the same time however many
+  switches are fitted. Without diodes, three pressed switches on the corners
+  of a rectangle make the fourth corner read pressed; a scan where two rows
+  share two pressed columns is ambiguous and those rows keep their previous
+  state until the rectangle is gone. Switch_GetSwitchState returns the
+  result of the last full scan.
+
+  Gestures are recognised from edges instead of by polling. A pin switch
+  with gestures interrupts on both edges of its pin, a matrix switch when a
+  scan finds it changed; either way the edge is stamped with the timer wheel
+  time and restarts the settle timer of the switch, nothing else. When the
+  switch has been quiet for settleMs its level is read and, if it changed, a
+  state machine takes the press or release at the time of the first edge
+  of the burst:
+
+    press, release before longMs, no press within doubleMs: SHORT
+    press, release before longMs, press within doubleMs:    DOUBLE
+    press held for longMs:                                  LONG
+
+  The long and double timers only run while a gesture is undecided, so an
+  idle switch costs nothing. Events queue up in a small ring read by
+  Switch_GetGesture; the state machine runs in the timer interrupt.
+*/
+
 /* 
   Description: This function shall initiate the specified switch num by setting its
-  pin, port, mode and configuration in a GPIO object and passing it to GPIO module
+  pin, port, mode and configuration in a GPIO object and passing it to GPIO module,
+  the first matrix switch starts the matrix scan, a switch with a settle time
+  starts its gesture recognition
   
   Input: switchNum which holds the index of the switch in the switch array 
   
@@ -46,3 +106,39 @@ extern errStat Switch_GetSwitchState(u8 switchNum, switchState* switchValue);
 
  */
 extern switchmap_t * getSwitchMap (u8 switchNum);
+
+/* 
+  Description: This function shall take the oldest gesture event out of the
+  gesture ring
+  
+  Input: 
+        1- switchNum receives the index of the switch in the switch array 
+        2- gesture receives SWITCH_GESTURE_SHORT, _LONG or _DOUBLE
+        
+  Output: errStat, ERR_STAT_NOK when no gesture is waiting
+
+ */
+extern errStat Switch_GetGesture(u8* switchNum, u8* gesture);
+
+/* 
+  Description: This function shall return the gesture thresholds of a switch
+  
+  Input: switchNum which holds the index of the switch in the switch array 
+  
+  Output: Address of the gesture struct of the switchNum 
+
+ */
+extern const switchgesture_t * getSwitchGesture (u8 switchNum);
+
+#ifdef HOST_BUILD
+/* 
+  Description: This function shall replace the switch table for the calling thread,
+  used by host simulations of several vehicle variants
+  
+  Input: table an array of SWITCH_NUM elements, 0 to go back to switchMap
+  
+  Output: void
+
+ */
+extern void setSwitchMap (const switchmap_t * table);
+#endif
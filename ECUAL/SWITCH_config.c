@@ -9,10 +9,25 @@
   Creating an array of switch struct that holds switches in the system
 */
 const switchmap_t switchMap [SWITCH_NUM] = {
-  {SWITCH_LEFTDOOR_PIN,SWITCH_LEFTDOOR_PORT,SWITCH_LEFTDOOR_PULL_STATE},
-  {SWITCH_RIGHTDOOR_PIN,SWITCH_RIGHTDOOR_PORT,SWITCH_RIGHTDOOR_PULL_STATE}
+  {SWITCH_LEFTDOOR_PIN,SWITCH_LEFTDOOR_PORT,SWITCH_LEFTDOOR_PULL_STATE,SWITCH_LEFTDOOR_SOURCE,SWITCH_LEFTDOOR_ROW},
+  {SWITCH_RIGHTDOOR_PIN,SWITCH_RIGHTDOOR_PORT,SWITCH_RIGHTDOOR_PULL_STATE,SWITCH_RIGHTDOOR_SOURCE,SWITCH_RIGHTDOOR_ROW},
+  {SWITCH_CABIN_PIN,SWITCH_CABIN_PORT,SWITCH_CABIN_PULL_STATE,SWITCH_CABIN_SOURCE,SWITCH_CABIN_ROW}
 };
 
+/*
+  Gesture thresholds of the switches, in the order of switchMap
+*/
+const switchgesture_t switchGesture [SWITCH_NUM] = {
+  {SWITCH_LEFTDOOR_SETTLE_MS,SWITCH_LEFTDOOR_LONG_MS,SWITCH_LEFTDOOR_DOUBLE_MS},
+  {SWITCH_RIGHTDOOR_SETTLE_MS,SWITCH_RIGHTDOOR_LONG_MS,SWITCH_RIGHTDOOR_DOUBLE_MS},
+  {SWITCH_CABIN_SETTLE_MS,SWITCH_CABIN_LONG_MS,SWITCH_CABIN_DOUBLE_MS}
+};
+
+#ifdef HOST_BUILD
+/* Table in use, host simulations can give every ECU its own (HOST/fleet_sim.c) */
+static ECU_STATE const switchmap_t * switchMapActive = switchMap;
+#endif
+
 
 /* 
   Description: This function shall return an element of switch from switchMap array
@@ -24,5 +39,38 @@ const switchmap_t switchMap [SWITCH_NUM] = {
  */
 extern switchmap_t * getSwitchMap (u8 switchNum)
 {
+#ifdef HOST_BUILD
+  return &switchMapActive[switchNum];
+#else
   return &switchMap[switchNum];
+#endif
+}
+
+#ifdef HOST_BUILD
+/* 
+  Description: This function shall replace the switch table for the calling thread,
+  used by host simulations of several vehicle variants
+  
+  Input: table an array of SWITCH_NUM elements, 0 to go back to switchMap
+  
+  Output: void
+
+ */
+extern void setSwitchMap (const switchmap_t * table)
+{
+  switchMapActive = (table != 0) ? table : switchMap;
+}
+#endif
+
+/* 
+  Description: This function shall return an element of switchGesture array
+  
+  Input: switchNum which holds the index of the switch in the switch array 
+  
+  Output: Address of the gesture struct of the switchNum 
+
+ */
+extern const switchgesture_t * getSwitchGesture (u8 switchNum)
+{
+  return &switchGesture[switchNum];
 }
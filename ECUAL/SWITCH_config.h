@@ -1,12 +1,73 @@
-#define SWITCH_NUM                   2
+#define SWITCH_NUM                   3
 
 #define SWITCH_LEFTDOOR                 0
 #define SWITCH_LEFTDOOR_PIN             GPIO_PIN_4
 #define SWITCH_LEFTDOOR_PORT            GPIO_PORTF_BASE
 #define SWITCH_LEFTDOOR_PULL_STATE      GPIO_PIN_TYPE_STD_WPU
+#define SWITCH_LEFTDOOR_SOURCE          SWITCH_SOURCE_PIN
+#define SWITCH_LEFTDOOR_ROW             0
+#define SWITCH_LEFTDOOR_SETTLE_MS       0
+#define SWITCH_LEFTDOOR_LONG_MS         800
+#define SWITCH_LEFTDOOR_DOUBLE_MS       300
 
 
 #define SWITCH_RIGHTDOOR              1
 #define SWITCH_RIGHTDOOR_PIN          GPIO_PIN_1
 #define SWITCH_RIGHTDOOR_PORT         GPIO_PORTF_BASE
 #define SWITCH_RIGHTDOOR_PULL_STATE   GPIO_PIN_TYPE_STD_WPU
+#define SWITCH_RIGHTDOOR_SOURCE       SWITCH_SOURCE_PIN
+#define SWITCH_RIGHTDOOR_ROW          0
+#define SWITCH_RIGHTDOOR_SETTLE_MS    0
+#define SWITCH_RIGHTDOOR_LONG_MS      800
+#define SWITCH_RIGHTDOOR_DOUBLE_MS    300
+
+/* Cabin lamp push button, closes to ground */
+#define SWITCH_CABIN                  2
+#define SWITCH_CABIN_PIN              GPIO_PIN_3
+#define SWITCH_CABIN_PORT             GPIO_PORTF_BASE
+#define SWITCH_CABIN_PULL_STATE       GPIO_PIN_TYPE_STD_WPU
+#define SWITCH_CABIN_SOURCE           SWITCH_SOURCE_PIN
+#define SWITCH_CABIN_ROW              0
+#define SWITCH_CABIN_SETTLE_MS        20
+#define SWITCH_CABIN_LONG_MS          800
+#define SWITCH_CABIN_DOUBLE_MS        300
+
+/*
+  Gestures: a door switch stays pressed as long as its door is shut, so the
+  door switches come without gestures (settle time 0). A push button like
+  the cabin button gets about 20 ms of settle time; the long and double
+  thresholds count from the first edge of the press or release.
+*/
+
+/* Pin edge interrupts of gesture switches, below the timer wheel */
+#define SWITCH_GESTURE_INT_PRIORITY     4
+
+/* Gesture events waiting for Switch_GetGesture, a power of two */
+#define SWITCH_GESTURE_RING_SIZE        8
+
+#if (SWITCH_GESTURE_RING_SIZE & (SWITCH_GESTURE_RING_SIZE - 1)) != 0
+#error "SWITCH_GESTURE_RING_SIZE must be a power of two"
+#endif
+
+/*
+  Switch matrix: rows PB0-PB3 driven open drain, columns PE0-PE3 read with
+  weak pull-ups, up to 16 switches. Rows are numbered from the lowest pin.
+*/
+#define SWITCH_MATRIX_ROW_NUM           4
+#define SWITCH_MATRIX_ROW_SYSCTL        SYSCTL_GPIO_B
+#define SWITCH_MATRIX_ROW_PORT          GPIO_PORTB_BASE
+#define SWITCH_MATRIX_ROW_PINS          (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+#define SWITCH_MATRIX_COLUMN_SYSCTL     SYSCTL_GPIO_E
+#define SWITCH_MATRIX_COLUMN_PORT       GPIO_PORTE_BASE
+#define SWITCH_MATRIX_COLUMN_PINS       (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+
+/* Timer wheel ticks each row is driven before its columns are read */
+#define SWITCH_MATRIX_ROW_TICKS         1
+
+#if (SWITCH_MATRIX_ROW_NUM == 0) || (SWITCH_MATRIX_ROW_NUM > 8) || \
+    ((((SWITCH_MATRIX_ROW_PINS) >> 0) & 1) + (((SWITCH_MATRIX_ROW_PINS) >> 1) & 1) + \
+     (((SWITCH_MATRIX_ROW_PINS) >> 2) & 1) + (((SWITCH_MATRIX_ROW_PINS) >> 3) & 1) + \
+     (((SWITCH_MATRIX_ROW_PINS) >> 4) & 1) + (((SWITCH_MATRIX_ROW_PINS) >> 5) & 1) + \
+     (((SWITCH_MATRIX_ROW_PINS) >> 6) & 1) + (((SWITCH_MATRIX_ROW_PINS) >> 7) & 1)) != SWITCH_MATRIX_ROW_NUM
+#error "SWITCH_MATRIX_ROW_PINS must hold SWITCH_MATRIX_ROW_NUM pins, at most 8"
+#endif
@@ -0,0 +1,135 @@
+/*
+  Multi-node scenario on the simulated CAN bus: the ECU runs the unmodified
+  Door module with both doors remote, two door modules send their states,
+  virtual time advances through the DWT cycle counter register. The door
+  states diagnostic identifier is read along, as a service tool would.
+
+  Build:
+    cc -DHOST_BUILD -DDOOR_LEFT_SOURCE=DOOR_SOURCE_REMOTE -DDOOR_RIGHT_SOURCE=DOOR_SOURCE_REMOTE \
+       -ILIB -IMCAL -IECUAL -IAPP -IRTE -ISERVICES -IHOST -o can_door_sim HOST/can_door_sim.c \
+       HOST/can_sim.c HOST/hw_sim.c HOST/eeprom_sim.c \
+       $(find APP RTE ECUAL LIB SERVICES -name '*.c') \
+       MCAL/gpio.c MCAL/sysctl.c MCAL/nvic.c MCAL/uart.c MCAL/gpt.c MCAL/udma.c MCAL/ssi.c MCAL/dwt.c
+  Run: ./can_door_sim, exits with 1 if a step does not give the expected state.
+*/
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "can.h"
+#include "dwt.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "Telemetry.h"
+#include "Diag.h"
+#include "Diag_config.h"
+#include "hw_sim.h"
+#include "can_sim.h"
+
+#define SIM_CYCLES_PER_MS  (SYSCTL_MAIN_OSCILLATOR_HZ / 1000)
+
+static u8 ecuNode, leftNode, rightNode;
+static int failures;
+
+static void setTimeMs(u32 ms)
+{
+  HWREG(DWT_CYCCNT) = ms * SIM_CYCLES_PER_MS;
+}
+
+/* A door module puts its state on the bus */
+static void doorSend(u8 node, u16 id, u8 state)
+{
+  canMessage_t msg = {0};
+
+  msg.id = id;
+  msg.len = 1;
+  msg.data[0] = state;
+  CanSim_NodeSelect(node);
+  CAN_MessageSend(CAN0_BASE, DOOR_CAN_TX_OBJ, &msg);
+  CanSim_NodeSelect(ecuNode);
+}
+
+static void expect(u32 ms, const char* step, u8 doorNum, u8 state, errStat status)
+{
+  u8 gotState;
+  errStat gotStatus = Door_GetStatus(doorNum, &gotState);
+  int ok = (gotState == state) && (gotStatus == status);
+
+  printf("%5lu ms  %-40s door %u: %-6s %-4s %s\n", (unsigned long)ms, step, doorNum,
+         (gotState == DOOR_OPENED) ? "OPENED" : "CLOSED",
+         (gotStatus == ERR_STAT_OK) ? "ok" : "lost", ok ? "" : "  <-- unexpected");
+  failures += !ok;
+}
+
+/* The door states identifier answers with the states the lamp logic acts on */
+static void expectDid(u32 ms, const char* step, u8 left, u8 right)
+{
+  u8 data[DIAG_DATA_MAX] = {0xFF, 0xFF};
+  const diagDid_t * didElement = 0;
+  errStat status = ERR_STAT_NOK;
+  u8 i;
+  int ok;
+
+  for (i = 0; i < DIAG_DID_NUM; i++)
+  {
+    if (getDiagDid(i)->did == DIAG_DID_DOOR_STATES)
+    {
+      didElement = getDiagDid(i);
+    }
+  }
+  if ((didElement != 0) && (didElement->length == DOOR_NUM))
+  {
+    status = didElement->getData(data);
+  }
+  ok = (status == ERR_STAT_OK) && (data[DOOR_LEFT] == left) && (data[DOOR_RIGHT] == right);
+  printf("%5lu ms  %-40s DID 0x%04X: %02X %02X%s\n", (unsigned long)ms, step, DIAG_DID_DOOR_STATES,
+         data[DOOR_LEFT], data[DOOR_RIGHT], ok ? "" : "  <-- unexpected");
+  failures += !ok;
+}
+
+int main(void)
+{
+  HwSim_Reset();
+  CanSim_Reset();
+  setTimeMs(0);
+
+  leftNode = CanSim_NodeCreate();
+  rightNode = CanSim_NodeCreate();
+  ecuNode = CanSim_NodeCreate();
+
+  Door_Init(DOOR_LEFT);
+  Door_Init(DOOR_RIGHT);
+
+  expect(0, "no frame received yet", DOOR_LEFT, DOOR_LEFT_TIMEOUT_STATE, ERR_STAT_NOK);
+
+  doorSend(leftNode, DOOR_LEFT_CAN_ID, DOOR_OPENED);
+  expect(0, "left module reports opened", DOOR_LEFT, DOOR_OPENED, ERR_STAT_OK);
+
+  setTimeMs(50);
+  doorSend(rightNode, DOOR_RIGHT_CAN_ID, DOOR_CLOSED);
+  expect(50, "right module reports closed", DOOR_RIGHT, DOOR_CLOSED, ERR_STAT_OK);
+  expect(50, "left still within its timeout", DOOR_LEFT, DOOR_OPENED, ERR_STAT_OK);
+  expectDid(50, "diagnostics read the received states", DOOR_OPENED, DOOR_CLOSED);
+
+  doorSend(rightNode, DOOR_RIGHT_CAN_ID + 1, DOOR_OPENED);
+  expect(50, "foreign id rejected by the filter", DOOR_RIGHT, DOOR_CLOSED, ERR_STAT_OK);
+
+  setTimeMs(150);
+  expect(150, "left silent for 150 ms", DOOR_LEFT, DOOR_LEFT_TIMEOUT_STATE, ERR_STAT_NOK);
+  expect(150, "right silent for 100 ms", DOOR_RIGHT, DOOR_CLOSED, ERR_STAT_OK);
+  expectDid(150, "diagnostics read the timeout state", DOOR_LEFT_TIMEOUT_STATE, DOOR_CLOSED);
+
+  doorSend(leftNode, DOOR_LEFT_CAN_ID, DOOR_OPENED);
+  expect(150, "left module back", DOOR_LEFT, DOOR_OPENED, ERR_STAT_OK);
+
+  CanSim_NodeConnect(rightNode, 0);
+  setTimeMs(200);
+  doorSend(rightNode, DOOR_RIGHT_CAN_ID, DOOR_OPENED);
+  expect(200, "right module disconnected", DOOR_RIGHT, DOOR_RIGHT_TIMEOUT_STATE, ERR_STAT_NOK);
+
+  printf("%lu frames on the bus, %d unexpected\n", (unsigned long)CanSim_FrameCount(), failures);
+  return failures ? 1 : 0;
+}
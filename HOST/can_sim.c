@@ -0,0 +1,244 @@
+#include "STD_TYPES.h"
+#include "can.h"
+#include "can_sim.h"
+
+#define CANSIM_OBJ_FREE   0
+#define CANSIM_OBJ_RX     1
+#define CANSIM_OBJ_TX     2
+
+typedef struct
+{
+  u8 mode;
+  u16 id;
+  u16 mask;
+  u8 newData;
+  canMessage_t msg;
+} canSimObj_t;
+
+typedef struct
+{
+  u8 used;
+  u8 connected;
+  canSimObj_t obj[CAN_OBJ_NUM + 1];
+  void (*rxHandler)(u8 ui8ObjNum);
+} canSimNode_t;
+
+static ECU_STATE canSimNode_t canSimNodes[CANSIM_NODE_MAX];
+static ECU_STATE u8 canSimCurrent;
+static ECU_STATE u32 canSimFrames;
+
+
+/* 
+  Description: This function shall add a node to the bus and select it
+  
+  Input: void
+  
+  Output: node number, or CANSIM_NODE_MAX if the bus is full
+
+ */
+extern u8 CanSim_NodeCreate(void)
+{
+  canSimNode_t blank = {0};
+  u8 node;
+  
+  for (node = 0; node < CANSIM_NODE_MAX; node++)
+  {
+    if (!canSimNodes[node].used)
+    {
+      canSimNodes[node] = blank;
+      canSimNodes[node].used = 1;
+      canSimNodes[node].connected = 1;
+      canSimCurrent = node;
+      return node;
+    }
+  }
+  return CANSIM_NODE_MAX;
+}
+
+/* 
+  Description: This function shall select the node the CAN_xxx calls act on
+  
+  Input: node the node number
+  
+  Output: errStat
+
+ */
+extern errStat CanSim_NodeSelect(u8 node)
+{
+  if ((node >= CANSIM_NODE_MAX) || !canSimNodes[node].used)
+  {
+    return ERR_STAT_NOK;
+  }
+  canSimCurrent = node;
+  return ERR_STAT_OK;
+}
+
+/* 
+  Description: This function shall connect or disconnect a node, a disconnected
+  node neither sends nor receives frames
+  
+  Input: 
+        1- node the node number
+        2- connected 1 to connect and 0 to disconnect
+        
+  Output: errStat
+
+ */
+extern errStat CanSim_NodeConnect(u8 node, u8 connected)
+{
+  if ((node >= CANSIM_NODE_MAX) || !canSimNodes[node].used)
+  {
+    return ERR_STAT_NOK;
+  }
+  canSimNodes[node].connected = connected;
+  return ERR_STAT_OK;
+}
+
+/* 
+  Description: This function shall return the number of frames sent on the bus
+  
+  Input: void
+  
+  Output: frame count
+
+ */
+extern u32 CanSim_FrameCount(void)
+{
+  return canSimFrames;
+}
+
+/* 
+  Description: This function shall remove every node from the bus
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void CanSim_Reset(void)
+{
+  u8 node;
+  
+  for (node = 0; node < CANSIM_NODE_MAX; node++)
+  {
+    canSimNodes[node].used = 0;
+  }
+  canSimCurrent = 0;
+  canSimFrames = 0;
+}
+
+/*
+  CAN_xxx API of can.h acting on the selected node.
+*/
+
+errStat CAN_Init(u32 ui32Base, u32 ui32CANClk, u32 ui32BitRate)
+{
+  u8 obj;
+  
+  (void)ui32Base;
+  (void)ui32CANClk;
+  (void)ui32BitRate;
+  for (obj = 0; obj <= CAN_OBJ_NUM; obj++)
+  {
+    canSimNodes[canSimCurrent].obj[obj].mode = CANSIM_OBJ_FREE;
+    canSimNodes[canSimCurrent].obj[obj].newData = 0;
+  }
+  return ERR_STAT_OK;
+}
+
+errStat CAN_RxObjectSet(u32 ui32Base, u8 ui8ObjNum, u16 ui16Id, u16 ui16Mask)
+{
+  canSimObj_t * objElement;
+  
+  (void)ui32Base;
+  if ((ui8ObjNum == 0) || (ui8ObjNum > CAN_OBJ_NUM))
+  {
+    return ERR_STAT_NOK;
+  }
+  objElement = &canSimNodes[canSimCurrent].obj[ui8ObjNum];
+  objElement->mode = CANSIM_OBJ_RX;
+  objElement->id = ui16Id;
+  objElement->mask = ui16Mask;
+  objElement->newData = 0;
+  return ERR_STAT_OK;
+}
+
+errStat CAN_MessageSend(u32 ui32Base, u8 ui8ObjNum, const canMessage_t* psMsg)
+{
+  canSimObj_t * objElement;
+  u8 sender = canSimCurrent;
+  u8 node;
+  u8 obj;
+  
+  (void)ui32Base;
+  if ((ui8ObjNum == 0) || (ui8ObjNum > CAN_OBJ_NUM) || (psMsg == 0) || (psMsg->len > 8))
+  {
+    return ERR_STAT_NOK;
+  }
+  canSimNodes[sender].obj[ui8ObjNum].mode = CANSIM_OBJ_TX;
+  
+  /* A disconnected node transmits into the void */
+  if (!canSimNodes[sender].connected)
+  {
+    return ERR_STAT_OK;
+  }
+  canSimFrames++;
+  
+  for (node = 0; node < CANSIM_NODE_MAX; node++)
+  {
+    if ((node == sender) || !canSimNodes[node].used || !canSimNodes[node].connected)
+    {
+      continue;
+    }
+    for (obj = 1; obj <= CAN_OBJ_NUM; obj++)
+    {
+      objElement = &canSimNodes[node].obj[obj];
+      if ((objElement->mode == CANSIM_OBJ_RX) &&
+          (((psMsg->id ^ objElement->id) & objElement->mask) == 0))
+      {
+        objElement->msg = *psMsg;
+        objElement->newData = 1;
+        
+        /* The receiving node takes its interrupt */
+        if (canSimNodes[node].rxHandler != 0)
+        {
+          canSimCurrent = node;
+          canSimNodes[node].rxHandler(obj);
+          canSimCurrent = sender;
+        }
+        break;
+      }
+    }
+  }
+  return ERR_STAT_OK;
+}
+
+errStat CAN_MessageGet(u32 ui32Base, u8 ui8ObjNum, canMessage_t* psMsg)
+{
+  canSimObj_t * objElement;
+  
+  (void)ui32Base;
+  if ((ui8ObjNum == 0) || (ui8ObjNum > CAN_OBJ_NUM) || (psMsg == 0))
+  {
+    return ERR_STAT_NOK;
+  }
+  objElement = &canSimNodes[canSimCurrent].obj[ui8ObjNum];
+  if (!objElement->newData)
+  {
+    return ERR_STAT_NOK;
+  }
+  *psMsg = objElement->msg;
+  objElement->newData = 0;
+  return ERR_STAT_OK;
+}
+
+errStat CAN_IntRegister(u32 ui32Base, void (*pfnHandler)(u8 ui8ObjNum))
+{
+  (void)ui32Base;
+  canSimNodes[canSimCurrent].rxHandler = pfnHandler;
+  return ERR_STAT_OK;
+}
+
+void CAN0_Handler(void)
+{
+}
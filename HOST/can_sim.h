@@ -0,0 +1,74 @@
+#ifndef CAN_SIM_H
+#define CAN_SIM_H
+
+/*
+  In-process simulated CAN bus for the host build.
+
+  HOST/can_sim.c replaces MCAL/can.c: it implements the CAN_xxx API of
+  can.h on top of a bus shared by several nodes living in one process. The
+  CAN_xxx calls act on the node selected with CanSim_NodeSelect, so the
+  firmware of one node and the stimuli of the others can run side by side.
+
+  A frame sent by a node is delivered at once to every other connected node,
+  into the lowest numbered receive object whose acceptance filter matches,
+  and the receive handler of that node runs as its CAN interrupt would.
+*/
+
+/* Nodes one bus can hold */
+#define CANSIM_NODE_MAX   16
+
+
+/* 
+  Description: This function shall add a node to the bus and select it
+  
+  Input: void
+  
+  Output: node number, or CANSIM_NODE_MAX if the bus is full
+
+ */
+extern u8 CanSim_NodeCreate(void);
+
+/* 
+  Description: This function shall select the node the CAN_xxx calls act on
+  
+  Input: node the node number
+  
+  Output: errStat
+
+ */
+extern errStat CanSim_NodeSelect(u8 node);
+
+/* 
+  Description: This function shall connect or disconnect a node, a disconnected
+  node neither sends nor receives frames
+  
+  Input: 
+        1- node the node number
+        2- connected 1 to connect and 0 to disconnect
+        
+  Output: errStat
+
+ */
+extern errStat CanSim_NodeConnect(u8 node, u8 connected);
+
+/* 
+  Description: This function shall return the number of frames sent on the bus
+  
+  Input: void
+  
+  Output: frame count
+
+ */
+extern u32 CanSim_FrameCount(void);
+
+/* 
+  Description: This function shall remove every node from the bus
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void CanSim_Reset(void);
+
+#endif
@@ -0,0 +1,72 @@
+/*
+  Host side builder of diagnostic requests.
+
+  Writes one encoded request to stdout, ready to be sent to the ECU serial
+  port; the response comes back in the telemetry stream and is printed by
+  telemetry_decode as a DIAG record.
+
+  Build: cc -ILIB -ISERVICES -o diag_request HOST/diag_request.c LIB/COBS.c LIB/CRC8.c
+  Usage: diag_request read <identifier>     e.g. diag_request read 0x0103 > /dev/ttyACM0
+         diag_request clear
+         diag_request trace <offset> [length]
+  Reading the trace out: "read 0x0106" freezes the trace and returns its
+  length, then "trace" requests of up to DIAG_DATA_MAX bytes cover it and
+  trace_replay -c rebuilds it from the captured responses; "clear" restarts it.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "COBS.h"
+#include "CRC8.h"
+#include "Telemetry.h"
+#include "Diag.h"
+
+int main(int argc, char** argv)
+{
+  u8 req[DIAG_REQUEST_MAX];
+  u8 enc[COBS_ENCODED_MAX(DIAG_REQUEST_MAX) + 1];
+  u16 len = 0;
+  u16 encLen;
+  unsigned long did;
+  unsigned long offset;
+  unsigned long length = DIAG_DATA_MAX;
+
+  if ((argc == 3) && (strcmp(argv[1], "read") == 0))
+  {
+    did = strtoul(argv[2], NULL, 0);
+    req[len++] = DIAG_SID_READ_DATA_BY_ID;
+    req[len++] = (u8)(did >> 8);
+    req[len++] = (u8)(did);
+  }
+  else if ((argc == 2) && (strcmp(argv[1], "clear") == 0))
+  {
+    req[len++] = DIAG_SID_CLEAR_DIAG_INFO;
+  }
+  else if (((argc == 3) || (argc == 4)) && (strcmp(argv[1], "trace") == 0))
+  {
+    offset = strtoul(argv[2], NULL, 0);
+    if (argc == 4)
+    {
+      length = strtoul(argv[3], NULL, 0);
+    }
+    req[len++] = DIAG_SID_READ_MEMORY_BY_ADDRESS;
+    req[len++] = (u8)(offset >> 8);
+    req[len++] = (u8)(offset);
+    req[len++] = (u8)(length);
+  }
+  else
+  {
+    fprintf(stderr, "usage: %s read <identifier> | clear | trace <offset> [length]\n", argv[0]);
+    return 1;
+  }
+  req[len] = CRC8_Update(CRC8_INIT, req, len);
+  len++;
+
+  encLen = COBS_Encode(req, len, enc);
+  enc[encLen++] = COBS_DELIMITER;
+  fwrite(enc, 1, encLen, stdout);
+
+  return 0;
+}
@@ -0,0 +1,654 @@
+/*
+  Deterministic discrete-event simulation of the door-to-lamp pipeline. The
+  unmodified application, ECUAL and MCAL sources run against the simulated
+  register space; scenarios drive the door switch pins, virtual time advances
+  through the DWT cycle counter and the timer counter, and the lamp pin is
+  watched after every main loop iteration.
+
+  Build:
+    cc -O2 -DHOST_BUILD -ILIB -IMCAL -IECUAL -IAPP -IRTE -ISERVICES -IHOST -o door_sim \
+       HOST/door_sim.c HOST/hw_sim.c HOST/can_sim.c HOST/eeprom_sim.c \
+       $(find APP RTE ECUAL LIB SERVICES -name '*.c') \
+       MCAL/gpio.c MCAL/sysctl.c MCAL/nvic.c MCAL/uart.c MCAL/gpt.c MCAL/udma.c MCAL/ssi.c MCAL/dwt.c
+  Run:
+    ./door_sim [-s seed] [-n actions] [-l loop_us] [-b bounce_us] [-r rate] [-o trace] scenario
+  Scenarios:
+    bounce   doors open and close with contact bounce
+    slam     doors slammed shut, heavy bounce and a rebound that reopens the switch
+    rapid    one door toggled at -r events per second, no bounce
+    both     both doors moving at nearly the same time
+    random   a random mix of the above
+    sweep    rapid at rising rates, reports the highest rate the logic absorbs
+    script F actions from file F, one "time_ms left|right open|closed [bounces]" per line
+  Same seed and options give the same result on every run. With -o the input
+  trace recorded by the firmware (Trace.h) is written to a file at the end,
+  ready for HOST/trace_replay.c.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "dwt.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Lamp.h"
+#include "Lamp_config.h"
+#include "can.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "TimerWheel_config.h"
+#include "Trace.h"
+#include "doorDimmer.h"
+#include "hw_sim.h"
+
+#define SIM_CYCLES_PER_US   (SYSCTL_MAIN_OSCILLATOR_HZ / 1000000)
+
+typedef unsigned long long simTime_t;
+
+/* Level change of a door switch pin */
+typedef struct
+{
+  simTime_t t;
+  u32 seq;
+  u8 door;
+  u8 state;
+} simEdge_t;
+
+/* Door movement the driver intended, the reference for the lamp */
+typedef struct
+{
+  simTime_t t;
+  u8 door;
+  u8 state;
+} simAction_t;
+
+typedef struct
+{
+  u32 actions;
+  u32 edges;
+  u32 toggles;
+  u32 expectedToggles;
+  u32 missed;
+  u32 latencyNum;
+  u32 * latency;        /* door-to-lamp latencies in us */
+  simTime_t duration;
+  double wallSeconds;
+  u32 loops;
+} simResult_t;
+
+static simEdge_t * simEdges;
+static u32 simEdgeNum, simEdgeMax;
+static simAction_t * simActions;
+static u32 simActionNum, simActionMax;
+
+static u32 simSeed = 1;
+static u32 simActionCount = 200;
+static u32 simLoopUs = 50;
+static u32 simBounceUs = 3000;
+static u32 simRate = 10;
+static const char * simTraceFile;
+
+
+/* xorshift32, so runs do not depend on the C library */
+static u32 simRand(void)
+{
+  simSeed ^= simSeed << 13;
+  simSeed ^= simSeed >> 17;
+  simSeed ^= simSeed << 5;
+  return simSeed;
+}
+
+/* Uniform value in [lo, hi] */
+static u32 simRange(u32 lo, u32 hi)
+{
+  return lo + (simRand() % (hi - lo + 1));
+}
+
+static void simEdgeAdd(simTime_t t, u8 door, u8 state)
+{
+  if (simEdgeNum == simEdgeMax)
+  {
+    simEdgeMax = simEdgeMax ? (simEdgeMax * 2) : 1024;
+    simEdges = realloc(simEdges, simEdgeMax * sizeof(simEdge_t));
+  }
+  simEdges[simEdgeNum].t = t;
+  simEdges[simEdgeNum].seq = simEdgeNum;
+  simEdges[simEdgeNum].door = door;
+  simEdges[simEdgeNum].state = state;
+  simEdgeNum++;
+}
+
+/*
+  A door reaching a state at time t (us), followed by contact bounce: short
+  pulses back to the old state spread over the bounce window.
+*/
+static void simMove(simTime_t t, u8 door, u8 state, u32 bounces, u32 windowUs)
+{
+  simTime_t edge = t * SIM_CYCLES_PER_US;
+  u32 slice;
+  u32 i;
+
+  simEdgeAdd(edge, door, state);
+  if (bounces == 0)
+  {
+    return;
+  }
+  slice = windowUs / bounces;
+  for (i = 0; i < bounces; i++)
+  {
+    edge += (simTime_t)simRange(slice / 4 + 1, slice / 2 + 1) * SIM_CYCLES_PER_US;
+    simEdgeAdd(edge, door, !state);
+    edge += (simTime_t)simRange(slice / 8 + 1, slice / 2) * SIM_CYCLES_PER_US;
+    simEdgeAdd(edge, door, state);
+  }
+}
+
+static void simAct(simTime_t t, u8 door, u8 state, u32 bounces, u32 windowUs)
+{
+  if (simActionNum == simActionMax)
+  {
+    simActionMax = simActionMax ? (simActionMax * 2) : 256;
+    simActions = realloc(simActions, simActionMax * sizeof(simAction_t));
+  }
+  simActions[simActionNum].t = t * SIM_CYCLES_PER_US;
+  simActions[simActionNum].door = door;
+  simActions[simActionNum].state = state;
+  simActionNum++;
+  simMove(t, door, state, bounces, windowUs);
+}
+
+static int simEdgeCompare(const void * a, const void * b)
+{
+  const simEdge_t * x = a;
+  const simEdge_t * y = b;
+
+  if (x->t != y->t)
+  {
+    return (x->t < y->t) ? -1 : 1;
+  }
+  return (x->seq < y->seq) ? -1 : 1;
+}
+
+static int simActionCompare(const void * a, const void * b)
+{
+  const simAction_t * x = a;
+  const simAction_t * y = b;
+
+  return (x->t < y->t) ? -1 : (x->t > y->t);
+}
+
+static int simU32Compare(const void * a, const void * b)
+{
+  u32 x = *(const u32 *)a;
+  u32 y = *(const u32 *)b;
+
+  return (x < y) ? -1 : (x > y);
+}
+
+/*
+  Scenario generators. Times are in us, every door starts closed and the
+  doors are left closed at the end.
+*/
+static simTime_t simGenBounce(simTime_t t, u8 door, u8 doorState[DOOR_NUM])
+{
+  doorState[door] = !doorState[door];
+  simAct(t, door, doorState[door], simRange(1, 6), simBounceUs);
+  return t + simRange(200000, 2000000);
+}
+
+static simTime_t simGenSlam(simTime_t t, u8 door, u8 doorState[DOOR_NUM])
+{
+  simTime_t rebound;
+
+  if (doorState[door] == DOOR_CLOSED)
+  {
+    simAct(t, door, DOOR_OPENED, simRange(0, 3), simBounceUs);
+    t += simRange(500000, 3000000);
+  }
+  /* Heavy bounce, then the door springs back and reopens the switch */
+  simAct(t, door, DOOR_CLOSED, simRange(8, 20), 5000);
+  rebound = t + simRange(10000, 40000);
+  simMove(rebound, door, DOOR_OPENED, simRange(0, 4), 2000);
+  simMove(rebound + simRange(5000, 30000), door, DOOR_CLOSED, simRange(2, 8), simBounceUs);
+  doorState[door] = DOOR_CLOSED;
+  return t + simRange(300000, 2000000);
+}
+
+static simTime_t simGenBoth(simTime_t t, u8 doorState[DOOR_NUM])
+{
+  u8 door;
+
+  for (door = 0; door < DOOR_NUM; door++)
+  {
+    doorState[door] = !doorState[door];
+    simAct(t + simRange(0, 50000), door, doorState[door], simRange(1, 6), simBounceUs);
+  }
+  return t + simRange(300000, 2000000);
+}
+
+static void simGenerate(const char * scenario, const char * script)
+{
+  u8 doorState[DOOR_NUM];
+  simTime_t t = 100000;
+  u32 i;
+  u8 door;
+
+  for (door = 0; door < DOOR_NUM; door++)
+  {
+    doorState[door] = DOOR_CLOSED;
+  }
+
+  if (strcmp(scenario, "script") == 0)
+  {
+    FILE * f = fopen(script, "r");
+    char name[16], state[16];
+    double ms;
+    unsigned bounces;
+    char line[128];
+    int fields;
+
+    if (f == NULL)
+    {
+      perror(script);
+      exit(2);
+    }
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+      if ((line[0] == '#') || (line[0] == '\n'))
+      {
+        continue;
+      }
+      bounces = 0;
+      fields = sscanf(line, "%lf %15s %15s %u", &ms, name, state, &bounces);
+      if (fields < 3)
+      {
+        fprintf(stderr, "%s: bad line: %s", script, line);
+        exit(2);
+      }
+      simAct((simTime_t)(ms * 1000), (strcmp(name, "right") == 0) ? DOOR_RIGHT : DOOR_LEFT,
+             (strcmp(state, "open") == 0) ? DOOR_OPENED : DOOR_CLOSED, bounces, simBounceUs);
+    }
+    fclose(f);
+    return;
+  }
+
+  for (i = 0; i < simActionCount; i++)
+  {
+    const char * kind = scenario;
+    static const char * const kinds[] = {"bounce", "slam", "rapid", "both"};
+
+    if (strcmp(scenario, "random") == 0)
+    {
+      kind = kinds[simRange(0, 3)];
+    }
+    door = simRange(0, DOOR_NUM - 1);
+
+    if (strcmp(kind, "bounce") == 0)
+    {
+      t = simGenBounce(t, door, doorState);
+    }
+    else if (strcmp(kind, "slam") == 0)
+    {
+      t = simGenSlam(t, door, doorState);
+    }
+    else if (strcmp(kind, "rapid") == 0)
+    {
+      /* Jitter keeps the edges from lining up with the loop */
+      doorState[DOOR_LEFT] = !doorState[DOOR_LEFT];
+      simAct(t + simRange(0, simLoopUs - 1), DOOR_LEFT, doorState[DOOR_LEFT], 0, 0);
+      t += 1000000 / simRate;
+    }
+    else if (strcmp(kind, "both") == 0)
+    {
+      t = simGenBoth(t, doorState);
+    }
+    else
+    {
+      fprintf(stderr, "unknown scenario %s\n", scenario);
+      exit(2);
+    }
+  }
+
+  for (door = 0; door < DOOR_NUM; door++)
+  {
+    if (doorState[door] != DOOR_CLOSED)
+    {
+      simAct(t, door, DOOR_CLOSED, 0, 0);
+    }
+  }
+}
+
+/* Pin level of a door switch in a state, following the pull of its switch */
+static void simDrive(u8 door, u8 state)
+{
+  switchmap_t * switchMapElement = getSwitchMap(getDoorMap(door)->switchNum);
+  u8 pressed = (state == DOOR_CLOSED);
+
+  if (GPIO_PIN_TYPE_STD_WPU == switchMapElement->pullState)
+  {
+    pressed = !pressed;
+  }
+  HwSim_PinDrive(switchMapElement->port, switchMapElement->pin, pressed);
+}
+
+/* Lamp state the switch pins call for */
+static u8 simPinLamp(const u8 * pinState)
+{
+  return ((pinState[DOOR_LEFT] == DOOR_OPENED) || (pinState[DOOR_RIGHT] == DOOR_OPENED)) ? LAMP_ON : LAMP_OFF;
+}
+
+static u8 simLampLevel(void)
+{
+  lampmap_t * lampMapElement = getLampMap(Lamp_DIMMER);
+
+  return ((HwSim_PinGet(lampMapElement->port) & lampMapElement->pin) ==
+          (lampMapElement->ON & lampMapElement->pin)) ? LAMP_ON : LAMP_OFF;
+}
+
+/*
+  The timer match interrupt fires when the counter passes the match value, or
+  when the timer wheel pended it for a match already in the past
+*/
+static void simTimerUpdate(u32 previous, u32 now)
+{
+  u32 match;
+
+  HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAV) = now;
+  if (HWREG(NVIC_PEND0) & (1UL << NVIC_INT_TIMER0A))
+  {
+    HWREG(NVIC_PEND0) &= ~(1UL << NVIC_INT_TIMER0A);
+    TIMER0A_Handler();
+  }
+  if ((HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_IMR) & TIMER_INT_TAM) == 0)
+  {
+    return;
+  }
+  match = HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAMATCHR);
+  if ((u32)(match - previous - 1) < (u32)(now - previous))
+  {
+    HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_MIS) = TIMER_INT_TAM;
+    /* Vector of Timer 0A, the timer of TIMERWHEEL_GPT_BASE */
+    TIMER0A_Handler();
+  }
+}
+
+/*
+  Runs the generated scenario. The main loop runs every loop period; edges
+  between two iterations are applied before the next one, like a polled input.
+*/
+static void simRun(simResult_t * result)
+{
+  simTime_t loopCycles = (simTime_t)simLoopUs * SIM_CYCLES_PER_US;
+  simTime_t t = 0;
+  simTime_t end;
+  simTime_t pendingSince = 0;
+  u32 edge = 0;
+  u32 action = 0;
+  u8 doorState[DOOR_NUM];     /* intended door states, the lamp reference */
+  u8 pinState[DOOR_NUM];      /* door states the switch pins show */
+  u8 expected = LAMP_OFF;
+  u8 pending = 0;             /* the lamp has not reached expected yet */
+  u8 measuring = 0;           /* the pins call for expected since pendingSince */
+  u8 lamp;
+  u8 lastLamp;
+  u8 door;
+  clock_t start;
+
+  qsort(simEdges, simEdgeNum, sizeof(simEdge_t), simEdgeCompare);
+  qsort(simActions, simActionNum, sizeof(simAction_t), simActionCompare);
+  end = (simEdgeNum ? simEdges[simEdgeNum - 1].t : 0) + (simTime_t)SYSCTL_MAIN_OSCILLATOR_HZ;
+
+  memset(result, 0, sizeof(*result));
+  result->actions = simActionNum;
+  result->edges = simEdgeNum;
+  result->latency = malloc((simActionNum + 1) * sizeof(u32));
+
+  HwSim_Reset();
+  for (door = 0; door < DOOR_NUM; door++)
+  {
+    doorState[door] = DOOR_CLOSED;
+    pinState[door] = DOOR_CLOSED;
+    simDrive(door, DOOR_CLOSED);
+  }
+  DoorDimmer_Init();
+  DoorDimmer_Schedule();
+  lastLamp = simLampLevel();
+
+  start = clock();
+  for (t = 0; t <= end; t += loopCycles)
+  {
+    /* Reference lamp state from the intended door movements */
+    while ((action < simActionNum) && (simActions[action].t <= t))
+    {
+      u8 before = expected;
+
+      doorState[simActions[action].door] = simActions[action].state;
+      expected = LAMP_OFF;
+      for (door = 0; door < DOOR_NUM; door++)
+      {
+        if (doorState[door] == DOOR_OPENED)
+        {
+          expected = LAMP_ON;
+        }
+      }
+      if (expected != before)
+      {
+        result->expectedToggles++;
+        /* The lamp never followed the previous change */
+        if (pending)
+        {
+          result->missed++;
+        }
+        pending = (expected != lastLamp);
+        /*
+          The latency counts from the edge that makes the pins call for the
+          new lamp state: edges still bouncing or rebounding can hold it
+          back, that is no firmware delay.
+        */
+        measuring = (simPinLamp(pinState) == expected);
+        pendingSince = simActions[action].t;
+      }
+      action++;
+    }
+
+    while ((edge < simEdgeNum) && (simEdges[edge].t <= t))
+    {
+      simDrive(simEdges[edge].door, simEdges[edge].state);
+      pinState[simEdges[edge].door] = simEdges[edge].state;
+      if (pending && (measuring != (simPinLamp(pinState) == expected)))
+      {
+        measuring = !measuring;
+        pendingSince = simEdges[edge].t;
+      }
+      edge++;
+    }
+
+    simTimerUpdate((u32)(t - loopCycles), (u32)t);
+    HWREG(DWT_CYCCNT) = (u32)t;
+    DoorDimmer_Schedule();
+    result->loops++;
+
+    lamp = simLampLevel();
+    if (lamp != lastLamp)
+    {
+      result->toggles++;
+      lastLamp = lamp;
+      if (pending && (lamp == expected))
+      {
+        /* Not measuring: the lamp caught a bounce the pins already left */
+        if (measuring)
+        {
+          result->latency[result->latencyNum++] = (u32)((t - pendingSince) / SIM_CYCLES_PER_US);
+        }
+        pending = 0;
+      }
+    }
+  }
+  if (pending)
+  {
+    result->missed++;
+  }
+
+  result->wallSeconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  result->duration = end;
+  qsort(result->latency, result->latencyNum, sizeof(u32), simU32Compare);
+}
+
+static u32 simPercentile(const simResult_t * result, u32 percent)
+{
+  if (result->latencyNum == 0)
+  {
+    return 0;
+  }
+  return result->latency[((result->latencyNum - 1) * percent) / 100];
+}
+
+static void simReport(const char * scenario, const simResult_t * result)
+{
+  double seconds = (double)result->duration / SYSCTL_MAIN_OSCILLATOR_HZ;
+  double sum = 0;
+  u32 i;
+
+  for (i = 0; i < result->latencyNum; i++)
+  {
+    sum += result->latency[i];
+  }
+
+  printf("scenario %s, seed %lu, loop %lu us: %lu door actions, %lu pin edges, %.1f s simulated\n",
+         scenario, (unsigned long)simSeed, (unsigned long)simLoopUs, (unsigned long)result->actions,
+         (unsigned long)result->edges, seconds);
+  printf("lamp toggles: %lu, expected %lu, extra %lu\n", (unsigned long)result->toggles,
+         (unsigned long)result->expectedToggles,
+         (unsigned long)((result->toggles > result->expectedToggles) ? (result->toggles - result->expectedToggles) : 0));
+  printf("door-to-lamp latency [us]: n=%lu min %lu p50 %lu p90 %lu p99 %lu max %lu mean %.1f\n",
+         (unsigned long)result->latencyNum,
+         (unsigned long)simPercentile(result, 0), (unsigned long)simPercentile(result, 50),
+         (unsigned long)simPercentile(result, 90), (unsigned long)simPercentile(result, 99),
+         (unsigned long)simPercentile(result, 100), result->latencyNum ? (sum / result->latencyNum) : 0.0);
+  printf("lamp changes missed: %lu\n", (unsigned long)result->missed);
+  if (result->wallSeconds > 0)
+  {
+    printf("host: %.0f loops/s, %.0f pin edges/s, %.1fx real time\n",
+           result->loops / result->wallSeconds, result->edges / result->wallSeconds,
+           seconds / result->wallSeconds);
+  }
+}
+
+/* Writes the input trace the firmware recorded during the run */
+static int simTraceWrite(const char * file)
+{
+  traceInfo_t info;
+  u8 * data;
+  FILE * out;
+
+  Trace_Freeze();
+  Trace_GetInfo(&info);
+  data = malloc(info.length + 1);
+  Trace_Read(0, data, info.length);
+  if (((out = fopen(file, "wb")) == NULL) || (fwrite(data, 1, info.length, out) != info.length))
+  {
+    perror(file);
+    free(data);
+    return 1;
+  }
+  fclose(out);
+  free(data);
+  printf("trace: %lu bytes, %lu oldest records dropped, written to %s\n",
+         (unsigned long)info.length, (unsigned long)info.dropped, file);
+  return 0;
+}
+
+/* Rapid toggling at rising rates until the lamp stops following */
+static int simSweep(void)
+{
+  static const u32 rates[] = {10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000};
+  simResult_t result;
+  u32 absorbed = 0;
+  u32 i;
+
+  printf("rate [events/s]  events  missed  extra toggles  p99 latency [us]\n");
+  for (i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+  {
+    simEdgeNum = 0;
+    simActionNum = 0;
+    simRate = rates[i];
+    simGenerate("rapid", NULL);
+    simRun(&result);
+    printf("%16lu  %6lu  %6lu  %13lu  %16lu\n", (unsigned long)rates[i], (unsigned long)result.actions,
+           (unsigned long)result.missed,
+           (unsigned long)((result.toggles > result.expectedToggles) ? (result.toggles - result.expectedToggles) : 0),
+           (unsigned long)simPercentile(&result, 99));
+    if ((result.missed == 0) && (result.toggles == result.expectedToggles))
+    {
+      absorbed = rates[i];
+    }
+    free(result.latency);
+  }
+  printf("sustained throughput: %lu door events/s with a %lu us loop\n",
+         (unsigned long)absorbed, (unsigned long)simLoopUs);
+  return 0;
+}
+
+int main(int argc, char * argv[])
+{
+  simResult_t result;
+  const char * scenario = NULL;
+  const char * script = NULL;
+  u32 seed;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if ((argv[i][0] == '-') && (i + 1 < argc))
+    {
+      u32 value = (u32)strtoul(argv[i + 1], NULL, 0);
+
+      switch (argv[i][1])
+      {
+        case 'o': simTraceFile = argv[i + 1]; break;
+        case 's': simSeed = value ? value : 1; break;
+        case 'n': simActionCount = value; break;
+        case 'l': simLoopUs = value ? value : 1; break;
+        case 'b': simBounceUs = value; break;
+        case 'r': simRate = value ? value : 1; break;
+        default:
+          fprintf(stderr, "unknown option %s\n", argv[i]);
+          return 2;
+      }
+      i++;
+    }
+    else if (scenario == NULL)
+    {
+      scenario = argv[i];
+    }
+    else
+    {
+      script = argv[i];
+    }
+  }
+  if ((scenario == NULL) || ((strcmp(scenario, "script") == 0) && (script == NULL)))
+  {
+    fprintf(stderr, "usage: %s [-s seed] [-n actions] [-l loop_us] [-b bounce_us] [-r rate] [-o trace] "
+                    "bounce|slam|rapid|both|random|sweep|script FILE\n", argv[0]);
+    return 2;
+  }
+
+  if (strcmp(scenario, "sweep") == 0)
+  {
+    return simSweep();
+  }
+
+  seed = simSeed;
+  simGenerate(scenario, script);
+  simRun(&result);
+  simSeed = seed;
+  simReport(scenario, &result);
+  free(result.latency);
+  return (simTraceFile != NULL) ? simTraceWrite(simTraceFile) : 0;
+}
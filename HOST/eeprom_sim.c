@@ -0,0 +1,121 @@
+#include "STD_TYPES.h"
+#include "eeprom.h"
+#include "eeprom_sim.h"
+
+#define EEPROMSIM_WORDS   (EEPROM_SIZE / 4)
+
+static ECU_STATE u32 eepromSimWords[EEPROMSIM_WORDS];
+static ECU_STATE u32 eepromSimBlockWrites[EEPROM_BLOCK_NUM];
+static ECU_STATE u8 eepromSimFormatted;
+
+/* Write in progress */
+static ECU_STATE u8 eepromSimPolls;
+static ECU_STATE u32 eepromSimAddress;
+static ECU_STATE u32 eepromSimData;
+
+
+/*
+  Description: This function shall erase the whole EEPROM and clear the write
+  counters, like a new part
+
+  Input: void
+
+  Output: void
+
+ */
+extern void EepromSim_Erase(void)
+{
+  u32 i;
+
+  for (i = 0; i < EEPROMSIM_WORDS; i++)
+  {
+    eepromSimWords[i] = EEPROM_ERASED_WORD;
+  }
+  for (i = 0; i < EEPROM_BLOCK_NUM; i++)
+  {
+    eepromSimBlockWrites[i] = 0;
+  }
+  eepromSimPolls = 0;
+  eepromSimFormatted = 1;
+}
+
+/*
+  Description: This function shall return the number of completed writes to
+  a block
+
+  Input: block the EEPROM block, below EEPROM_BLOCK_NUM
+
+  Output: write count
+
+ */
+extern u32 EepromSim_BlockWrites(u8 block)
+{
+  return (block < EEPROM_BLOCK_NUM) ? eepromSimBlockWrites[block] : 0;
+}
+
+/*
+  Description: This function shall cut the power: a write in progress is lost
+
+  Input: void
+
+  Output: void
+
+ */
+extern void EepromSim_PowerLoss(void)
+{
+  eepromSimPolls = 0;
+}
+
+errStat EEPROM_Init(void)
+{
+  /* A new part, or the contents from before the simulated reset */
+  if (!eepromSimFormatted)
+  {
+    EepromSim_Erase();
+  }
+  return ERR_STAT_OK;
+}
+
+errStat EEPROM_Read(u32 ui32Address, u32* pui32Data, u32 ui32Count)
+{
+  u32 i;
+
+  if ((ui32Address & 3) || (ui32Address > EEPROM_SIZE) ||
+      (ui32Count > ((EEPROM_SIZE - ui32Address) / 4)) || (pui32Data == 0) ||
+      (eepromSimPolls != 0))
+  {
+    return ERR_STAT_NOK;
+  }
+  for (i = 0; i < ui32Count; i++)
+  {
+    pui32Data[i] = eepromSimWords[(ui32Address / 4) + i];
+  }
+  return ERR_STAT_OK;
+}
+
+errStat EEPROM_WriteStart(u32 ui32Address, u32 ui32Data)
+{
+  if ((ui32Address & 3) || (ui32Address >= EEPROM_SIZE) || (eepromSimPolls != 0))
+  {
+    return ERR_STAT_NOK;
+  }
+  eepromSimAddress = ui32Address;
+  eepromSimData = ui32Data;
+  eepromSimPolls = EEPROMSIM_WRITE_POLLS;
+  return ERR_STAT_OK;
+}
+
+u32 EEPROM_StatusGet(void)
+{
+  if (eepromSimPolls == 0)
+  {
+    return 0;
+  }
+  eepromSimPolls--;
+  if (eepromSimPolls == 0)
+  {
+    eepromSimWords[eepromSimAddress / 4] = eepromSimData;
+    eepromSimBlockWrites[eepromSimAddress / (EEPROM_BLOCK_WORDS * 4)]++;
+  }
+  return EEPROM_RC_WORKING;
+}
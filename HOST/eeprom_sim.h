@@ -0,0 +1,54 @@
+#ifndef EEPROM_SIM_H
+#define EEPROM_SIM_H
+
+/*
+  Simulated on-chip EEPROM for the host build.
+
+  HOST/eeprom_sim.c replaces MCAL/eeprom.c: it implements the EEPROM_xxx API
+  of eeprom.h on a word array that starts erased (all ones). A write only
+  lands in the array once EEPROM_StatusGet has reported EEPROM_RC_WORKING
+  EEPROMSIM_WRITE_POLLS times, so code that does not wait for the EEPROM is
+  exercised as on the target, and reads or writes during that time are
+  refused. The contents are ECU_STATE: they survive a new EventLog_Init
+  (a simulated reset) and every fleet ECU has its own EEPROM.
+
+  Every completed write is counted per block, to check the wear levelling.
+*/
+
+/* Status polls a write stays in progress */
+#define EEPROMSIM_WRITE_POLLS   3
+
+
+/*
+  Description: This function shall erase the whole EEPROM and clear the write
+  counters, like a new part
+
+  Input: void
+
+  Output: void
+
+ */
+extern void EepromSim_Erase(void);
+
+/*
+  Description: This function shall return the number of completed writes to
+  a block
+
+  Input: block the EEPROM block, below EEPROM_BLOCK_NUM
+
+  Output: write count
+
+ */
+extern u32 EepromSim_BlockWrites(u8 block);
+
+/*
+  Description: This function shall cut the power: a write in progress is lost
+
+  Input: void
+
+  Output: void
+
+ */
+extern void EepromSim_PowerLoss(void);
+
+#endif
@@ -0,0 +1,261 @@
+/*
+  Event log on the simulated EEPROM: the unmodified EventLog module writes
+  its records while the test reports door and lamp events, resets the ECU
+  with EventLog_Init and cuts the power during a flush. The totals the log
+  finds after every reset are checked against the ones it had before, and
+  the writes of every block are checked to stay even while the log wraps.
+  Virtual time advances through the timer counter.
+
+  Build:
+    cc -DHOST_BUILD -ILIB -IMCAL -IECUAL -ISERVICES -IHOST -o eventlog_sim \
+       HOST/eventlog_sim.c HOST/hw_sim.c HOST/eeprom_sim.c SERVICES/EventLog.c \
+       SERVICES/TimerWheel.c SERVICES/ErrCnt.c SERVICES/Det.c MCAL/sysctl.c \
+       MCAL/nvic.c MCAL/gpt.c
+  Run: ./eventlog_sim, exits with 1 if a step does not give the expected result.
+*/
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "eeprom.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "TimerWheel.h"
+#include "TimerWheel_config.h"
+#include "EventLog.h"
+#include "EventLog_config.h"
+#include "hw_sim.h"
+#include "eeprom_sim.h"
+
+#define SIM_CYCLES_PER_MS  (SYSCTL_MAIN_OSCILLATOR_HZ / 1000)
+
+/* Records the log holds when every block is full */
+#define SIM_LOG_RECORDS    (EVENTLOG_BLOCK_NUM * (EEPROM_BLOCK_WORDS - 1))
+
+/* Wrap phase: door records per batch, batches, a reset every SIM_RESET_EVERY */
+#define SIM_BATCH_EDGES    12
+#define SIM_BATCHES        40
+#define SIM_RESET_EVERY    8
+
+typedef struct
+{
+  eventLogUsage_t usage;
+  u16 opens[EVENTLOG_DOOR_NUM];
+} simTotals_t;
+
+static u32 simTime;
+static int failures;
+
+/*
+  The timer match interrupt fires when the counter passes the match value, or
+  when the timer wheel pended it for a match already in the past
+*/
+static void simTimerUpdate(u32 previous, u32 now)
+{
+  u32 match;
+
+  HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAV) = now;
+  if (HWREG(NVIC_PEND0) & (1UL << NVIC_INT_TIMER0A))
+  {
+    HWREG(NVIC_PEND0) &= ~(1UL << NVIC_INT_TIMER0A);
+    TIMER0A_Handler();
+  }
+  if ((HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_IMR) & TIMER_INT_TAM) == 0)
+  {
+    return;
+  }
+  match = HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAMATCHR);
+  if ((u32)(match - previous - 1) < (u32)(now - previous))
+  {
+    HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_MIS) = TIMER_INT_TAM;
+    TIMER0A_Handler();
+  }
+}
+
+/* One main loop iteration per millisecond */
+static void simRunMs(u32 ms)
+{
+  while (ms--)
+  {
+    simTimerUpdate(simTime, simTime + SIM_CYCLES_PER_MS);
+    simTime += SIM_CYCLES_PER_MS;
+    EventLog_MainFunction();
+  }
+}
+
+static void simGetTotals(simTotals_t* totals)
+{
+  u8 i;
+
+  EventLog_GetUsage(&totals->usage);
+  for (i = 0; i < EVENTLOG_DOOR_NUM; i++)
+  {
+    totals->opens[i] = EventLog_GetDoorOpens(i);
+  }
+}
+
+/* Equal totals, expecting extra records and resets on the right */
+static int simSameTotals(const simTotals_t* left, const simTotals_t* right, u16 records, u16 resets)
+{
+  u8 i;
+
+  for (i = 0; i < EVENTLOG_DOOR_NUM; i++)
+  {
+    if (left->opens[i] != right->opens[i])
+    {
+      return 0;
+    }
+  }
+  return ((u16)(left->usage.records + records) == right->usage.records) &&
+         ((u16)(left->usage.resets + resets) == right->usage.resets) &&
+         (left->usage.lampOnSeconds == right->usage.lampOnSeconds);
+}
+
+static u32 simAllWrites(void)
+{
+  u32 writes = 0;
+  u8 i;
+
+  for (i = 0; i < EEPROM_BLOCK_NUM; i++)
+  {
+    writes += EepromSim_BlockWrites(i);
+  }
+  return writes;
+}
+
+/* A reset with every record written: the log finds what it had, plus its reset */
+static int simReset(void)
+{
+  simTotals_t before;
+  simTotals_t after;
+
+  simRunMs(EVENTLOG_QUIET_MS + 100);
+  simGetTotals(&before);
+  EventLog_Init();
+  simGetTotals(&after);
+  return simSameTotals(&before, &after, 1, 1);
+}
+
+static void expect(const char* step, int ok)
+{
+  simTotals_t totals;
+
+  simGetTotals(&totals);
+  printf("%-44s records %3u resets %2u lamp %3lu s opens %3u/%3u%s\n", step, totals.usage.records,
+         totals.usage.resets, (unsigned long)totals.usage.lampOnSeconds, totals.opens[0], totals.opens[1],
+         ok ? "" : "  <-- unexpected");
+  failures += !ok;
+}
+
+int main(void)
+{
+  simTotals_t totals;
+  simTotals_t saved;
+  u32 writes;
+  u32 low;
+  u32 high;
+  u16 landed;
+  u16 count = 0;
+  u8 batch;
+  u8 i;
+  int resetFailures = 0;
+
+  HwSim_Reset();
+  EepromSim_Erase();
+  if (TimerWheel_Init() != ERR_STAT_OK)
+  {
+    printf("TimerWheel_Init failed\n");
+    return 1;
+  }
+  if (EventLog_Init() != ERR_STAT_OK)
+  {
+    printf("EventLog_Init failed\n");
+    return 1;
+  }
+  simGetTotals(&totals);
+  expect("new part, reset queued", (totals.usage.records == 1) && (totals.usage.resets == 1));
+
+  EventLog_ReportDoorEdge(0, 1);
+  EventLog_ReportLampState(0, 1);
+  simRunMs(10000);
+  EventLog_ReportDoorEdge(0, 0);
+  EventLog_ReportLampState(0, 0);
+  EventLog_ReportDoorEdge(1, 1);
+  EventLog_ReportDoorEdge(1, 0);
+  simRunMs(EVENTLOG_QUIET_MS + 100);
+  simGetTotals(&totals);
+  expect("doors and 10 s of lamp written",
+         (totals.usage.records == 6) && (totals.usage.lampOnSeconds == 10) &&
+         (totals.opens[0] == 1) && (totals.opens[1] == 1) && (simAllWrites() == 7));
+
+  expect("reset finds the same totals", simReset());
+
+  /* Power loss in the middle of a flush: the queue and the write in progress are lost */
+  simRunMs(EVENTLOG_QUIET_MS + 100);
+  simGetTotals(&saved);
+  writes = simAllWrites();
+  for (i = 0; i < 5; i++)
+  {
+    EventLog_ReportDoorEdge(0, 1);
+    EventLog_ReportDoorEdge(0, 0);
+  }
+  simRunMs(13);
+  EepromSim_PowerLoss();
+  EventLog_Init();
+  simGetTotals(&totals);
+  landed = (u16)(totals.usage.records - saved.usage.records - 1);
+  expect("power loss during a flush",
+         (landed > 0) && (landed < 10) && ((simAllWrites() - writes) == landed) &&
+         (totals.usage.resets == (u16)(saved.usage.resets + 1)) &&
+         (totals.opens[0] == (u16)(saved.opens[0] + ((landed + 1) / 2))));
+
+  expect("reset after the loss finds the same totals", simReset());
+
+  /* Wrap the log several times with a reset now and then */
+  for (batch = 1; batch <= SIM_BATCHES; batch++)
+  {
+    for (i = 0; i < (SIM_BATCH_EDGES / 2); i++)
+    {
+      EventLog_ReportDoorEdge(batch & 1, 1);
+      EventLog_ReportDoorEdge(batch & 1, 0);
+    }
+    if ((batch % 4) == 0)
+    {
+      EventLog_ReportLampState(0, 1);
+      simRunMs(2000);
+      EventLog_ReportLampState(0, 0);
+    }
+    simRunMs(100);
+    if ((batch % SIM_RESET_EVERY) == 0)
+    {
+      resetFailures += !simReset();
+    }
+  }
+  simGetTotals(&totals);
+  expect("log wrapped, resets found the same totals",
+         (resetFailures == 0) && (totals.usage.records > (SIM_LOG_RECORDS - (EEPROM_BLOCK_WORDS - 1))) &&
+         (totals.usage.records <= SIM_LOG_RECORDS));
+
+  low = EepromSim_BlockWrites(EVENTLOG_FIRST_BLOCK);
+  high = low;
+  writes = simAllWrites();
+  for (i = EVENTLOG_FIRST_BLOCK; i < (EVENTLOG_FIRST_BLOCK + EVENTLOG_BLOCK_NUM); i++)
+  {
+    writes -= EepromSim_BlockWrites(i);
+    low = (EepromSim_BlockWrites(i) < low) ? EepromSim_BlockWrites(i) : low;
+    high = (EepromSim_BlockWrites(i) > high) ? EepromSim_BlockWrites(i) : high;
+  }
+  printf("%-44s fewest %lu, most %lu, outside the log %lu%s\n", "writes per log block",
+         (unsigned long)low, (unsigned long)high, (unsigned long)writes,
+         ((high - low) <= EEPROM_BLOCK_WORDS) && (writes == 0) ? "" : "  <-- unexpected");
+  failures += !(((high - low) <= EEPROM_BLOCK_WORDS) && (writes == 0));
+
+  ErrCnt_Get(MODULE_ID_EVENTLOG, &count);
+  printf("%-44s %u%s\n", "event log errors", count, (count == 0) ? "" : "  <-- unexpected");
+  failures += (count != 0);
+
+  printf("%d unexpected\n", failures);
+  return failures ? 1 : 0;
+}
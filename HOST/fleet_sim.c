@@ -0,0 +1,756 @@
+/*
+  Fleet simulation: thousands of door dimmer ECUs running the unmodified
+  application and drivers side by side on all host cores.
+
+  Every ECU has its own simulated register space (hw_sim) and its own copy of
+  the module state. Module state is declared ECU_STATE, thread local in the
+  host build, so all of it sits in the thread local block of the executable;
+  before stepping an ECU a worker copies that ECU's state into its block and
+  copies it back afterwards. ECUs advance in lock step: each round moves all
+  of them by the same slice of virtual time, rounds are split into one task
+  per ECU and spread over a work-stealing pool (a deque per worker, owners
+  take from the bottom, idle workers steal from the top of a random victim).
+
+  ECUs cycle through the vehicle variants of fleetVariants, which replace the
+  switch and lamp tables with setSwitchMap/setLampMap.
+
+  Build:
+    cc -O2 -pthread -DHOST_BUILD -ILIB -IMCAL -IECUAL -IAPP -IRTE -ISERVICES -IHOST -o fleet_sim \
+       HOST/fleet_sim.c HOST/hw_sim.c HOST/can_sim.c HOST/eeprom_sim.c \
+       $(find APP RTE ECUAL LIB SERVICES -name '*.c') \
+       MCAL/gpio.c MCAL/sysctl.c MCAL/nvic.c MCAL/uart.c MCAL/gpt.c MCAL/udma.c MCAL/ssi.c MCAL/dwt.c
+  Run:
+    ./fleet_sim [-e ecus] [-d seconds] [-t threads[,threads...]] [-l loop_us] [-q slice_ms] [-s seed]
+  With several thread counts the whole fleet runs once per count and the
+  scaling against the first count is reported; the statistics must be equal
+  for every count since the ECUs do not depend on the schedule.
+*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <link.h>
+#include <pthread.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "dwt.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Lamp.h"
+#include "Lamp_config.h"
+#include "can.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "TimerWheel_config.h"
+#include "doorDimmer.h"
+#include "hw_sim.h"
+
+#define FLEET_CYCLES_PER_US   (SYSCTL_MAIN_OSCILLATOR_HZ / 1000000)
+#define FLEET_THREAD_MAX      256
+#define FLEET_EDGE_MAX        64
+#define FLEET_LATENCY_BINS    512    /* 1 us bins, the last one collects the rest */
+
+typedef unsigned long long fleetTime_t;
+
+typedef struct
+{
+  const char * name;
+  switchmap_t switches[SWITCH_NUM];
+  lampmap_t lamps[Lamps_NUM];
+} fleetVariant_t;
+
+/* Vehicle variants, an ECU runs variant (index % FLEET_VARIANT_NUM) */
+static const fleetVariant_t fleetVariants[] =
+{
+  {
+    "base",
+    {{GPIO_PIN_4, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPU, SWITCH_SOURCE_PIN, 0}, {GPIO_PIN_1, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPU, SWITCH_SOURCE_PIN, 0},
+     {GPIO_PIN_3, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPU, SWITCH_SOURCE_PIN, 0}},
+    {{GPIO_PIN_2, GPIO_PORTF_BASE, 0xFF, 0x00, LAMP_BACKEND_GPIO, 0}}
+  },
+  {
+    "pull-down",
+    {{GPIO_PIN_4, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPD, SWITCH_SOURCE_PIN, 0}, {GPIO_PIN_1, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPD, SWITCH_SOURCE_PIN, 0},
+     {GPIO_PIN_2, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPD, SWITCH_SOURCE_PIN, 0}},
+    {{GPIO_PIN_3, GPIO_PORTF_BASE, 0xFF, 0x00, LAMP_BACKEND_GPIO, 0}}
+  },
+  {
+    "low-side",
+    {{GPIO_PIN_4, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPU, SWITCH_SOURCE_PIN, 0}, {GPIO_PIN_1, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPU, SWITCH_SOURCE_PIN, 0},
+     {GPIO_PIN_3, GPIO_PORTF_BASE, GPIO_PIN_TYPE_STD_WPU, SWITCH_SOURCE_PIN, 0}},
+    {{GPIO_PIN_2, GPIO_PORTF_BASE, 0x00, 0xFF, LAMP_BACKEND_GPIO, 0}}
+  }
+};
+
+#define FLEET_VARIANT_NUM   (sizeof(fleetVariants) / sizeof(fleetVariants[0]))
+
+typedef struct
+{
+  fleetTime_t t;
+  u8 door;
+  u8 state;
+} fleetEdge_t;
+
+typedef struct
+{
+  u32 ecus;
+  u32 loops;
+  u32 actions;
+  u32 edges;
+  u32 toggles;
+  u32 expectedToggles;
+  u32 missed;
+  u32 maxLatency;             /* us, the histogram saturates at its last bin */
+  u32 latency[FLEET_LATENCY_BINS];
+} fleetStats_t;
+
+typedef struct
+{
+  u8 * state;                 /* this ECU's copy of the thread local block */
+  hwSimSpace_t * space;
+  u8 variant;
+  u8 started;
+  u32 seed;
+  fleetTime_t t;              /* time of the next main loop iteration */
+  fleetTime_t nextAction[DOOR_NUM];
+  u8 doorState[DOOR_NUM];     /* intended door states, the lamp reference */
+  u8 pinState[DOOR_NUM];      /* door states the switch pins show */
+  fleetEdge_t edges[FLEET_EDGE_MAX];
+  u8 edgeNum;
+  u8 expected;
+  u8 pending;                 /* the lamp has not reached expected yet */
+  u8 measuring;               /* the pins call for expected since pendingSince */
+  u8 lastLamp;
+  fleetTime_t pendingSince;
+  u32 lastTimer;
+  fleetStats_t stats;
+} fleetEcu_t;
+
+typedef struct
+{
+  pthread_mutex_t lock;
+  u32 * tasks;
+  u32 top;
+  u32 bottom;
+} fleetDeque_t;
+
+typedef struct
+{
+  u32 index;
+  u32 seed;
+  pthread_t thread;
+} fleetWorker_t;
+
+/* Thread local block of the executable, all ECU_STATE variables */
+static size_t fleetTlsSize;
+static const u8 * fleetTlsImage;
+static size_t fleetTlsImageSize;
+
+static fleetEcu_t * fleetEcus;
+static u32 fleetEcuNum = 1000;
+static u32 fleetLoopUs = 50;
+static u32 fleetSliceMs = 50;
+static u32 fleetSeconds = 10;
+static u32 fleetSeed = 1;
+
+static fleetDeque_t fleetDeques[FLEET_THREAD_MAX];
+static fleetWorker_t fleetWorkers[FLEET_THREAD_MAX];
+static u32 fleetThreadNum;
+static pthread_barrier_t fleetRoundStart;
+static pthread_barrier_t fleetRoundEnd;
+static fleetTime_t fleetRoundUntil;
+static u8 fleetQuit;
+
+
+/* xorshift32, every ECU has its own sequence */
+static u32 fleetRand(u32 * seed)
+{
+  *seed ^= *seed << 13;
+  *seed ^= *seed >> 17;
+  *seed ^= *seed << 5;
+  return *seed;
+}
+
+static u32 fleetRange(u32 * seed, u32 lo, u32 hi)
+{
+  return lo + (fleetRand(seed) % (hi - lo + 1));
+}
+
+static int fleetTlsFind(struct dl_phdr_info * info, size_t size, void * data)
+{
+  void ** block = data;
+  int i;
+
+  (void)size;
+  for (i = 0; i < info->dlpi_phnum; i++)
+  {
+    if (info->dlpi_phdr[i].p_type == PT_TLS)
+    {
+      *block = info->dlpi_tls_data;
+      fleetTlsSize = info->dlpi_phdr[i].p_memsz;
+      fleetTlsImageSize = info->dlpi_phdr[i].p_filesz;
+      fleetTlsImage = (const u8 *)(info->dlpi_addr + info->dlpi_phdr[i].p_vaddr);
+    }
+  }
+  /* The executable comes first, the libraries keep their own blocks */
+  return 1;
+}
+
+/* Address of the calling thread's copy of the ECU state */
+static u8 * fleetTlsBlock(void)
+{
+  void * block = NULL;
+
+  dl_iterate_phdr(fleetTlsFind, &block);
+  return block;
+}
+
+/* Pin level of a door switch in a state, following the pull of its switch */
+static void fleetDrive(u8 door, u8 state)
+{
+  switchmap_t * switchMapElement = getSwitchMap(getDoorMap(door)->switchNum);
+  u8 pressed = (state == DOOR_CLOSED);
+
+  if (GPIO_PIN_TYPE_STD_WPU == switchMapElement->pullState)
+  {
+    pressed = !pressed;
+  }
+  HwSim_PinDrive(switchMapElement->port, switchMapElement->pin, pressed);
+}
+
+/* Lamp state the switch pins call for */
+static u8 fleetPinLamp(const fleetEcu_t * ecu)
+{
+  return ((ecu->pinState[DOOR_LEFT] == DOOR_OPENED) ||
+          (ecu->pinState[DOOR_RIGHT] == DOOR_OPENED)) ? LAMP_ON : LAMP_OFF;
+}
+
+static u8 fleetLampLevel(void)
+{
+  lampmap_t * lampMapElement = getLampMap(Lamp_DIMMER);
+
+  return ((HwSim_PinGet(lampMapElement->port) & lampMapElement->pin) ==
+          (lampMapElement->ON & lampMapElement->pin)) ? LAMP_ON : LAMP_OFF;
+}
+
+static void fleetEdgeAdd(fleetEcu_t * ecu, fleetTime_t t, u8 door, u8 state)
+{
+  u8 i;
+
+  if (ecu->edgeNum == FLEET_EDGE_MAX)
+  {
+    return;
+  }
+  /* Few pending edges, insertion keeps them sorted */
+  for (i = ecu->edgeNum; (i > 0) && (ecu->edges[i - 1].t > t); i--)
+  {
+    ecu->edges[i] = ecu->edges[i - 1];
+  }
+  ecu->edges[i].t = t;
+  ecu->edges[i].door = door;
+  ecu->edges[i].state = state;
+  ecu->edgeNum++;
+  ecu->stats.edges++;
+}
+
+/*
+  Door movement with contact bounce, closing slams rebound now and then. The
+  movement starts somewhere before the next loop iteration, returns its time.
+*/
+static fleetTime_t fleetAction(fleetEcu_t * ecu, u8 door)
+{
+  fleetTime_t t = ecu->t + (fleetTime_t)fleetRange(&ecu->seed, 0, fleetLoopUs - 1) * FLEET_CYCLES_PER_US;
+  fleetTime_t start = t;
+  u8 state = !ecu->doorState[door];
+  u32 bounces = fleetRange(&ecu->seed, 0, 8);
+  u32 i;
+
+  ecu->doorState[door] = state;
+  ecu->stats.actions++;
+  fleetEdgeAdd(ecu, t, door, state);
+  for (i = 0; i < bounces; i++)
+  {
+    t += (fleetTime_t)fleetRange(&ecu->seed, 50, 400) * FLEET_CYCLES_PER_US;
+    fleetEdgeAdd(ecu, t, door, !state);
+    t += (fleetTime_t)fleetRange(&ecu->seed, 20, 300) * FLEET_CYCLES_PER_US;
+    fleetEdgeAdd(ecu, t, door, state);
+  }
+  if ((state == DOOR_CLOSED) && (fleetRange(&ecu->seed, 0, 4) == 0))
+  {
+    t += (fleetTime_t)fleetRange(&ecu->seed, 10000, 40000) * FLEET_CYCLES_PER_US;
+    fleetEdgeAdd(ecu, t, door, DOOR_OPENED);
+    t += (fleetTime_t)fleetRange(&ecu->seed, 5000, 30000) * FLEET_CYCLES_PER_US;
+    fleetEdgeAdd(ecu, t, door, DOOR_CLOSED);
+  }
+  ecu->nextAction[door] = ecu->t + (fleetTime_t)fleetRange(&ecu->seed, 100, 3000) * 1000 * FLEET_CYCLES_PER_US;
+  return start;
+}
+
+/* First run of an ECU: variant tables, register space and firmware start up */
+static void fleetEcuStart(fleetEcu_t * ecu)
+{
+  u8 door;
+
+  HwSim_SpaceSelect(ecu->space);
+  setSwitchMap(fleetVariants[ecu->variant].switches);
+  setLampMap(fleetVariants[ecu->variant].lamps);
+  for (door = 0; door < DOOR_NUM; door++)
+  {
+    ecu->doorState[door] = DOOR_CLOSED;
+    ecu->pinState[door] = DOOR_CLOSED;
+    ecu->nextAction[door] = (fleetTime_t)fleetRange(&ecu->seed, 1, 2000) * 1000 * FLEET_CYCLES_PER_US;
+    fleetDrive(door, DOOR_CLOSED);
+  }
+  DoorDimmer_Init();
+  ecu->expected = LAMP_OFF;
+  ecu->lastLamp = fleetLampLevel();
+  ecu->started = 1;
+}
+
+/* Steps one ECU up to a time, in the calling thread */
+static void fleetEcuRun(fleetEcu_t * ecu, u8 * block, fleetTime_t until)
+{
+  fleetTime_t loopCycles = (fleetTime_t)fleetLoopUs * FLEET_CYCLES_PER_US;
+  fleetTime_t start;
+  u32 match;
+  u8 door;
+  u8 lamp;
+
+  memcpy(block, ecu->state, fleetTlsSize);
+  if (!ecu->started)
+  {
+    fleetEcuStart(ecu);
+  }
+
+  for (; ecu->t < until; ecu->t += loopCycles)
+  {
+    for (door = 0; door < DOOR_NUM; door++)
+    {
+      if (ecu->nextAction[door] <= ecu->t)
+      {
+        u8 before = ecu->expected;
+
+        start = fleetAction(ecu, door);
+        ecu->expected = ((ecu->doorState[DOOR_LEFT] == DOOR_OPENED) ||
+                         (ecu->doorState[DOOR_RIGHT] == DOOR_OPENED)) ? LAMP_ON : LAMP_OFF;
+        if (ecu->expected != before)
+        {
+          ecu->stats.expectedToggles++;
+          if (ecu->pending)
+          {
+            ecu->stats.missed++;
+          }
+          ecu->pending = (ecu->expected != ecu->lastLamp);
+          /*
+            The latency counts from the edge that makes the pins call for the
+            new lamp state: edges of the other door still bouncing or
+            rebounding can hold it back, that is no firmware delay.
+          */
+          ecu->measuring = (fleetPinLamp(ecu) == ecu->expected);
+          ecu->pendingSince = start;
+        }
+      }
+    }
+    while ((ecu->edgeNum > 0) && (ecu->edges[0].t <= ecu->t))
+    {
+      fleetDrive(ecu->edges[0].door, ecu->edges[0].state);
+      ecu->pinState[ecu->edges[0].door] = ecu->edges[0].state;
+      if (ecu->pending && (ecu->measuring != (fleetPinLamp(ecu) == ecu->expected)))
+      {
+        ecu->measuring = !ecu->measuring;
+        ecu->pendingSince = ecu->edges[0].t;
+      }
+      ecu->edgeNum--;
+      memmove(&ecu->edges[0], &ecu->edges[1], ecu->edgeNum * sizeof(fleetEdge_t));
+    }
+
+    HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAV) = (u32)ecu->t;
+    /* Timer interrupt pended by the timer wheel for a match already passed */
+    if (HWREG(NVIC_PEND0) & (1UL << NVIC_INT_TIMER0A))
+    {
+      HWREG(NVIC_PEND0) &= ~(1UL << NVIC_INT_TIMER0A);
+      TIMER0A_Handler();
+    }
+    /* Timer match interrupt when the counter passes the match value */
+    if (HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_IMR) & TIMER_INT_TAM)
+    {
+      match = HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAMATCHR);
+      if ((u32)(match - ecu->lastTimer - 1) < (u32)((u32)ecu->t - ecu->lastTimer))
+      {
+        HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_MIS) = TIMER_INT_TAM;
+        TIMER0A_Handler();
+      }
+    }
+    ecu->lastTimer = (u32)ecu->t;
+    HWREG(DWT_CYCCNT) = (u32)ecu->t;
+
+    DoorDimmer_Schedule();
+    ecu->stats.loops++;
+
+    lamp = fleetLampLevel();
+    if (lamp != ecu->lastLamp)
+    {
+      ecu->stats.toggles++;
+      ecu->lastLamp = lamp;
+      if (ecu->pending && (lamp == ecu->expected))
+      {
+        u32 us = (u32)((ecu->t - ecu->pendingSince) / FLEET_CYCLES_PER_US);
+
+        /* Not measuring: the lamp caught a bounce the pins already left */
+        if (ecu->measuring)
+        {
+          ecu->stats.latency[(us < FLEET_LATENCY_BINS) ? us : (FLEET_LATENCY_BINS - 1)]++;
+          if (us > ecu->stats.maxLatency)
+          {
+            ecu->stats.maxLatency = us;
+          }
+        }
+        ecu->pending = 0;
+      }
+    }
+  }
+
+  memcpy(ecu->state, block, fleetTlsSize);
+}
+
+/* Owner end of a deque */
+static u8 fleetPop(fleetDeque_t * deque, u32 * task)
+{
+  u8 found = 0;
+
+  pthread_mutex_lock(&deque->lock);
+  if (deque->bottom > deque->top)
+  {
+    *task = deque->tasks[--deque->bottom];
+    found = 1;
+  }
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+/* Thief end of a deque */
+static u8 fleetSteal(fleetDeque_t * deque, u32 * task)
+{
+  u8 found = 0;
+
+  pthread_mutex_lock(&deque->lock);
+  if (deque->bottom > deque->top)
+  {
+    *task = deque->tasks[deque->top++];
+    found = 1;
+  }
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+static void * fleetWorker(void * arg)
+{
+  fleetWorker_t * worker = arg;
+  fleetDeque_t * own = &fleetDeques[worker->index];
+  u8 * block = fleetTlsBlock();
+  u32 task = 0;
+  u32 victim;
+  u32 tries;
+
+  for (;;)
+  {
+    pthread_barrier_wait(&fleetRoundStart);
+    if (fleetQuit)
+    {
+      break;
+    }
+    for (;;)
+    {
+      if (!fleetPop(own, &task))
+      {
+        /* Tasks are only added between rounds, all deques empty ends the round */
+        victim = fleetRand(&worker->seed) % fleetThreadNum;
+        for (tries = 0; tries < fleetThreadNum; tries++)
+        {
+          if ((victim != worker->index) && fleetSteal(&fleetDeques[victim], &task))
+          {
+            break;
+          }
+          victim = (victim + 1) % fleetThreadNum;
+        }
+        if (tries == fleetThreadNum)
+        {
+          break;
+        }
+      }
+      fleetEcuRun(&fleetEcus[task], block, fleetRoundUntil);
+    }
+    pthread_barrier_wait(&fleetRoundEnd);
+  }
+  return NULL;
+}
+
+static void fleetCreate(void)
+{
+  u32 i;
+
+  fleetEcus = calloc(fleetEcuNum, sizeof(fleetEcu_t));
+  for (i = 0; i < fleetEcuNum; i++)
+  {
+    fleetEcus[i].state = malloc(fleetTlsSize);
+    memcpy(fleetEcus[i].state, fleetTlsImage, fleetTlsImageSize);
+    memset(fleetEcus[i].state + fleetTlsImageSize, 0, fleetTlsSize - fleetTlsImageSize);
+    fleetEcus[i].space = HwSim_SpaceCreate();
+    if ((fleetEcus[i].state == NULL) || (fleetEcus[i].space == NULL))
+    {
+      fprintf(stderr, "out of memory at ECU %lu\n", (unsigned long)i);
+      exit(2);
+    }
+    fleetEcus[i].variant = i % FLEET_VARIANT_NUM;
+    fleetEcus[i].seed = (fleetSeed * 2654435761UL) ^ (i + 1);
+    if (fleetEcus[i].seed == 0)
+    {
+      fleetEcus[i].seed = 1;
+    }
+  }
+}
+
+static void fleetDestroy(void)
+{
+  u32 i;
+
+  for (i = 0; i < fleetEcuNum; i++)
+  {
+    free(fleetEcus[i].state);
+    HwSim_SpaceDestroy(fleetEcus[i].space);
+  }
+  free(fleetEcus);
+}
+
+/* Runs the whole fleet on a number of threads, returns the wall time */
+static double fleetRun(u32 threads)
+{
+  fleetTime_t slice = (fleetTime_t)fleetSliceMs * 1000 * FLEET_CYCLES_PER_US;
+  fleetTime_t end = (fleetTime_t)fleetSeconds * SYSCTL_MAIN_OSCILLATOR_HZ;
+  struct timespec start, stop;
+  u32 perWorker;
+  u32 w, i;
+
+  fleetThreadNum = threads;
+  fleetQuit = 0;
+  pthread_barrier_init(&fleetRoundStart, NULL, threads + 1);
+  pthread_barrier_init(&fleetRoundEnd, NULL, threads + 1);
+  for (w = 0; w < threads; w++)
+  {
+    pthread_mutex_init(&fleetDeques[w].lock, NULL);
+    fleetDeques[w].tasks = malloc(fleetEcuNum * sizeof(u32));
+    fleetWorkers[w].index = w;
+    fleetWorkers[w].seed = w + 1;
+    pthread_create(&fleetWorkers[w].thread, NULL, fleetWorker, &fleetWorkers[w]);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (fleetRoundUntil = slice; fleetRoundUntil <= end; fleetRoundUntil += slice)
+  {
+    /* Neighbouring ECUs start on the same worker */
+    perWorker = (fleetEcuNum + threads - 1) / threads;
+    for (w = 0; w < threads; w++)
+    {
+      fleetDeques[w].top = 0;
+      fleetDeques[w].bottom = 0;
+      for (i = w * perWorker; (i < (w + 1) * perWorker) && (i < fleetEcuNum); i++)
+      {
+        fleetDeques[w].tasks[fleetDeques[w].bottom++] = i;
+      }
+    }
+    pthread_barrier_wait(&fleetRoundStart);
+    pthread_barrier_wait(&fleetRoundEnd);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &stop);
+
+  fleetQuit = 1;
+  pthread_barrier_wait(&fleetRoundStart);
+  for (w = 0; w < threads; w++)
+  {
+    pthread_join(fleetWorkers[w].thread, NULL);
+    pthread_mutex_destroy(&fleetDeques[w].lock);
+    free(fleetDeques[w].tasks);
+  }
+  pthread_barrier_destroy(&fleetRoundStart);
+  pthread_barrier_destroy(&fleetRoundEnd);
+
+  return (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+static void fleetAdd(fleetStats_t * sum, const fleetStats_t * stats)
+{
+  u32 i;
+
+  sum->ecus++;
+  sum->loops += stats->loops;
+  sum->actions += stats->actions;
+  sum->edges += stats->edges;
+  sum->toggles += stats->toggles;
+  sum->expectedToggles += stats->expectedToggles;
+  sum->missed += stats->missed;
+  if (stats->maxLatency > sum->maxLatency)
+  {
+    sum->maxLatency = stats->maxLatency;
+  }
+  for (i = 0; i < FLEET_LATENCY_BINS; i++)
+  {
+    sum->latency[i] += stats->latency[i];
+  }
+}
+
+static u32 fleetPercentile(const fleetStats_t * stats, u32 percent)
+{
+  unsigned long long total = 0, seen = 0;
+  u32 i;
+
+  for (i = 0; i < FLEET_LATENCY_BINS; i++)
+  {
+    total += stats->latency[i];
+  }
+  for (i = 0; i < FLEET_LATENCY_BINS; i++)
+  {
+    seen += stats->latency[i];
+    if ((total > 0) && ((seen * 100) >= (total * percent)))
+    {
+      return i;
+    }
+  }
+  return 0;
+}
+
+static void fleetPrint(const char * name, const fleetStats_t * stats)
+{
+  printf("%-10s %6lu %10lu %9lu %9lu %9lu %7lu %5lu %5lu %5lu\n", name,
+         (unsigned long)stats->ecus, (unsigned long)stats->loops, (unsigned long)stats->actions,
+         (unsigned long)stats->toggles, (unsigned long)stats->expectedToggles,
+         (unsigned long)stats->missed, (unsigned long)fleetPercentile(stats, 50),
+         (unsigned long)fleetPercentile(stats, 99), (unsigned long)stats->maxLatency);
+}
+
+/* Aggregates per variant and over the fleet, returns a digest of the totals */
+static unsigned long long fleetReport(void)
+{
+  static fleetStats_t perVariant[FLEET_VARIANT_NUM];
+  static fleetStats_t total;
+  unsigned long long digest = 1469598103934665603ULL;
+  const u8 * bytes = (const u8 *)&total;
+  u32 i;
+
+  memset(perVariant, 0, sizeof(perVariant));
+  memset(&total, 0, sizeof(total));
+  for (i = 0; i < fleetEcuNum; i++)
+  {
+    fleetAdd(&perVariant[fleetEcus[i].variant], &fleetEcus[i].stats);
+    fleetAdd(&total, &fleetEcus[i].stats);
+  }
+
+  printf("variant      ECUs      loops   actions   toggles  expected  missed   p50   p99   max [us]\n");
+  for (i = 0; i < FLEET_VARIANT_NUM; i++)
+  {
+    fleetPrint(fleetVariants[i].name, &perVariant[i]);
+  }
+  fleetPrint("fleet", &total);
+
+  for (i = 0; i < sizeof(total); i++)
+  {
+    digest = (digest ^ bytes[i]) * 1099511628211ULL;
+  }
+  return digest;
+}
+
+int main(int argc, char * argv[])
+{
+  u32 threadList[32];
+  u32 threadListNum = 0;
+  unsigned long long digest = 0, firstDigest = 0;
+  double wall, firstWall = 0;
+  char * list = NULL;
+  char * token;
+  u32 i;
+  int a;
+
+  for (a = 1; a + 1 < argc; a += 2)
+  {
+    u32 value = (u32)strtoul(argv[a + 1], NULL, 0);
+
+    if ((argv[a][0] != '-') || (argv[a][1] == 0))
+    {
+      break;
+    }
+    switch (argv[a][1])
+    {
+      case 'e': fleetEcuNum = value ? value : 1; break;
+      case 'd': fleetSeconds = value ? value : 1; break;
+      case 'l': fleetLoopUs = value ? value : 1; break;
+      case 'q': fleetSliceMs = value ? value : 1; break;
+      case 's': fleetSeed = value ? value : 1; break;
+      case 't': list = argv[a + 1]; break;
+      default:
+        fprintf(stderr, "usage: %s [-e ecus] [-d seconds] [-t threads[,threads...]] "
+                        "[-l loop_us] [-q slice_ms] [-s seed]\n", argv[0]);
+        return 2;
+    }
+  }
+  if (a < argc)
+  {
+    fprintf(stderr, "usage: %s [-e ecus] [-d seconds] [-t threads[,threads...]] "
+                    "[-l loop_us] [-q slice_ms] [-s seed]\n", argv[0]);
+    return 2;
+  }
+  for (token = list ? strtok(list, ",") : NULL; (token != NULL) && (threadListNum < 32); token = strtok(NULL, ","))
+  {
+    u32 threads = (u32)strtoul(token, NULL, 0);
+
+    threadList[threadListNum++] = (threads == 0) ? 1 : ((threads > FLEET_THREAD_MAX) ? FLEET_THREAD_MAX : threads);
+  }
+  if (threadListNum == 0)
+  {
+    threadList[threadListNum++] = 1;
+  }
+
+  if ((fleetTlsBlock() == NULL) || (fleetTlsSize == 0))
+  {
+    fprintf(stderr, "no thread local ECU state found, build with -DHOST_BUILD\n");
+    return 2;
+  }
+  printf("%lu ECUs, %lu s of virtual time each, %lu us loop, %lu bytes of state per ECU\n",
+         (unsigned long)fleetEcuNum, (unsigned long)fleetSeconds, (unsigned long)fleetLoopUs,
+         (unsigned long)fleetTlsSize);
+
+  for (i = 0; i < threadListNum; i++)
+  {
+    fleetCreate();
+    wall = fleetRun(threadList[i]);
+    printf("\n%lu threads: %.2f s wall, %.3g ECU loops/s, %.0f ECU seconds per second",
+           (unsigned long)threadList[i], wall, (double)fleetEcuNum * fleetSeconds * 1e6 / fleetLoopUs / wall,
+           fleetSeconds / wall * fleetEcuNum);
+    if (i == 0)
+    {
+      firstWall = wall;
+      printf("\n");
+    }
+    else
+    {
+      printf(", speedup %.2f, efficiency %.0f%%\n", firstWall / wall,
+             100.0 * firstWall / wall * threadList[0] / threadList[i]);
+    }
+    digest = fleetReport();
+    if (i == 0)
+    {
+      firstDigest = digest;
+    }
+    else if (digest != firstDigest)
+    {
+      printf("statistics differ from the %lu thread run\n", (unsigned long)threadList[0]);
+      fleetDestroy();
+      return 1;
+    }
+    fleetDestroy();
+  }
+  return 0;
+}
@@ -0,0 +1,679 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "STD_TYPES.h"
+#include "hw_sim.h"
+
+typedef struct
+{
+  u32 addr;
+  u8 used;
+  volatile u32 value;
+} hwSimReg_t;
+
+/*
+  GPIO ports. The DATA register is a 256 word window where address bits
+  [9:2] mask the access, so a window access is served from a scratch word
+  filled with the masked pin levels. Whatever was left in it is merged into
+  the output latch at the next access, for the output pins of the mask only.
+  ICR works the same way: it is served from a word preset to 0 and the
+  bits left in it clear the latched edges at the next access.
+*/
+typedef struct
+{
+  u8 latch;        /* output latch, drives the pins set in DIR */
+  u8 external;     /* levels applied from outside to the input pins */
+  u8 windowMask;   /* pins of the last window access */
+  u8 edges;        /* latched edges of the edge sensitive pins */
+  volatile u32 window;
+  volatile u32 icr;
+} hwSimGpio_t;
+
+static const u32 hwSimGpioBase[HWSIM_GPIO_PORT_NUM] =
+{
+  0x40004000, 0x40005000, 0x40006000, 0x40007000, 0x40024000, 0x40025000
+};
+
+/*
+  SSIs. A DATA register access is served from a window word preset to
+  HWSIM_SSI_DR_IDLE; anything else left in it at the next access was
+  written and goes into the transmit FIFO. The shifter moves frames out of
+  the FIFO only when HwSim_SsiShift is called. They go into an optional
+  chain of shift registers, whose outputs take the chain contents on a
+  rising edge of the latch pin.
+*/
+typedef struct
+{
+  u8 fifo[HWSIM_SSI_FIFO_DEPTH];
+  u8 fifoHead;
+  u8 fifoCount;
+  volatile u32 window;
+  u8 chain[HWSIM_SSI_CHAIN_MAX];    /* shift registers, [0] next to the SSI */
+  u8 outputs[HWSIM_SSI_CHAIN_MAX];  /* output latches of the registers */
+  u16 chainBytes;                   /* 0 without a chain */
+  u8 latchPort;
+  u8 latchPin;
+  u32 latches;
+} hwSimSsi_t;
+
+static const u32 hwSimSsiBase[HWSIM_SSI_NUM] =
+{
+  0x40008000, 0x40009000, 0x4000A000, 0x4000B000
+};
+
+/* One simulated chip: register file, GPIO pins and SSIs */
+struct hwSimSpace
+{
+  hwSimReg_t regs[HWSIM_REG_NUM];
+  hwSimGpio_t gpio[HWSIM_GPIO_PORT_NUM];
+  hwSimSsi_t ssi[HWSIM_SSI_NUM];
+  u8 gpioPending;  /* port of the pending window access, HWSIM_GPIO_PORT_NUM if none */
+  u8 icrPending;   /* port of the pending ICR access, HWSIM_GPIO_PORT_NUM if none */
+  u8 ssiPending;   /* SSI of the pending DATA access, HWSIM_SSI_NUM if none */
+};
+
+static hwSimSpace_t hwSimDefault = { .gpioPending = HWSIM_GPIO_PORT_NUM, .icrPending = HWSIM_GPIO_PORT_NUM,
+                                      .ssiPending = HWSIM_SSI_NUM };
+
+/* Space the register accesses of the calling thread go to */
+static ECU_STATE hwSimSpace_t * hwSimCurrent = &hwSimDefault;
+
+/* Offsets of the GPIO registers the window depends on */
+#define HWSIM_GPIO_O_DATA_END   0x400
+#define HWSIM_GPIO_O_DIR        0x400
+#define HWSIM_GPIO_O_IS         0x404
+#define HWSIM_GPIO_O_IBE        0x408
+#define HWSIM_GPIO_O_IEV        0x40C
+#define HWSIM_GPIO_O_IM         0x410
+#define HWSIM_GPIO_O_RIS        0x414
+#define HWSIM_GPIO_O_MIS        0x418
+#define HWSIM_GPIO_O_ICR        0x41C
+
+/* SSI registers and bits the model serves */
+#define HWSIM_SSI_O_CR1         0x004
+#define HWSIM_SSI_O_DR          0x008
+#define HWSIM_SSI_O_SR          0x00C
+#define HWSIM_SSI_O_IM          0x014
+#define HWSIM_SSI_O_RIS         0x018
+#define HWSIM_SSI_O_MIS         0x01C
+#define HWSIM_SSI_CR1_SSE       0x02
+#define HWSIM_SSI_CR1_EOT       0x10
+#define HWSIM_SSI_SR_TFE        0x01
+#define HWSIM_SSI_SR_TNF        0x02
+#define HWSIM_SSI_SR_BSY        0x10
+#define HWSIM_SSI_INT_TX        0x08
+
+
+static volatile u32 * HwSim_RegLookup(u32 ui32Addr);
+
+/* 
+  Description: This function shall return the port index of a GPIO address
+  
+  Input: ui32Addr any address
+  
+  Output: Port index, or HWSIM_GPIO_PORT_NUM if the address is not a GPIO port
+
+ */
+static u8 HwSim_GpioPort(u32 ui32Addr)
+{
+  u8 port;
+  
+  for (port = 0; port < HWSIM_GPIO_PORT_NUM; port++)
+  {
+    if ((ui32Addr & 0xFFFFF000) == hwSimGpioBase[port])
+    {
+      break;
+    }
+  }
+  return port;
+}
+
+/* 
+  Description: This function shall return the levels of the pins of a port
+  
+  Input: port the port index
+  
+  Output: Pin levels, output pins from the latch and input pins from outside
+
+ */
+static u8 HwSim_GpioLevels(u8 port)
+{
+  u8 dir = (u8)*HwSim_RegLookup(hwSimGpioBase[port] + HWSIM_GPIO_O_DIR);
+  hwSimGpio_t * gpio = &hwSimCurrent->gpio[port];
+  
+  return (gpio->latch & dir) | (gpio->external & ~dir);
+}
+
+/* 
+  Description: This function shall latch the edges of a level change that
+  the interrupt sense registers of the port ask for
+  
+  Input: 
+        1- port the port index
+        2- before the pin levels before the change
+        3- after the pin levels after the change
+  
+  Output: void
+
+ */
+static void HwSim_GpioEdges(u8 port, u8 before, u8 after)
+{
+  u32 base = hwSimGpioBase[port];
+  u8 changed = before ^ after;
+  u8 level;
+  u8 both;
+  u8 event;
+  
+  if (changed == 0)
+  {
+    return;
+  }
+  level = (u8)*HwSim_RegLookup(base + HWSIM_GPIO_O_IS);
+  both = (u8)*HwSim_RegLookup(base + HWSIM_GPIO_O_IBE);
+  event = (u8)*HwSim_RegLookup(base + HWSIM_GPIO_O_IEV);
+  
+  /* Both edges, or the edge IEV selects: rising when set, falling when clear */
+  hwSimCurrent->gpio[port].edges |= changed & (u8)~level & (both | (u8)~(after ^ event));
+}
+
+/* 
+  Description: This function shall update RIS and MIS of a port: latched
+  edges, and the level sensitive pins at their selected level
+  
+  Input: port the port index
+  
+  Output: void
+
+ */
+static void HwSim_GpioIntStatus(u8 port)
+{
+  u32 base = hwSimGpioBase[port];
+  u8 level = (u8)*HwSim_RegLookup(base + HWSIM_GPIO_O_IS);
+  u8 event = (u8)*HwSim_RegLookup(base + HWSIM_GPIO_O_IEV);
+  u8 raw;
+  
+  raw = hwSimCurrent->gpio[port].edges | (level & (u8)~(HwSim_GpioLevels(port) ^ event));
+  *HwSim_RegLookup(base + HWSIM_GPIO_O_RIS) = raw;
+  *HwSim_RegLookup(base + HWSIM_GPIO_O_MIS) = raw & *HwSim_RegLookup(base + HWSIM_GPIO_O_IM);
+}
+
+/* 
+  Description: This function shall merge a pending DATA window access into
+  the output latch, and clear the edges left in a pending ICR access
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void HwSim_GpioCommit(void)
+{
+  u8 port = hwSimCurrent->icrPending;
+  hwSimGpio_t * gpio;
+  hwSimSsi_t * ssi;
+  u8 before;
+  u8 rising;
+  u8 pins;
+  u8 i;
+  
+  if (port < HWSIM_GPIO_PORT_NUM)
+  {
+    hwSimCurrent->gpio[port].edges &= (u8)~hwSimCurrent->gpio[port].icr;
+    hwSimCurrent->icrPending = HWSIM_GPIO_PORT_NUM;
+  }
+  
+  port = hwSimCurrent->gpioPending;
+  if (port < HWSIM_GPIO_PORT_NUM)
+  {
+    gpio = &hwSimCurrent->gpio[port];
+    pins = gpio->windowMask & (u8)*HwSim_RegLookup(hwSimGpioBase[port] + HWSIM_GPIO_O_DIR);
+    rising = (u8)(~gpio->latch & (u8)gpio->window & pins);
+    if ((u8)((gpio->latch ^ (u8)gpio->window) & pins) != 0)
+    {
+      before = HwSim_GpioLevels(port);
+      gpio->latch = (gpio->latch & ~pins) | ((u8)gpio->window & pins);
+      HwSim_GpioEdges(port, before, HwSim_GpioLevels(port));
+    }
+    hwSimCurrent->gpioPending = HWSIM_GPIO_PORT_NUM;
+    
+    /* Shift register chains latched by one of these pins */
+    for (i = 0; i < HWSIM_SSI_NUM; i++)
+    {
+      ssi = &hwSimCurrent->ssi[i];
+      if ((ssi->chainBytes != 0) && (ssi->latchPort == port) && (rising & ssi->latchPin))
+      {
+        memcpy(ssi->outputs, ssi->chain, ssi->chainBytes);
+        ssi->latches++;
+      }
+    }
+  }
+}
+
+/* 
+  Description: This function shall return the SSI index of an address
+  
+  Input: ui32Addr any address
+  
+  Output: SSI index, or HWSIM_SSI_NUM if the address is not an SSI
+
+ */
+static u8 HwSim_SsiIndex(u32 ui32Addr)
+{
+  u8 index;
+  
+  for (index = 0; index < HWSIM_SSI_NUM; index++)
+  {
+    if ((ui32Addr & 0xFFFFF000) == hwSimSsiBase[index])
+    {
+      break;
+    }
+  }
+  return index;
+}
+
+/* 
+  Description: This function shall move a frame written to a DATA register
+  into the transmit FIFO, a full FIFO drops it like the hardware
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void HwSim_SsiCommit(void)
+{
+  u8 index = hwSimCurrent->ssiPending;
+  hwSimSsi_t * ssi;
+  
+  if (index < HWSIM_SSI_NUM)
+  {
+    ssi = &hwSimCurrent->ssi[index];
+    if ((ssi->window != HWSIM_SSI_DR_IDLE) && (ssi->fifoCount < HWSIM_SSI_FIFO_DEPTH))
+    {
+      ssi->fifo[(ssi->fifoHead + ssi->fifoCount) % HWSIM_SSI_FIFO_DEPTH] = (u8)ssi->window;
+      ssi->fifoCount++;
+    }
+    hwSimCurrent->ssiPending = HWSIM_SSI_NUM;
+  }
+}
+
+/* 
+  Description: This function shall update the status registers of an SSI from
+  its FIFO: the transmit interrupt asserts at half empty, or once the FIFO is
+  empty and the last frame shifted out in end-of-transmission mode
+  
+  Input: index the SSI index
+  
+  Output: void
+
+ */
+static void HwSim_SsiStatus(u8 index)
+{
+  u32 base = hwSimSsiBase[index];
+  hwSimSsi_t * ssi = &hwSimCurrent->ssi[index];
+  u32 raw;
+  
+  *HwSim_RegLookup(base + HWSIM_SSI_O_SR) = ((ssi->fifoCount == 0) ? HWSIM_SSI_SR_TFE : 0) |
+                                            ((ssi->fifoCount < HWSIM_SSI_FIFO_DEPTH) ? HWSIM_SSI_SR_TNF : 0) |
+                                            ((ssi->fifoCount != 0) ? HWSIM_SSI_SR_BSY : 0);
+  if (*HwSim_RegLookup(base + HWSIM_SSI_O_CR1) & HWSIM_SSI_CR1_EOT)
+  {
+    raw = (ssi->fifoCount == 0) ? HWSIM_SSI_INT_TX : 0;
+  }
+  else
+  {
+    raw = (ssi->fifoCount <= (HWSIM_SSI_FIFO_DEPTH / 2)) ? HWSIM_SSI_INT_TX : 0;
+  }
+  *HwSim_RegLookup(base + HWSIM_SSI_O_RIS) = raw;
+  *HwSim_RegLookup(base + HWSIM_SSI_O_MIS) = raw & *HwSim_RegLookup(base + HWSIM_SSI_O_IM);
+}
+
+/* 
+  Description: This function shall complete the pending DATA accesses
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void HwSim_Commit(void)
+{
+  HwSim_GpioCommit();
+  HwSim_SsiCommit();
+}
+
+
+/* 
+  Description: This function shall return the simulated register behind an address
+  
+  Input: ui32Addr the physical register address
+  
+  Output: Address of the simulated register
+
+ */
+extern volatile u32 * HwSim_Reg(u32 ui32Addr)
+{
+  hwSimGpio_t * gpio;
+  u8 port;
+  u8 index;
+  
+  HwSim_Commit();
+  
+  port = HwSim_GpioPort(ui32Addr);
+  if ((port < HWSIM_GPIO_PORT_NUM) && ((ui32Addr & 0xFFF) < HWSIM_GPIO_O_DATA_END))
+  {
+    gpio = &hwSimCurrent->gpio[port];
+    gpio->windowMask = (u8)((ui32Addr & 0x3FC) >> 2);
+    gpio->window = HwSim_GpioLevels(port) & gpio->windowMask;
+    hwSimCurrent->gpioPending = port;
+    return &gpio->window;
+  }
+  if (port < HWSIM_GPIO_PORT_NUM)
+  {
+    switch (ui32Addr & 0xFFF)
+    {
+      case HWSIM_GPIO_O_ICR:
+        hwSimCurrent->gpio[port].icr = 0;
+        hwSimCurrent->icrPending = port;
+        return &hwSimCurrent->gpio[port].icr;
+      case HWSIM_GPIO_O_RIS:
+      case HWSIM_GPIO_O_MIS:
+        HwSim_GpioIntStatus(port);
+        break;
+      default:
+        break;
+    }
+  }
+  
+  index = HwSim_SsiIndex(ui32Addr);
+  if (index < HWSIM_SSI_NUM)
+  {
+    switch (ui32Addr & 0xFFF)
+    {
+      case HWSIM_SSI_O_DR:
+        hwSimCurrent->ssi[index].window = HWSIM_SSI_DR_IDLE;
+        hwSimCurrent->ssiPending = index;
+        return &hwSimCurrent->ssi[index].window;
+      case HWSIM_SSI_O_SR:
+      case HWSIM_SSI_O_RIS:
+      case HWSIM_SSI_O_MIS:
+        HwSim_SsiStatus(index);
+        break;
+      default:
+        break;
+    }
+  }
+  
+  return HwSim_RegLookup(ui32Addr);
+}
+
+/* 
+  Description: This function shall return the register file entry of an address
+  
+  Input: ui32Addr the physical register address
+  
+  Output: Address of the simulated register
+
+ */
+static volatile u32 * HwSim_RegLookup(u32 ui32Addr)
+{
+  /* Registers are word aligned, drop the low bits before hashing */
+  u32 slot = ((ui32Addr >> 2) * 2654435761UL) % HWSIM_REG_NUM;
+  u32 probes;
+  
+  for (probes = 0; probes < HWSIM_REG_NUM; probes++)
+  {
+    if (!hwSimCurrent->regs[slot].used)
+    {
+      hwSimCurrent->regs[slot].used = 1;
+      hwSimCurrent->regs[slot].addr = ui32Addr;
+      hwSimCurrent->regs[slot].value = 0;
+      return &hwSimCurrent->regs[slot].value;
+    }
+    if (hwSimCurrent->regs[slot].addr == ui32Addr)
+    {
+      return &hwSimCurrent->regs[slot].value;
+    }
+    slot = (slot + 1) % HWSIM_REG_NUM;
+  }
+  
+  fprintf(stderr, "hw_sim: register file full at 0x%08lX\n", (unsigned long)ui32Addr);
+  abort();
+}
+
+/* 
+  Description: This function shall return every register of the selected space
+  to its reset value
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void HwSim_Reset(void)
+{
+  u32 i;
+  
+  for (i = 0; i < HWSIM_REG_NUM; i++)
+  {
+    hwSimCurrent->regs[i].used = 0;
+  }
+  for (i = 0; i < HWSIM_GPIO_PORT_NUM; i++)
+  {
+    hwSimCurrent->gpio[i].latch = 0;
+    hwSimCurrent->gpio[i].external = 0;
+    hwSimCurrent->gpio[i].edges = 0;
+  }
+  memset(hwSimCurrent->ssi, 0, sizeof(hwSimCurrent->ssi));
+  hwSimCurrent->gpioPending = HWSIM_GPIO_PORT_NUM;
+  hwSimCurrent->icrPending = HWSIM_GPIO_PORT_NUM;
+  hwSimCurrent->ssiPending = HWSIM_SSI_NUM;
+}
+
+/* 
+  Description: This function shall apply levels from outside to input pins
+  
+  Input: 
+        1- ui32Port the port base address
+        2- ui8Pins the pins to drive
+        3- ui8Level 0 to pull the pins low, any other value to drive them high
+        
+  Output: void
+
+ */
+extern void HwSim_PinDrive(u32 ui32Port, u8 ui8Pins, u8 ui8Level)
+{
+  u8 port = HwSim_GpioPort(ui32Port);
+  hwSimGpio_t * gpio;
+  u8 before;
+  
+  if (port < HWSIM_GPIO_PORT_NUM)
+  {
+    HwSim_Commit();
+    gpio = &hwSimCurrent->gpio[port];
+    before = HwSim_GpioLevels(port);
+    gpio->external = ui8Level ? (gpio->external | ui8Pins) : (gpio->external & ~ui8Pins);
+    HwSim_GpioEdges(port, before, HwSim_GpioLevels(port));
+  }
+}
+
+/* 
+  Description: This function shall read the levels of the pins of a port, as
+  an external probe would see them
+  
+  Input: ui32Port the port base address
+  
+  Output: Pin levels, 0 for an unknown port
+
+ */
+extern u8 HwSim_PinGet(u32 ui32Port)
+{
+  u8 port = HwSim_GpioPort(ui32Port);
+  
+  HwSim_Commit();
+  return (port < HWSIM_GPIO_PORT_NUM) ? HwSim_GpioLevels(port) : 0;
+}
+
+/* 
+  Description: This function shall allocate a register space in reset state
+  
+  Input: void
+  
+  Output: The new space, 0 if out of memory
+
+ */
+extern hwSimSpace_t * HwSim_SpaceCreate(void)
+{
+  hwSimSpace_t * space = calloc(1, sizeof(hwSimSpace_t));
+  
+  if (space != 0)
+  {
+    space->gpioPending = HWSIM_GPIO_PORT_NUM;
+    space->icrPending = HWSIM_GPIO_PORT_NUM;
+    space->ssiPending = HWSIM_SSI_NUM;
+  }
+  return space;
+}
+
+/* 
+  Description: This function shall free a register space, it must not be
+  selected by any thread
+  
+  Input: space the space to free
+  
+  Output: void
+
+ */
+extern void HwSim_SpaceDestroy(hwSimSpace_t * space)
+{
+  free(space);
+}
+
+/* 
+  Description: This function shall direct the register accesses of the
+  calling thread to a space
+  
+  Input: space the space to use, 0 for the default space
+  
+  Output: void
+
+ */
+extern void HwSim_SpaceSelect(hwSimSpace_t * space)
+{
+  HwSim_Commit();
+  hwSimCurrent = (space != 0) ? space : &hwSimDefault;
+}
+
+/* 
+  Description: This function shall attach a chain of shift registers to an
+  SSI, its outputs all low
+  
+  Input: 
+        1- ui32Base the SSI base address
+        2- ui32LatchPort the port base address of the latch pin
+        3- ui8LatchPin the latch pin, the outputs update on its rising edge
+        4- ui16Bytes the number of 8 bit registers, at most HWSIM_SSI_CHAIN_MAX
+        
+  Output: void
+
+ */
+extern void HwSim_SsiChain(u32 ui32Base, u32 ui32LatchPort, u8 ui8LatchPin, u16 ui16Bytes)
+{
+  u8 index = HwSim_SsiIndex(ui32Base);
+  hwSimSsi_t * ssi;
+  
+  if (index < HWSIM_SSI_NUM)
+  {
+    ssi = &hwSimCurrent->ssi[index];
+    memset(ssi->chain, 0, sizeof(ssi->chain));
+    memset(ssi->outputs, 0, sizeof(ssi->outputs));
+    ssi->chainBytes = (ui16Bytes < HWSIM_SSI_CHAIN_MAX) ? ui16Bytes : HWSIM_SSI_CHAIN_MAX;
+    ssi->latchPort = HwSim_GpioPort(ui32LatchPort);
+    ssi->latchPin = ui8LatchPin;
+    ssi->latches = 0;
+  }
+}
+
+/* 
+  Description: This function shall shift frames out of the transmit FIFO of an
+  enabled SSI into its chain, first frame first
+  
+  Input: 
+        1- ui32Base the SSI base address
+        2- ui32Frames the most frames to shift
+        
+  Output: Number of frames shifted
+
+ */
+extern u32 HwSim_SsiShift(u32 ui32Base, u32 ui32Frames)
+{
+  u8 index = HwSim_SsiIndex(ui32Base);
+  hwSimSsi_t * ssi;
+  u32 shifted = 0;
+  
+  HwSim_Commit();
+  if ((index >= HWSIM_SSI_NUM) || ((*HwSim_RegLookup(ui32Base + HWSIM_SSI_O_CR1) & HWSIM_SSI_CR1_SSE) == 0))
+  {
+    return 0;
+  }
+  ssi = &hwSimCurrent->ssi[index];
+  while ((shifted < ui32Frames) && (ssi->fifoCount != 0))
+  {
+    if (ssi->chainBytes > 1)
+    {
+      memmove(&ssi->chain[1], &ssi->chain[0], ssi->chainBytes - 1);
+    }
+    ssi->chain[0] = ssi->fifo[ssi->fifoHead];
+    ssi->fifoHead = (ssi->fifoHead + 1) % HWSIM_SSI_FIFO_DEPTH;
+    ssi->fifoCount--;
+    shifted++;
+  }
+  return shifted;
+}
+
+/* 
+  Description: This function shall return a latched output of the chain of an
+  SSI, output 0 is the first output (QA) of the register next to the SSI
+  
+  Input: 
+        1- ui32Base the SSI base address
+        2- ui16Output the output index
+        
+  Output: Output level, 0 outside the chain
+
+ */
+extern u8 HwSim_SsiOutput(u32 ui32Base, u16 ui16Output)
+{
+  u8 index = HwSim_SsiIndex(ui32Base);
+  hwSimSsi_t * ssi;
+  
+  HwSim_Commit();
+  if (index >= HWSIM_SSI_NUM)
+  {
+    return 0;
+  }
+  ssi = &hwSimCurrent->ssi[index];
+  if ((ui16Output / 8) >= ssi->chainBytes)
+  {
+    return 0;
+  }
+  return (ssi->outputs[ui16Output / 8] >> (ui16Output % 8)) & 1;
+}
+
+/* 
+  Description: This function shall return how often the chain of an SSI was
+  latched since HwSim_SsiChain
+  
+  Input: ui32Base the SSI base address
+  
+  Output: Number of rising edges of the latch pin
+
+ */
+extern u32 HwSim_SsiLatches(u32 ui32Base)
+{
+  u8 index = HwSim_SsiIndex(ui32Base);
+  
+  HwSim_Commit();
+  return (index < HWSIM_SSI_NUM) ? hwSimCurrent->ssi[index].latches : 0;
+}
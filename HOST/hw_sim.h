@@ -0,0 +1,178 @@
+#ifndef HW_SIM_H
+#define HW_SIM_H
+
+/*
+  Simulated register space of the host build.
+
+  Every HWREG access of the drivers lands in a register file indexed by the
+  physical address. Registers are created on first access and read as 0
+  until written, which is the reset value of most TM4C123 registers.
+  
+  The DATA registers of GPIO ports A to F behave like the hardware: the
+  address masks the access, output pins follow the written value and input
+  pins read the levels applied with HwSim_PinDrive. Level changes of the
+  pins are latched as edges as IS, IBE and IEV select; RIS and MIS show
+  them (and the level sensitive pins at their level) until ICR clears
+  them. The GPIO interrupt is not raised by the model, the test program
+  calls the port handler while MIS is set.
+  
+  SSI0 to SSI3 have a transmit FIFO behind their DATA register and derive
+  SR (TFE, TNF, BSY), RIS and MIS (TXRIS, in FIFO level or end-of-
+  transmission mode) from it. Frames leave the FIFO only through
+  HwSim_SsiShift, into a chain of shift registers attached with
+  HwSim_SsiChain, which latches on the rising edge of a GPIO output. The
+  SSI interrupt is not raised by the model, the test program calls the
+  handler while MIS is set.
+*/
+
+/*
+  Register spaces. Every thread starts on a default space; a simulation of
+  several ECUs gives each one its own space and selects it before running
+  that ECU's code.
+*/
+typedef struct hwSimSpace hwSimSpace_t;
+
+/* Registers one register file can hold */
+#define HWSIM_REG_NUM   1024
+
+/* GPIO ports A to F on the APB aperture */
+#define HWSIM_GPIO_PORT_NUM  6
+
+/* SSI0 to SSI3, their transmit FIFO and the longest shift register chain */
+#define HWSIM_SSI_NUM        4
+#define HWSIM_SSI_FIFO_DEPTH 8
+#define HWSIM_SSI_CHAIN_MAX  64
+
+/* Reads of an SSI DATA register, no receive data is modelled */
+#define HWSIM_SSI_DR_IDLE    0xFFFFFFFF
+
+/* 
+  Description: This function shall return the simulated register behind an address
+  
+  Input: ui32Addr the physical register address
+  
+  Output: Address of the simulated register
+
+ */
+extern volatile u32 * HwSim_Reg(u32 ui32Addr);
+
+/* 
+  Description: This function shall return every register of the selected space
+  to its reset value
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void HwSim_Reset(void);
+
+/* 
+  Description: This function shall apply levels from outside to input pins
+  
+  Input: 
+        1- ui32Port the port base address
+        2- ui8Pins the pins to drive
+        3- ui8Level 0 to pull the pins low, any other value to drive them high
+        
+  Output: void
+
+ */
+extern void HwSim_PinDrive(u32 ui32Port, u8 ui8Pins, u8 ui8Level);
+
+/* 
+  Description: This function shall read the levels of the pins of a port, as
+  an external probe would see them
+  
+  Input: ui32Port the port base address
+  
+  Output: Pin levels, 0 for an unknown port
+
+ */
+extern u8 HwSim_PinGet(u32 ui32Port);
+
+/* 
+  Description: This function shall allocate a register space in reset state
+  
+  Input: void
+  
+  Output: The new space, 0 if out of memory
+
+ */
+extern hwSimSpace_t * HwSim_SpaceCreate(void);
+
+/* 
+  Description: This function shall free a register space, it must not be
+  selected by any thread
+  
+  Input: space the space to free
+  
+  Output: void
+
+ */
+extern void HwSim_SpaceDestroy(hwSimSpace_t * space);
+
+/* 
+  Description: This function shall direct the register accesses of the
+  calling thread to a space
+  
+  Input: space the space to use, 0 for the default space
+  
+  Output: void
+
+ */
+extern void HwSim_SpaceSelect(hwSimSpace_t * space);
+
+/* 
+  Description: This function shall attach a chain of shift registers to an
+  SSI, its outputs all low
+  
+  Input: 
+        1- ui32Base the SSI base address
+        2- ui32LatchPort the port base address of the latch pin
+        3- ui8LatchPin the latch pin, the outputs update on its rising edge
+        4- ui16Bytes the number of 8 bit registers, at most HWSIM_SSI_CHAIN_MAX
+        
+  Output: void
+
+ */
+extern void HwSim_SsiChain(u32 ui32Base, u32 ui32LatchPort, u8 ui8LatchPin, u16 ui16Bytes);
+
+/* 
+  Description: This function shall shift frames out of the transmit FIFO of an
+  enabled SSI into its chain, first frame first
+  
+  Input: 
+        1- ui32Base the SSI base address
+        2- ui32Frames the most frames to shift
+        
+  Output: Number of frames shifted
+
+ */
+extern u32 HwSim_SsiShift(u32 ui32Base, u32 ui32Frames);
+
+/* 
+  Description: This function shall return a latched output of the chain of an
+  SSI, output 0 is the first output (QA) of the register next to the SSI
+  
+  Input: 
+        1- ui32Base the SSI base address
+        2- ui16Output the output index
+        
+  Output: Output level, 0 outside the chain
+
+ */
+extern u8 HwSim_SsiOutput(u32 ui32Base, u16 ui16Output);
+
+/* 
+  Description: This function shall return how often the chain of an SSI was
+  latched since HwSim_SsiChain
+  
+  Input: ui32Base the SSI base address
+  
+  Output: Number of rising edges of the latch pin
+
+ */
+extern u32 HwSim_SsiLatches(u32 ui32Base);
+
+#endif
@@ -0,0 +1,153 @@
+/*
+  Lamp chain on the simulated SSI: the unmodified LampChain module and SSI
+  driver send frames into a simulated chain of shift registers, the test
+  steps the shifter frame by frame, calls the SSI interrupt while it is
+  asserted and checks the latched outputs and the interrupts per frame.
+
+  Build:
+    cc -DHOST_BUILD -ILIB -IMCAL -IECUAL -ISERVICES -IHOST -o lamp_chain_sim \
+       HOST/lamp_chain_sim.c HOST/hw_sim.c ECUAL/LampChain.c MCAL/ssi.c MCAL/gpio.c \
+       MCAL/sysctl.c MCAL/nvic.c SERVICES/Det.c SERVICES/ErrCnt.c
+  The shipped chain fits the transmit FIFO, so a frame takes one interrupt;
+  add -DLAMPCHAIN_OUTPUTS=200 to run the refill path with a longer chain.
+  Run: ./lamp_chain_sim, exits with 1 if a step does not give the expected result.
+*/
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "ssi.h"
+#include "Det_config.h"
+#include "LampChain.h"
+#include "LampChain_config.h"
+#include "hw_sim.h"
+
+/* Interrupts taken by a frame: the first FIFO load comes from the main loop */
+#define SIM_FRAME_INTS   ((LAMPCHAIN_BYTES + SSI_FIFO_DEPTH - 1) / SSI_FIFO_DEPTH)
+
+static u32 simInts;
+static u32 simFrames;
+static int failures;
+
+/* One main loop iteration, then the wire until the SSI falls quiet */
+static void simStep(void)
+{
+  LampChain_MainFunction();
+  for (;;)
+  {
+    if (HWREG(LAMPCHAIN_SSI_BASE + SSI_O_MIS) != 0)
+    {
+      SSI0_Handler();
+      simInts++;
+    }
+    else if (HwSim_SsiShift(LAMPCHAIN_SSI_BASE, 1) != 0)
+    {
+      simFrames++;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/* Expected level of an output for the patterns below */
+static u8 simPattern(u8 pattern, u16 output)
+{
+  switch (pattern)
+  {
+    case 0:  return 0;
+    case 1:  return 1;
+    case 2:  return (output % 2);
+    default: return ((output % 3) == 0);
+  }
+}
+
+static void expect(const char* step, u8 pattern, u32 latches, u32 ints, u32 frames)
+{
+  u16 wrong = 0;
+  u16 i;
+  int ok;
+
+  for (i = 0; i < LAMPCHAIN_OUTPUTS; i++)
+  {
+    wrong += (HwSim_SsiOutput(LAMPCHAIN_SSI_BASE, i) != simPattern(pattern, i));
+  }
+  ok = (wrong == 0) && (HwSim_SsiLatches(LAMPCHAIN_SSI_BASE) == latches) &&
+       (simInts == ints) && (simFrames == frames);
+  printf("%-44s outputs wrong %3u, latches %2lu, interrupts %3lu, frames %4lu %s\n", step, wrong,
+         (unsigned long)HwSim_SsiLatches(LAMPCHAIN_SSI_BASE), (unsigned long)simInts,
+         (unsigned long)simFrames, ok ? "" : "  <-- unexpected");
+  failures += !ok;
+}
+
+static void simSetPattern(u8 pattern)
+{
+  u16 i;
+
+  for (i = 0; i < LAMPCHAIN_OUTPUTS; i++)
+  {
+    LampChain_SetOutput(i, simPattern(pattern, i));
+  }
+}
+
+int main(void)
+{
+  u32 i;
+
+  HwSim_Reset();
+  HwSim_SsiChain(LAMPCHAIN_SSI_BASE, LAMPCHAIN_LATCH_PORT, LAMPCHAIN_LATCH_PIN, LAMPCHAIN_BYTES);
+  printf("%u outputs, %u bytes per frame\n", LAMPCHAIN_OUTPUTS, LAMPCHAIN_BYTES);
+
+  if (LampChain_Init() != ERR_STAT_OK)
+  {
+    printf("LampChain_Init failed\n");
+    return 1;
+  }
+  simStep();
+  expect("first frame clears the outputs", 0, 1, SIM_FRAME_INTS, LAMPCHAIN_BYTES);
+
+  simStep();
+  expect("clean buffer, nothing sent", 0, 1, SIM_FRAME_INTS, LAMPCHAIN_BYTES);
+
+  simSetPattern(1);
+  simStep();
+  expect("all outputs on in one frame", 1, 2, 2 * SIM_FRAME_INTS, 2 * LAMPCHAIN_BYTES);
+
+  simSetPattern(1);
+  simStep();
+  expect("same levels again, buffer stays clean", 1, 2, 2 * SIM_FRAME_INTS, 2 * LAMPCHAIN_BYTES);
+
+  /* Changed while the frame is on the wire: goes out with the next frame */
+  simSetPattern(2);
+  LampChain_MainFunction();
+  HwSim_SsiShift(LAMPCHAIN_SSI_BASE, 1);
+  simFrames++;
+  simSetPattern(3);
+  simStep();
+  expect("frame on the wire latches unchanged", 2, 3, 3 * SIM_FRAME_INTS, 3 * LAMPCHAIN_BYTES);
+  simStep();
+  expect("change during the frame follows", 3, 4, 4 * SIM_FRAME_INTS, 4 * LAMPCHAIN_BYTES);
+
+  /* Many changes between two loops still cost one frame */
+  for (i = 0; i < 10; i++)
+  {
+    simSetPattern((u8)(i % 4));
+  }
+  simSetPattern(0);
+  simStep();
+  expect("ten patterns, one frame", 0, 5, 5 * SIM_FRAME_INTS, 5 * LAMPCHAIN_BYTES);
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (LampChain_SetOutput(LAMPCHAIN_OUTPUTS, 1) == ERR_STAT_OK)
+  {
+    printf("output past the chain accepted  <-- unexpected\n");
+    failures++;
+  }
+#endif
+
+  printf("%d unexpected\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,300 @@
+/*
+  Gestures of the cabin button on the simulated pins: the unmodified SWITCH
+  module takes the edges of the button from the port F interrupt, which the
+  test calls while MIS is set, and recognises short, long and double
+  presses from its timer wheel timers. The test presses the button with and
+  without contact bounce, first reading the gestures itself and then
+  letting the cabin button component consume them, where the lamp pin shows
+  the result. Virtual time advances through the timer counter.
+
+  Build:
+    cc -DHOST_BUILD -ILIB -IMCAL -IECUAL -IAPP -IRTE -ISERVICES -IHOST -o switch_gesture_sim \
+       HOST/switch_gesture_sim.c HOST/hw_sim.c HOST/can_sim.c HOST/eeprom_sim.c \
+       $(find APP RTE ECUAL LIB SERVICES -name '*.c') \
+       MCAL/gpio.c MCAL/sysctl.c MCAL/nvic.c MCAL/uart.c MCAL/gpt.c MCAL/udma.c MCAL/ssi.c MCAL/dwt.c
+  Run: ./switch_gesture_sim, exits with 1 if a step does not give the expected result.
+*/
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "dwt.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Lamp.h"
+#include "Lamp_config.h"
+#include "can.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "TimerWheel_config.h"
+#include "doorDimmer.h"
+#include "hw_sim.h"
+
+#define SIM_CYCLES_PER_MS  (SYSCTL_MAIN_OSCILLATOR_HZ / 1000)
+#define SIM_STEP_CYCLES    (SIM_CYCLES_PER_MS / 10)
+
+/*
+  Contact bounce: level changes this far apart, shorter than the settle time.
+  A worn contact bounces slowly, its burst lasts longer than the settle time.
+*/
+#define SIM_BOUNCE_STEPS   3
+#define SIM_BOUNCES        4
+#define SIM_SLOW_STEPS     70
+#define SIM_SLOW_BOUNCES   6
+
+/* Long enough for every gesture of the button to end */
+#define SIM_QUIET_MS       (SWITCH_CABIN_LONG_MS + SWITCH_CABIN_DOUBLE_MS + 100)
+
+static u32 simTime;
+static u32 simMs;
+static u8 simApp;
+static int failures;
+
+static const char * const simGestureName[] = {"none", "SHORT", "LONG", "DOUBLE"};
+
+/*
+  The timer match interrupt fires when the counter passes the match value, or
+  when the timer wheel pended it for a match already in the past
+*/
+static void simTimerUpdate(u32 previous, u32 now)
+{
+  u32 match;
+
+  HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAV) = now;
+  if (HWREG(NVIC_PEND0) & (1UL << NVIC_INT_TIMER0A))
+  {
+    HWREG(NVIC_PEND0) &= ~(1UL << NVIC_INT_TIMER0A);
+    TIMER0A_Handler();
+  }
+  if ((HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_IMR) & TIMER_INT_TAM) == 0)
+  {
+    return;
+  }
+  match = HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAMATCHR);
+  if ((u32)(match - previous - 1) < (u32)(now - previous))
+  {
+    HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_MIS) = TIMER_INT_TAM;
+    TIMER0A_Handler();
+  }
+}
+
+/* The button sits on port F, whose interrupt runs while an edge is pending */
+static void simGpioUpdate(void)
+{
+  while (HWREG(SWITCH_CABIN_PORT + GPIO_O_MIS))
+  {
+    GPIOF_Handler();
+  }
+}
+
+/* Steps of 0.1 ms, the main loop runs once per millisecond when simApp is set */
+static void simRunSteps(u32 steps)
+{
+  while (steps--)
+  {
+    simGpioUpdate();
+    simTimerUpdate(simTime, simTime + SIM_STEP_CYCLES);
+    simTime += SIM_STEP_CYCLES;
+    HWREG(DWT_CYCCNT) = simTime;
+    if ((simTime % SIM_CYCLES_PER_MS) == 0)
+    {
+      simMs++;
+      if (simApp)
+      {
+        DoorDimmer_Schedule();
+      }
+    }
+  }
+}
+
+static void simRunMs(u32 ms)
+{
+  simRunSteps(ms * 10);
+}
+
+/* Pin level of a switch, following its pull */
+static void simSwitch(u8 switchNum, u8 pressed)
+{
+  switchmap_t * switchMapElement = getSwitchMap(switchNum);
+
+  if (GPIO_PIN_TYPE_STD_WPU == switchMapElement->pullState)
+  {
+    pressed = !pressed;
+  }
+  HwSim_PinDrive(switchMapElement->port, switchMapElement->pin, pressed);
+  simGpioUpdate();
+}
+
+/* The button reaches a level after a number of bounces, steps apart */
+static void simBounce(u8 pressed, u8 bounces, u32 steps)
+{
+  while (bounces--)
+  {
+    simSwitch(SWITCH_CABIN, pressed);
+    simRunSteps(steps);
+    simSwitch(SWITCH_CABIN, !pressed);
+    simRunSteps(steps);
+  }
+  simSwitch(SWITCH_CABIN, pressed);
+}
+
+static void simButton(u8 pressed, u8 bounces)
+{
+  simBounce(pressed, bounces, SIM_BOUNCE_STEPS);
+}
+
+/* A press held for a time, followed by a release */
+static void simPress(u32 holdMs, u8 bounces)
+{
+  simButton(1, bounces);
+  simRunMs(holdMs);
+  simButton(0, bounces);
+}
+
+static u8 simLampLevel(void)
+{
+  lampmap_t * lampMapElement = getLampMap(Lamp_DIMMER);
+
+  return ((HwSim_PinGet(lampMapElement->port) & lampMapElement->pin) ==
+          (lampMapElement->ON & lampMapElement->pin)) ? LAMP_ON : LAMP_OFF;
+}
+
+/* The gestures queued since the last check must be the expected ones, in order */
+static void expectGestures(const char* step, u8 first, u8 second)
+{
+  u8 got[2] = {0, 0};
+  u8 count = 0;
+  u8 switchNum;
+  u8 gesture;
+  int ok = 1;
+
+  while (Switch_GetGesture(&switchNum, &gesture) == ERR_STAT_OK)
+  {
+    ok &= (switchNum == SWITCH_CABIN) && (count < 2);
+    if (count < 2)
+    {
+      got[count] = gesture;
+    }
+    count++;
+  }
+  ok &= (got[0] == first) && (got[1] == second);
+  printf("%5lu ms  %-44s %-6s %-6s%s\n", (unsigned long)simMs, step,
+         simGestureName[got[0] & 3], simGestureName[got[1] & 3], ok ? "" : "  <-- unexpected");
+  failures += !ok;
+}
+
+static void expectLamp(const char* step, u8 lamp)
+{
+  int ok = (simLampLevel() == lamp);
+
+  printf("%5lu ms  %-44s lamp %-3s%s\n", (unsigned long)simMs, step,
+         (simLampLevel() == LAMP_ON) ? "ON" : "OFF", ok ? "" : "  <-- unexpected");
+  failures += !ok;
+}
+
+int main(void)
+{
+  u16 count = 0;
+
+  HwSim_Reset();
+  /* Doors shut, button released */
+  simSwitch(getDoorMap(DOOR_LEFT)->switchNum, 1);
+  simSwitch(getDoorMap(DOOR_RIGHT)->switchNum, 1);
+  simSwitch(SWITCH_CABIN, 0);
+  DoorDimmer_Init();
+  simRunMs(100);
+  expectGestures("button untouched", 0, 0);
+
+  /* The engine alone, the test reads the gestures */
+  simPress(150, 0);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("short press", SWITCH_GESTURE_SHORT, 0);
+
+  simPress(150, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("short press with bounce", SWITCH_GESTURE_SHORT, 0);
+
+  simBounce(1, SIM_SLOW_BOUNCES, SIM_SLOW_STEPS);
+  simRunMs(150);
+  simBounce(0, SIM_SLOW_BOUNCES, SIM_SLOW_STEPS);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("short press with slow bounce", SWITCH_GESTURE_SHORT, 0);
+
+  simPress(SWITCH_CABIN_LONG_MS - 100, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("press just short of long", SWITCH_GESTURE_SHORT, 0);
+
+  simButton(1, SIM_BOUNCES);
+  simRunMs(SWITCH_CABIN_LONG_MS + SWITCH_CABIN_SETTLE_MS + 10);
+  expectGestures("long press, still held", SWITCH_GESTURE_LONG, 0);
+  simRunMs(1000);
+  simButton(0, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("long press released", 0, 0);
+
+  simPress(80, SIM_BOUNCES);
+  simRunMs(SWITCH_CABIN_DOUBLE_MS - 150);
+  simPress(80, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("double press", SWITCH_GESTURE_DOUBLE, 0);
+
+  simPress(80, SIM_BOUNCES);
+  simRunMs(SWITCH_CABIN_DOUBLE_MS + 100);
+  simPress(80, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("two presses slower than double", SWITCH_GESTURE_SHORT, SWITCH_GESTURE_SHORT);
+
+  /* Glitches that end at the released level */
+  simButton(0, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("bounce only", 0, 0);
+
+  simBounce(0, SIM_SLOW_BOUNCES, SIM_SLOW_STEPS);
+  simRunMs(SIM_QUIET_MS);
+  expectGestures("slow bounce only", 0, 0);
+
+  /* The cabin button component consumes the gestures */
+  simApp = 1;
+  simRunMs(100);
+  expectLamp("doors shut", LAMP_OFF);
+
+  simButton(1, SIM_BOUNCES);
+  simRunMs(SWITCH_CABIN_LONG_MS + 100);
+  simButton(0, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectLamp("long press forces the lamp on", LAMP_ON);
+
+  simPress(150, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectLamp("short press back to automatic", LAMP_OFF);
+
+  simSwitch(getDoorMap(DOOR_LEFT)->switchNum, 0);
+  simRunMs(200);
+  expectLamp("left door opened", LAMP_ON);
+
+  simPress(80, SIM_BOUNCES);
+  simRunMs(SWITCH_CABIN_DOUBLE_MS - 150);
+  simPress(80, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectLamp("double press turns the door trigger off", LAMP_OFF);
+
+  simPress(150, SIM_BOUNCES);
+  simRunMs(SIM_QUIET_MS);
+  expectLamp("short press back to automatic", LAMP_ON);
+
+  simSwitch(getDoorMap(DOOR_LEFT)->switchNum, 1);
+  simRunMs(200);
+  expectLamp("left door shut", LAMP_OFF);
+
+  ErrCnt_Get(MODULE_ID_SWITCH, &count);
+  printf("%5lu ms  %-44s %u%s\n", (unsigned long)simMs, "switch errors", count, (count == 0) ? "" : "  <-- unexpected");
+  failures += (count != 0);
+
+  printf("%d unexpected\n", failures);
+  return failures ? 1 : 0;
+}
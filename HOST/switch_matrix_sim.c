@@ -0,0 +1,211 @@
+/*
+  Switch matrix on the simulated pins: the unmodified SWITCH module scans a
+  matrix without diodes from its timer wheel timer, while the test presses
+  keys and recomputes the column levels from the rows the ECU drives. A
+  column reads low when a path of pressed keys connects it to a driven row,
+  so three keys on the corners of a rectangle produce the phantom fourth
+  like the real wiring. Virtual time advances through the timer counter.
+
+  Build:
+    cc -DHOST_BUILD -ILIB -IMCAL -IECUAL -ISERVICES -IHOST -o switch_matrix_sim \
+       HOST/switch_matrix_sim.c HOST/hw_sim.c ECUAL/SWITCH.c ECUAL/SWITCH_config.c \
+       MCAL/gpio.c MCAL/sysctl.c MCAL/nvic.c MCAL/gpt.c SERVICES/Det.c \
+       SERVICES/ErrCnt.c SERVICES/TimerWheel.c
+  Run: ./switch_matrix_sim, exits with 1 if a step does not give the expected state.
+*/
+#include <stdio.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "TimerWheel.h"
+#include "TimerWheel_config.h"
+#include "hw_sim.h"
+
+#define SIM_CYCLES_PER_MS  (SYSCTL_MAIN_OSCILLATOR_HZ / 1000)
+#define SIM_STEP_CYCLES    (SIM_CYCLES_PER_MS / 10)
+
+/* Both door switches on the matrix: row 0 column PE0, row 2 column PE1 */
+static const switchmap_t simMatrix[SWITCH_NUM] = {
+  {GPIO_PIN_0, SWITCH_MATRIX_COLUMN_PORT, 0, SWITCH_SOURCE_MATRIX, 0},
+  {GPIO_PIN_1, SWITCH_MATRIX_COLUMN_PORT, 0, SWITCH_SOURCE_MATRIX, 2},
+  {SWITCH_CABIN_PIN, SWITCH_CABIN_PORT, SWITCH_CABIN_PULL_STATE, SWITCH_CABIN_SOURCE, SWITCH_CABIN_ROW}
+};
+
+/* Pressed keys, fitted or not: column pins per row */
+static u8 simKeys[SWITCH_MATRIX_ROW_NUM];
+static u8 simRowPin[SWITCH_MATRIX_ROW_NUM];
+static u32 simTime;
+static u32 simMs;
+static int failures;
+
+/* Column levels from the driven rows and the pressed keys */
+static void simColumns(void)
+{
+  u8 rows = HwSim_PinGet(SWITCH_MATRIX_ROW_PORT);
+  u8 lowRows = 0;
+  u8 lowColumns = 0;
+  u8 previousRows;
+  u8 previousColumns;
+  u8 i;
+
+  for (i = 0; i < SWITCH_MATRIX_ROW_NUM; i++)
+  {
+    if ((rows & simRowPin[i]) == 0)
+    {
+      lowRows |= (u8)(1 << i);
+    }
+  }
+  /* Spread the low level through the pressed keys until nothing changes */
+  do
+  {
+    previousRows = lowRows;
+    previousColumns = lowColumns;
+    for (i = 0; i < SWITCH_MATRIX_ROW_NUM; i++)
+    {
+      if (lowRows & (1 << i))
+      {
+        lowColumns |= simKeys[i];
+      }
+      if (simKeys[i] & lowColumns)
+      {
+        lowRows |= (u8)(1 << i);
+      }
+    }
+  }
+  while ((lowRows != previousRows) || (lowColumns != previousColumns));
+
+  HwSim_PinDrive(SWITCH_MATRIX_COLUMN_PORT, SWITCH_MATRIX_COLUMN_PINS & ~lowColumns, 1);
+  HwSim_PinDrive(SWITCH_MATRIX_COLUMN_PORT, lowColumns, 0);
+}
+
+/*
+  The timer match interrupt fires when the counter passes the match value, or
+  when the timer wheel pended it for a match already in the past
+*/
+static void simTimerUpdate(u32 previous, u32 now)
+{
+  u32 match;
+
+  HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAV) = now;
+  if (HWREG(NVIC_PEND0) & (1UL << NVIC_INT_TIMER0A))
+  {
+    HWREG(NVIC_PEND0) &= ~(1UL << NVIC_INT_TIMER0A);
+    TIMER0A_Handler();
+  }
+  if ((HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_IMR) & TIMER_INT_TAM) == 0)
+  {
+    return;
+  }
+  match = HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAMATCHR);
+  if ((u32)(match - previous - 1) < (u32)(now - previous))
+  {
+    HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_MIS) = TIMER_INT_TAM;
+    TIMER0A_Handler();
+  }
+}
+
+static void simRunMs(u32 ms)
+{
+  u32 end = simTime + (ms * SIM_CYCLES_PER_MS);
+
+  while (simTime != end)
+  {
+    simColumns();
+    simTimerUpdate(simTime, simTime + SIM_STEP_CYCLES);
+    simTime += SIM_STEP_CYCLES;
+  }
+  simMs += ms;
+}
+
+static void simKey(u8 row, u8 column, u8 pressed)
+{
+  simKeys[row] = pressed ? (simKeys[row] | column) : (simKeys[row] & ~column);
+}
+
+static void expect(const char* step, u8 left, u8 right, u16 ghosts)
+{
+  u8 state[SWITCH_NUM];
+  u16 count = 0;
+  u8 i;
+  int ok;
+
+  for (i = 0; i < SWITCH_NUM; i++)
+  {
+    Switch_GetSwitchState(i, &state[i]);
+  }
+  ErrCnt_Get(MODULE_ID_SWITCH, &count);
+  ok = (state[0] == left) && (state[1] == right) && (count == ghosts);
+  printf("%5lu ms  %-44s switch 0: %-8s switch 1: %-8s ghosts %u%s\n", (unsigned long)simMs, step,
+         (state[0] == PRESSED) ? "PRESSED" : "RELEASED", (state[1] == PRESSED) ? "PRESSED" : "RELEASED",
+         count, ok ? "" : "  <-- unexpected");
+  failures += !ok;
+}
+
+int main(void)
+{
+  u8 pin;
+  u8 i = 0;
+
+  for (pin = 1; pin != 0; pin <<= 1)
+  {
+    if (SWITCH_MATRIX_ROW_PINS & pin)
+    {
+      simRowPin[i++] = pin;
+    }
+  }
+
+  HwSim_Reset();
+  setSwitchMap(simMatrix);
+  if ((TimerWheel_Init() != ERR_STAT_OK) || (Switch_Init(0) != ERR_STAT_OK) || (Switch_Init(1) != ERR_STAT_OK))
+  {
+    printf("init failed\n");
+    return 1;
+  }
+
+  simRunMs(10);
+  expect("nothing pressed", RELEASED, RELEASED, 0);
+
+  simKey(0, GPIO_PIN_0, 1);
+  simRunMs(10);
+  expect("switch 0 pressed", PRESSED, RELEASED, 0);
+
+  simKey(2, GPIO_PIN_1, 1);
+  simRunMs(10);
+  expect("switch 1 pressed too", PRESSED, PRESSED, 0);
+
+  simKey(0, GPIO_PIN_0, 0);
+  simRunMs(10);
+  expect("switch 0 released", RELEASED, PRESSED, 0);
+
+  /* Row 0 column PE1 has no switch fitted, its key closes the rectangle */
+  simKey(0, GPIO_PIN_0, 1);
+  simKey(0, GPIO_PIN_1, 1);
+  simRunMs(10);
+  expect("rectangle: rows keep their state", RELEASED, PRESSED, 1);
+
+  simRunMs(50);
+  expect("rectangle held, reported once", RELEASED, PRESSED, 1);
+
+  simKey(0, GPIO_PIN_1, 0);
+  simRunMs(10);
+  expect("rectangle gone, switch 0 resolved", PRESSED, PRESSED, 1);
+
+  simKey(0, GPIO_PIN_1, 1);
+  simRunMs(10);
+  expect("second rectangle, reported again", PRESSED, PRESSED, 2);
+
+  simKeys[0] = 0;
+  simKeys[2] = 0;
+  simRunMs(10);
+  expect("all released", RELEASED, RELEASED, 2);
+
+  printf("%d unexpected\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,178 @@
+/*
+  Host side decoder of the telemetry stream sent on the ECU serial port.
+
+  Reads a captured byte stream from a file (or stdin), splits it on the COBS
+  delimiter, validates every record and prints one line per record followed
+  by a summary of corrupted frames and records lost to sequence gaps.
+
+  Build: cc -ILIB -ISERVICES -o telemetry_decode HOST/telemetry_decode.c LIB/COBS.c LIB/CRC8.c
+  Usage: telemetry_decode [capture.bin] [clock_hz]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "STD_TYPES.h"
+#include "COBS.h"
+#include "CRC8.h"
+#include "Telemetry.h"
+
+#define DECODE_DEFAULT_CLOCK_HZ 16000000UL
+
+/* Longest encoded frame accepted before the buffer is treated as garbage */
+#define DECODE_BUFFER_SIZE      256
+
+typedef struct
+{
+  unsigned long records;
+  unsigned long malformed;
+  unsigned long crcErrors;
+  unsigned long lost;
+  int haveSequence;
+  u8 nextSequence;
+} decodeStats_t;
+
+static u32 getU32(const u8* p)
+{
+  return (u32)p[0] | ((u32)p[1] << 8) | ((u32)p[2] << 16) | ((u32)p[3] << 24);
+}
+
+static void printRecord(const u8* rec, u16 len, double clockHz)
+{
+  const u8* payload = &rec[TELEMETRY_HEADER_LEN];
+  u16 payloadLen = len - TELEMETRY_HEADER_LEN - 1;
+  double seconds = (double)getU32(&rec[2]) / clockHz;
+
+  printf("%3u %12.6f ", rec[1], seconds);
+  switch (rec[0])
+  {
+    case TELEMETRY_REC_DOOR_EDGE:
+      if (payloadLen >= 2)
+      {
+        printf("DOOR  door=%u %s\n", payload[0], payload[1] ? "CLOSED" : "OPENED");
+        return;
+      }
+      break;
+
+    case TELEMETRY_REC_LAMP_STATE:
+      if (payloadLen >= 2)
+      {
+        printf("LAMP  lamp=%u %s\n", payload[0], payload[1] ? "ON" : "OFF");
+        return;
+      }
+      break;
+
+    case TELEMETRY_REC_DIAG_RESPONSE:
+      printf("DIAG ");
+      while (payloadLen--)
+      {
+        printf(" %02X", *payload++);
+      }
+      printf("\n");
+      return;
+
+    case TELEMETRY_REC_PERF:
+      if (payloadLen >= 14)
+      {
+        printf("PERF  loops=%lu min=%lu max=%lu cycles dropped=%u\n",
+               (unsigned long)getU32(&payload[0]), (unsigned long)getU32(&payload[4]),
+               (unsigned long)getU32(&payload[8]), payload[12] | (payload[13] << 8));
+        return;
+      }
+      break;
+  }
+
+  /* Unknown or short record, dump it raw */
+  printf("REC%02X", rec[0]);
+  while (payloadLen--)
+  {
+    printf(" %02X", *payload++);
+  }
+  printf("\n");
+}
+
+static void decodeFrame(const u8* enc, u16 len, decodeStats_t* stats, double clockHz)
+{
+  u8 rec[DECODE_BUFFER_SIZE];
+  u16 recLen;
+
+  if (len == 0)
+  {
+    return;
+  }
+  if ((COBS_Decode(enc, len, rec, &recLen) != ERR_STAT_OK) ||
+      (recLen < TELEMETRY_HEADER_LEN + 1))
+  {
+    stats->malformed++;
+    return;
+  }
+  if (CRC8_Update(CRC8_INIT, rec, recLen - 1) != rec[recLen - 1])
+  {
+    stats->crcErrors++;
+    return;
+  }
+
+  if (stats->haveSequence && (rec[1] != stats->nextSequence))
+  {
+    stats->lost += (u8)(rec[1] - stats->nextSequence);
+  }
+  stats->haveSequence = 1;
+  stats->nextSequence = (u8)(rec[1] + 1);
+  stats->records++;
+
+  printRecord(rec, recLen, clockHz);
+}
+
+int main(int argc, char** argv)
+{
+  FILE* in = stdin;
+  double clockHz = DECODE_DEFAULT_CLOCK_HZ;
+  decodeStats_t stats = {0};
+  u8 enc[DECODE_BUFFER_SIZE];
+  u16 encLen = 0;
+  int overflow = 0;
+  int c;
+
+  if ((argc > 1) && ((in = fopen(argv[1], "rb")) == NULL))
+  {
+    perror(argv[1]);
+    return 1;
+  }
+  if (argc > 2)
+  {
+    clockHz = atof(argv[2]);
+  }
+
+  while ((c = fgetc(in)) != EOF)
+  {
+    if (c == COBS_DELIMITER)
+    {
+      if (overflow)
+      {
+        stats.malformed++;
+      }
+      else
+      {
+        decodeFrame(enc, encLen, &stats, clockHz);
+      }
+      encLen = 0;
+      overflow = 0;
+    }
+    else if (encLen < DECODE_BUFFER_SIZE)
+    {
+      enc[encLen++] = (u8)c;
+    }
+    else
+    {
+      overflow = 1;
+    }
+  }
+
+  fprintf(stderr, "records=%lu malformed=%lu crc_errors=%lu lost=%lu\n",
+          stats.records, stats.malformed, stats.crcErrors, stats.lost);
+
+  if (in != stdin)
+  {
+    fclose(in);
+  }
+  return 0;
+}
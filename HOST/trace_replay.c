@@ -0,0 +1,430 @@
+/*
+  Replay of an input trace recorded on an ECU (SERVICES/Trace.h) through the
+  unmodified application and drivers. The recorded pin states are applied to
+  the simulated switch port, so GPIO_PinRead returns exactly the recorded
+  sequence; the main loop runs at every recorded change and every loop
+  period in between, with virtual time in the DWT cycle counter and the
+  timer counter like HOST/door_sim.c.
+
+  The input is either the raw trace (door_sim -o) or, with -c, a capture of
+  the telemetry stream holding the DIAG_SID_READ_MEMORY_BY_ADDRESS responses
+  of a read out (see diag_request trace).
+
+  Build:
+    cc -O2 -DHOST_BUILD -ILIB -IMCAL -IECUAL -IAPP -IRTE -ISERVICES -IHOST -o trace_replay \
+       HOST/trace_replay.c HOST/hw_sim.c HOST/can_sim.c HOST/eeprom_sim.c \
+       $(find APP RTE ECUAL LIB SERVICES -name '*.c') \
+       MCAL/gpio.c MCAL/sysctl.c MCAL/nvic.c MCAL/uart.c MCAL/gpt.c MCAL/udma.c MCAL/ssi.c MCAL/dwt.c
+  Run:
+    ./trace_replay [-l loop_us] [-p] [-v] [-c] file
+      -p  print the decoded records
+      -v  print every door and lamp change of the replay
+      -c  file is a telemetry capture of the read out
+  Prints the door and lamp activity, the host time spent per main loop, and
+  whether the firmware recorded the same trace again during the replay.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "dwt.h"
+#include "COBS.h"
+#include "CRC8.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Lamp.h"
+#include "Lamp_config.h"
+#include "can.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "TimerWheel_config.h"
+#include "Telemetry.h"
+#include "Diag.h"
+#include "Trace.h"
+#include "Trace_config.h"
+#include "doorDimmer.h"
+#include "hw_sim.h"
+
+#define REPLAY_CYCLES_PER_US   (SYSCTL_MAIN_OSCILLATOR_HZ / 1000000)
+#define REPLAY_FILE_MAX        (1UL << 20)
+
+typedef unsigned long long replayTime_t;
+
+typedef struct
+{
+  replayTime_t t;
+  u8 state;
+} replayRecord_t;
+
+static u32 replayLoopUs = 50;
+static u8 replayPrint;
+static u8 replayVerbose;
+
+
+static u32 replayGetU16(const u8 * p)
+{
+  return ((u32)p[0] << 8) | p[1];
+}
+
+/*
+  Rebuilds the trace from the ReadMemoryByAddress responses of a telemetry
+  capture, returns its length or -1 when bytes are missing.
+*/
+static long replayFromCapture(const u8 * capture, long captureLen, u8 * trace)
+{
+  static u8 seen[REPLAY_FILE_MAX];
+  u8 rec[COBS_ENCODED_MAX(TELEMETRY_FRAME_MAX)];
+  const u8 * payload;
+  long start = 0;
+  long length = 0;
+  long end;
+  long i;
+  u16 recLen;
+  u32 offset;
+  u32 n;
+
+  memset(seen, 0, sizeof(seen));
+  for (end = 0; end < captureLen; end++)
+  {
+    if (capture[end] != COBS_DELIMITER)
+    {
+      continue;
+    }
+    if (((end - start) <= (long)sizeof(rec)) &&
+        (COBS_Decode(&capture[start], (u16)(end - start), rec, &recLen) == ERR_STAT_OK) &&
+        (recLen > TELEMETRY_HEADER_LEN + 3) &&
+        (CRC8_Update(CRC8_INIT, rec, recLen - 1) == rec[recLen - 1]) &&
+        (rec[0] == TELEMETRY_REC_DIAG_RESPONSE))
+    {
+      payload = &rec[TELEMETRY_HEADER_LEN];
+      n = recLen - TELEMETRY_HEADER_LEN - 1;
+      if (payload[0] == (DIAG_SID_READ_MEMORY_BY_ADDRESS + DIAG_POSITIVE_OFFSET))
+      {
+        offset = replayGetU16(&payload[1]);
+        for (i = 3; (i < (long)n) && ((offset + i - 3) < (long)REPLAY_FILE_MAX); i++)
+        {
+          trace[offset + i - 3] = payload[i];
+          seen[offset + i - 3] = 1;
+        }
+        if ((long)(offset + n - 3) > length)
+        {
+          length = offset + n - 3;
+        }
+      }
+    }
+    start = end + 1;
+  }
+
+  for (i = 0; i < length; i++)
+  {
+    if (!seen[i])
+    {
+      fprintf(stderr, "trace byte %ld missing from the capture\n", i);
+      return -1;
+    }
+  }
+  return length;
+}
+
+/* Decodes the records, times count from the oldest one */
+static long replayDecode(const u8 * trace, long length, replayRecord_t * records)
+{
+  replayTime_t t = 0;
+  long num = 0;
+  long i = 0;
+  u32 delta;
+  u8 state;
+  u8 recordLength;
+
+  while (i < length)
+  {
+    if (Trace_DecodeRecord(&trace[i], (u16)(((length - i) > TRACE_RECORD_MAX_LEN) ? TRACE_RECORD_MAX_LEN : (length - i)),
+                           &delta, &state, &recordLength) != ERR_STAT_OK)
+    {
+      fprintf(stderr, "malformed record at byte %ld\n", i);
+      return -1;
+    }
+    /* The delta of the oldest record refers to a dropped one */
+    t += (num == 0) ? 0 : delta;
+    records[num].t = t;
+    records[num].state = state;
+    num++;
+    i += recordLength;
+  }
+  return num;
+}
+
+/* Puts a recorded state on the traced pins */
+static void replayApply(u8 state)
+{
+  u8 pin;
+
+  for (pin = 1; pin != 0; pin <<= 1)
+  {
+    if (TRACE_PINS & pin)
+    {
+      HwSim_PinDrive(TRACE_PORT, pin, (state & pin) != 0);
+    }
+  }
+}
+
+static u8 replayLampLevel(void)
+{
+  lampmap_t * lampMapElement = getLampMap(Lamp_DIMMER);
+
+  return ((HwSim_PinGet(lampMapElement->port) & lampMapElement->pin) ==
+          (lampMapElement->ON & lampMapElement->pin)) ? LAMP_ON : LAMP_OFF;
+}
+
+/*
+  The timer match interrupt fires when the counter passes the match value, or
+  when the timer wheel pended it for a match already in the past
+*/
+static void replayTimerUpdate(u32 previous, u32 now)
+{
+  u32 match;
+
+  HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAV) = now;
+  if (HWREG(NVIC_PEND0) & (1UL << NVIC_INT_TIMER0A))
+  {
+    HWREG(NVIC_PEND0) &= ~(1UL << NVIC_INT_TIMER0A);
+    TIMER0A_Handler();
+  }
+  if ((HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_IMR) & TIMER_INT_TAM) == 0)
+  {
+    return;
+  }
+  match = HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_TAMATCHR);
+  if ((u32)(match - previous - 1) < (u32)(now - previous))
+  {
+    HWREG(TIMERWHEEL_GPT_BASE + TIMER_O_MIS) = TIMER_INT_TAM;
+    TIMER0A_Handler();
+  }
+}
+
+static double replayNow(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Skips the first record, its delta depends on what was dropped before it */
+static long replayCompare(const u8 * a, long aLen, const u8 * b, long bLen)
+{
+  u32 delta;
+  u8 state;
+  u8 aFirst, bFirst;
+  long i;
+
+  if ((Trace_DecodeRecord(a, (u16)((aLen > TRACE_RECORD_MAX_LEN) ? TRACE_RECORD_MAX_LEN : aLen), &delta, &state, &aFirst) != ERR_STAT_OK) ||
+      (Trace_DecodeRecord(b, (u16)((bLen > TRACE_RECORD_MAX_LEN) ? TRACE_RECORD_MAX_LEN : bLen), &delta, &state, &bFirst) != ERR_STAT_OK))
+  {
+    return 0;
+  }
+  for (i = 0; ((aFirst + i) < aLen) && ((bFirst + i) < bLen); i++)
+  {
+    if (a[aFirst + i] != b[bFirst + i])
+    {
+      return aFirst + i;
+    }
+  }
+  return ((aLen - aFirst) == (bLen - bFirst)) ? -1 : (aFirst + i);
+}
+
+static int replayRun(const u8 * trace, long length, const replayRecord_t * records, long num)
+{
+  replayTime_t loopCycles = (replayTime_t)replayLoopUs * REPLAY_CYCLES_PER_US;
+  replayTime_t end = records[num - 1].t + SYSCTL_MAIN_OSCILLATOR_HZ;
+  replayTime_t t = 0;
+  replayTime_t previous = 0;
+  traceInfo_t info;
+  u8 * again;
+  u32 doorChanges[DOOR_NUM] = {0};
+  u32 lampToggles = 0;
+  u32 loops = 0;
+  double loopMin = 1e9, loopMax = 0, loopSum = 0, before, spent;
+  long next = 1;
+  long differs;
+  u8 lastDoor[DOOR_NUM];
+  u8 lastLamp;
+  u8 door, state;
+
+  HwSim_Reset();
+  replayApply(records[0].state);
+  DoorDimmer_Init();
+  lastLamp = replayLampLevel();
+  for (door = 0; door < DOOR_NUM; door++)
+  {
+    Door_GetStatus(door, &lastDoor[door]);
+  }
+
+  for (;;)
+  {
+    replayTimerUpdate((u32)previous, (u32)t);
+    HWREG(DWT_CYCCNT) = (u32)t;
+
+    before = replayNow();
+    DoorDimmer_Schedule();
+    spent = replayNow() - before;
+    loopSum += spent;
+    loopMin = (spent < loopMin) ? spent : loopMin;
+    loopMax = (spent > loopMax) ? spent : loopMax;
+    loops++;
+
+    for (door = 0; door < DOOR_NUM; door++)
+    {
+      Door_GetStatus(door, &state);
+      if (state != lastDoor[door])
+      {
+        doorChanges[door]++;
+        lastDoor[door] = state;
+        if (replayVerbose)
+        {
+          printf("%14.6f s  door %u %s\n", (double)t / SYSCTL_MAIN_OSCILLATOR_HZ, door,
+                 (state == DOOR_CLOSED) ? "CLOSED" : "OPENED");
+        }
+      }
+    }
+    state = replayLampLevel();
+    if (state != lastLamp)
+    {
+      lampToggles++;
+      lastLamp = state;
+      if (replayVerbose)
+      {
+        printf("%14.6f s  lamp %s\n", (double)t / SYSCTL_MAIN_OSCILLATOR_HZ, (state == LAMP_ON) ? "ON" : "OFF");
+      }
+    }
+
+    /* Next loop, earlier when a recorded change comes first */
+    previous = t;
+    t += loopCycles;
+    if ((next < num) && (records[next].t <= t))
+    {
+      t = records[next].t;
+      while ((next < num) && (records[next].t == t))
+      {
+        replayApply(records[next].state);
+        next++;
+      }
+    }
+    if (t > end)
+    {
+      break;
+    }
+  }
+
+  printf("replayed %ld records over %.3f s, %lu main loops of %lu us\n", num,
+         (double)records[num - 1].t / SYSCTL_MAIN_OSCILLATOR_HZ, (unsigned long)loops, (unsigned long)replayLoopUs);
+  for (door = 0; door < DOOR_NUM; door++)
+  {
+    printf("door %u: %lu changes\n", door, (unsigned long)doorChanges[door]);
+  }
+  printf("lamp toggles: %lu\n", (unsigned long)lampToggles);
+  printf("host time per main loop [ns]: min %.0f mean %.0f max %.0f\n",
+         loopMin * 1e9, loopSum / loops * 1e9, loopMax * 1e9);
+
+  /* The firmware traced the replay, it must have seen the same sequence */
+  Trace_Freeze();
+  Trace_GetInfo(&info);
+  again = malloc(info.length + 1);
+  Trace_Read(0, again, info.length);
+  differs = replayCompare(trace, length, again, info.length);
+  if (info.dropped != 0)
+  {
+    printf("re-recorded trace: ring overflowed, not compared\n");
+    differs = -1;
+  }
+  else if (differs < 0)
+  {
+    printf("re-recorded trace: identical\n");
+  }
+  else
+  {
+    printf("re-recorded trace: differs at byte %ld\n", differs);
+  }
+  free(again);
+  return (differs < 0) ? 0 : 1;
+}
+
+int main(int argc, char * argv[])
+{
+  static u8 file[REPLAY_FILE_MAX];
+  static u8 trace[REPLAY_FILE_MAX];
+  static replayRecord_t records[REPLAY_FILE_MAX / 2];
+  const char * name = NULL;
+  u8 capture = 0;
+  FILE * in;
+  long length;
+  long num;
+  long i;
+  int a;
+
+  for (a = 1; a < argc; a++)
+  {
+    if (strcmp(argv[a], "-p") == 0)
+    {
+      replayPrint = 1;
+    }
+    else if (strcmp(argv[a], "-v") == 0)
+    {
+      replayVerbose = 1;
+    }
+    else if (strcmp(argv[a], "-c") == 0)
+    {
+      capture = 1;
+    }
+    else if ((strcmp(argv[a], "-l") == 0) && (a + 1 < argc))
+    {
+      replayLoopUs = (u32)strtoul(argv[++a], NULL, 0);
+      replayLoopUs = replayLoopUs ? replayLoopUs : 1;
+    }
+    else
+    {
+      name = argv[a];
+    }
+  }
+  if (name == NULL)
+  {
+    fprintf(stderr, "usage: %s [-l loop_us] [-p] [-v] [-c] file\n", argv[0]);
+    return 2;
+  }
+  if ((in = fopen(name, "rb")) == NULL)
+  {
+    perror(name);
+    return 2;
+  }
+  length = (long)fread(file, 1, sizeof(file), in);
+  fclose(in);
+
+  if (capture)
+  {
+    length = replayFromCapture(file, length, trace);
+  }
+  else
+  {
+    memcpy(trace, file, length);
+  }
+  if ((length <= 0) || ((num = replayDecode(trace, length, records)) <= 0))
+  {
+    fprintf(stderr, "no trace records in %s\n", name);
+    return 2;
+  }
+
+  if (replayPrint)
+  {
+    for (i = 0; i < num; i++)
+    {
+      printf("%14.6f s  pins 0x%02X\n", (double)records[i].t / SYSCTL_MAIN_OSCILLATOR_HZ, records[i].state);
+    }
+  }
+  return replayRun(trace, length, records, num);
+}
@@ -0,0 +1,95 @@
+#include "STD_TYPES.h"
+#include "COBS.h"
+
+
+/* 
+  Description: This function shall encode a frame, the delimiter is not appended
+  
+  Input: 
+        1- src the raw frame
+        2- len the number of bytes in src
+        3- dst a buffer of at least COBS_ENCODED_MAX(len) bytes
+        
+  Output: number of bytes written to dst
+
+ */
+extern u16 COBS_Encode(const u8* src, u16 len, u8* dst)
+{
+  u16 readIdx = 0;
+  u16 writeIdx = 1;
+  u16 codeIdx = 0;
+  u8 code = 1;
+  
+  while (readIdx < len)
+  {
+    if (src[readIdx] == 0)
+    {
+      /* Close the current block, its code points to this zero */
+      dst[codeIdx] = code;
+      codeIdx = writeIdx++;
+      code = 1;
+    }
+    else
+    {
+      dst[writeIdx++] = src[readIdx];
+      code++;
+      /* A full block of 254 non zero bytes carries no implicit zero */
+      if (code == 0xFF)
+      {
+        dst[codeIdx] = code;
+        codeIdx = writeIdx++;
+        code = 1;
+      }
+    }
+    readIdx++;
+  }
+  dst[codeIdx] = code;
+  
+  return writeIdx;
+}
+
+/* 
+  Description: This function shall decode one frame received without its delimiter
+  
+  Input: 
+        1- src the encoded frame
+        2- len the number of bytes in src
+        3- dst a buffer of at least len bytes
+        4- decodedLen receives the number of decoded bytes
+        
+  Output: errStat, ERR_STAT_NOK if the frame is malformed
+
+ */
+extern errStat COBS_Decode(const u8* src, u16 len, u8* dst, u16* decodedLen)
+{
+  u16 readIdx = 0;
+  u16 writeIdx = 0;
+  u8 code;
+  u8 i;
+  
+  while (readIdx < len)
+  {
+    code = src[readIdx];
+    
+    /* A zero inside a frame or a block running past the end is corrupted data */
+    if ((code == 0) || ((readIdx + code) > len))
+    {
+      return ERR_STAT_NOK;
+    }
+    readIdx++;
+    
+    for (i = 1; i < code; i++)
+    {
+      dst[writeIdx++] = src[readIdx++];
+    }
+    
+    /* Every block but a full one and the last one ends with an implicit zero */
+    if ((code != 0xFF) && (readIdx != len))
+    {
+      dst[writeIdx++] = 0;
+    }
+  }
+  *decodedLen = writeIdx;
+  
+  return ERR_STAT_OK;
+}
@@ -0,0 +1,45 @@
+#ifndef COBS_H
+#define COBS_H
+
+/*
+  Consistent Overhead Byte Stuffing.
+
+  COBS removes every 0x00 from a frame so that a single 0x00 can delimit
+  frames on a byte stream. The encoded size is at most len + len/254 + 1,
+  a receiver that loses bytes resynchronises at the next 0x00.
+*/
+
+/* Worst case encoded size of a frame of len bytes (without delimiter) */
+#define COBS_ENCODED_MAX(len)   ((len) + ((len) / 254) + 1)
+
+/* Frame delimiter placed after every encoded frame */
+#define COBS_DELIMITER          0x00
+
+/* 
+  Description: This function shall encode a frame, the delimiter is not appended
+  
+  Input: 
+        1- src the raw frame
+        2- len the number of bytes in src
+        3- dst a buffer of at least COBS_ENCODED_MAX(len) bytes
+        
+  Output: number of bytes written to dst
+
+ */
+extern u16 COBS_Encode(const u8* src, u16 len, u8* dst);
+
+/* 
+  Description: This function shall decode one frame received without its delimiter
+  
+  Input: 
+        1- src the encoded frame
+        2- len the number of bytes in src
+        3- dst a buffer of at least len bytes
+        4- decodedLen receives the number of decoded bytes
+        
+  Output: errStat, ERR_STAT_NOK if the frame is malformed
+
+ */
+extern errStat COBS_Decode(const u8* src, u16 len, u8* dst, u16* decodedLen);
+
+#endif
@@ -0,0 +1,30 @@
+#include "STD_TYPES.h"
+#include "CRC8.h"
+
+
+/* 
+  Description: This function shall continue a CRC-8 over a block of bytes
+  
+  Input: 
+        1- crc the CRC of the previous blocks, CRC8_INIT for the first one
+        2- data the block
+        3- len the number of bytes in data
+        
+  Output: updated CRC
+
+ */
+extern u8 CRC8_Update(u8 crc, const u8* data, u16 len)
+{
+  u8 bit;
+  
+  while (len--)
+  {
+    crc ^= *data++;
+    for (bit = 0; bit < 8; bit++)
+    {
+      crc = (crc & 0x80) ? (u8)((crc << 1) ^ 0x07) : (u8)(crc << 1);
+    }
+  }
+  
+  return crc;
+}
@@ -0,0 +1,20 @@
+#ifndef CRC8_H
+#define CRC8_H
+
+/* CRC-8 with polynomial x^8 + x^2 + x + 1 (0x07) and zero initial value */
+#define CRC8_INIT 0x00
+
+/* 
+  Description: This function shall continue a CRC-8 over a block of bytes
+  
+  Input: 
+        1- crc the CRC of the previous blocks, CRC8_INIT for the first one
+        2- data the block
+        3- len the number of bytes in data
+        
+  Output: updated CRC
+
+ */
+extern u8 CRC8_Update(u8 crc, const u8* data, u16 len);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef HW_TYPES_H
+#define HW_TYPES_H
+
+
+/*****************************************************************************
+ Macros for hardware access.
+
+ In the host build (HOST_BUILD defined) every register access goes through
+ HwSim_Reg, which returns the simulated register behind an address
+ (HOST/hw_sim.c), so the drivers run unmodified on a PC.
+*****************************************************************************/
+#ifdef HOST_BUILD
+
+extern volatile u32 * HwSim_Reg(u32 ui32Addr);
+
+#define HWREG(x)                                                              \
+        (*HwSim_Reg((u32)(x)))
+#define HWREGH(x)                                                             \
+        (*((volatile u16 *)HwSim_Reg((u32)(x))))
+#define HWREGB(x)                                                             \
+        (*((volatile u8 *)HwSim_Reg((u32)(x))))
+
+#else
+
+#define HWREG(x)                                                              \
+        (*((volatile u32 *)(x)))
+#define HWREGH(x)                                                             \
+        (*((volatile u16 *)(x)))
+#define HWREGB(x)                                                             \
+        (*((volatile u8 *)(x)))
+
+#endif
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef MODULE_IDS_H
+#define MODULE_IDS_H
+
+/*
+  Identifiers of the software modules, used wherever a module has to be
+  named at run time (error counters, diagnostics).
+*/
+#define MODULE_ID_SYSCTL      0
+#define MODULE_ID_GPIO        1
+#define MODULE_ID_UART        2
+#define MODULE_ID_SWITCH      3
+#define MODULE_ID_LAMP        4
+#define MODULE_ID_TELEMETRY   5
+#define MODULE_ID_DIAG        6
+#define MODULE_ID_NVIC        7
+#define MODULE_ID_CAN         8
+#define MODULE_ID_DOOR        9
+#define MODULE_ID_GPT         10
+#define MODULE_ID_TIMERWHEEL  11
+#define MODULE_ID_TRACE       12
+#define MODULE_ID_UDMA        13
+#define MODULE_ID_CAPTURE     14
+#define MODULE_ID_SSI         15
+#define MODULE_ID_LAMPCHAIN   16
+#define MODULE_ID_EEPROM      17
+#define MODULE_ID_EVENTLOG    18
+
+#define MODULE_ID_NUM         19
+
+#endif
@@ -1,16 +1,37 @@
 typedef unsigned char u8;
 typedef unsigned short int u16;
+#ifdef HOST_BUILD
+/* 32 bits on 64 bit hosts too, so wrap-around arithmetic matches the target */
+typedef unsigned int u32;
+#else
 typedef unsigned long int u32;
+#endif
 
 typedef signed char s8;
 typedef signed short int s16;
+#ifdef HOST_BUILD
+typedef signed int s32;
+#else
 typedef signed long int s32;
+#endif
 
 typedef float f32;
 typedef double f64;
 typedef long double f96;
 
 
+/*
+  Storage class of the mutable module state. On the host every thread has
+  its own copy so several simulated ECUs can run side by side
+  (HOST/fleet_sim.c); on the target it expands to nothing.
+*/
+#ifdef HOST_BUILD
+#define ECU_STATE __thread
+#else
+#define ECU_STATE
+#endif
+
+
 typedef u8 errStat;
 #define ERR_STAT_OK 0
 #define ERR_STAT_NOK 1
\ No newline at end of file
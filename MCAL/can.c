@@ -0,0 +1,356 @@
+#include "STD_TYPES.h"
+#include "can.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+
+/*
+  Bit timing: 16 time quanta per bit, sample point at 13/16 (81 %).
+*/
+#define CAN_TQ_PER_BIT          16
+#define CAN_TSEG1               12
+#define CAN_TSEG2               3
+#define CAN_SJW                 3
+#define CAN_BRP_MAX             64
+
+/* Receive handler registered by the upper layer */
+static ECU_STATE void (*CAN_rxHandler)(u8 ui8ObjNum);
+
+/******************************************************************************
+    \param ui32Base is the base address of the CAN controller.
+    \param ui32CRQ is the offset of the command request register of the
+    interface (IF1 or IF2) to wait for.
+
+    Waits until the interface finished its transfer to or from the message
+    RAM, which takes a few CAN clock cycles.
+
+/******************************************************************************/
+static void
+_CANIfWait(u32 ui32Base, u32 ui32CRQ)
+{
+    while (HWREG(ui32Base + ui32CRQ) & CAN_IFCRQ_BUSY)
+    {
+    }
+}
+
+/******************************************************************************
+
+    Initializes the CAN controller: sets the bit timing, invalidates all
+    message objects and leaves the controller running with its interrupt
+    sources enabled.
+
+    \param ui32Base is the base address of the CAN controller.
+    \param ui32CANClk is the rate of the clock supplied to the CAN module.
+    \param ui32BitRate is the desired bit rate.
+
+    The CAN clock must be enabled through SYSCTL_controlCAN and its pins
+    handed over through GPIO_AltFunctionSet before calling this function.
+
+/******************************************************************************/
+errStat CAN_Init(u32 ui32Base, u32 ui32CANClk, u32 ui32BitRate)
+{
+    u32 ui32Brp;
+    u8 ui8Obj;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui32Base != CAN0_BASE)
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_INIT, CAN_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if ((ui32BitRate == 0) || ((ui32CANClk % (ui32BitRate * CAN_TQ_PER_BIT)) != 0) ||
+        ((ui32CANClk / (ui32BitRate * CAN_TQ_PER_BIT)) == 0) ||
+        ((ui32CANClk / (ui32BitRate * CAN_TQ_PER_BIT)) > CAN_BRP_MAX))
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_INIT, CAN_E_PARAM_BITRATE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    ui32Brp = ui32CANClk / (ui32BitRate * CAN_TQ_PER_BIT);
+
+    /*
+      Enter initialization mode and unlock the bit timing register.
+    */
+    HWREG(ui32Base + CAN_O_CTL) = CAN_CTL_INIT | CAN_CTL_CCE;
+    HWREG(ui32Base + CAN_O_BIT) = (ui32Brp - 1) |
+                                  ((CAN_SJW - 1) << 6) |
+                                  ((CAN_TSEG1 - 1) << 8) |
+                                  ((CAN_TSEG2 - 1) << 12);
+    HWREG(ui32Base + CAN_O_BRPE) = 0;
+
+    /*
+      The message RAM is not cleared by reset, invalidate every object.
+    */
+    for (ui8Obj = 1; ui8Obj <= CAN_OBJ_NUM; ui8Obj++)
+    {
+      _CANIfWait(ui32Base, CAN_O_IF1CRQ);
+      HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IFCMSK_WRNRD | CAN_IFCMSK_ARB | CAN_IFCMSK_CONTROL;
+      HWREG(ui32Base + CAN_O_IF1ARB1) = 0;
+      HWREG(ui32Base + CAN_O_IF1ARB2) = 0;
+      HWREG(ui32Base + CAN_O_IF1MCTL) = 0;
+      HWREG(ui32Base + CAN_O_IF1CRQ) = ui8Obj;
+    }
+    _CANIfWait(ui32Base, CAN_O_IF1CRQ);
+
+    /*
+      Leave initialization mode, the controller joins the bus after 11
+      recessive bits.
+    */
+    HWREG(ui32Base + CAN_O_CTL) = CAN_CTL_IE | CAN_CTL_SIE | CAN_CTL_EIE;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Configures a message object to receive standard frames through the
+    acceptance filter: a frame is stored when (frame id & ui16Mask) equals
+    (ui16Id & ui16Mask). The object raises the receive interrupt.
+
+    \param ui32Base is the base address of the CAN controller.
+    \param ui8ObjNum is the message object, 1 to CAN_OBJ_NUM.
+    \param ui16Id is the identifier to accept.
+    \param ui16Mask selects the identifier bits compared, CAN_STD_ID_MAX
+    accepts ui16Id only.
+
+    Uses the IF1 interface, must not be called from interrupts.
+
+/******************************************************************************/
+errStat CAN_RxObjectSet(u32 ui32Base, u8 ui8ObjNum, u16 ui16Id, u16 ui16Mask)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui32Base != CAN0_BASE)
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_RX_OBJECT_SET, CAN_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if ((ui8ObjNum == 0) || (ui8ObjNum > CAN_OBJ_NUM))
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_RX_OBJECT_SET, CAN_E_PARAM_OBJ);
+      return ERR_STAT_NOK;
+    }
+    if ((ui16Id > CAN_STD_ID_MAX) || (ui16Mask > CAN_STD_ID_MAX))
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_RX_OBJECT_SET, CAN_E_PARAM_ID);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    _CANIfWait(ui32Base, CAN_O_IF1CRQ);
+    HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IFCMSK_WRNRD | CAN_IFCMSK_MASK |
+                                      CAN_IFCMSK_ARB | CAN_IFCMSK_CONTROL;
+    /*
+      Filter on the standard id bits and on the XTD bit so extended frames
+      never match.
+    */
+    HWREG(ui32Base + CAN_O_IF1MSK1) = 0;
+    HWREG(ui32Base + CAN_O_IF1MSK2) = CAN_IFMSK2_MXTD | ((u32)ui16Mask << CAN_IFARB2_ID_S);
+    HWREG(ui32Base + CAN_O_IF1ARB1) = 0;
+    HWREG(ui32Base + CAN_O_IF1ARB2) = CAN_IFARB2_MSGVAL | ((u32)ui16Id << CAN_IFARB2_ID_S);
+    HWREG(ui32Base + CAN_O_IF1MCTL) = CAN_IFMCTL_UMASK | CAN_IFMCTL_RXIE | CAN_IFMCTL_EOB;
+    HWREG(ui32Base + CAN_O_IF1CRQ) = ui8ObjNum;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Queues a standard frame for transmission in a message object.
+
+    \param ui32Base is the base address of the CAN controller.
+    \param ui8ObjNum is the message object, 1 to CAN_OBJ_NUM.
+    \param psMsg is the frame to send.
+
+    \return ERR_STAT_NOK if the previous frame of the object is still
+    pending, the new frame is then not queued.
+
+    Uses the IF1 interface, must not be called from interrupts.
+
+/******************************************************************************/
+errStat CAN_MessageSend(u32 ui32Base, u8 ui8ObjNum, const canMessage_t* psMsg)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui32Base != CAN0_BASE)
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_MESSAGE_SEND, CAN_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if ((ui8ObjNum == 0) || (ui8ObjNum > CAN_OBJ_NUM))
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_MESSAGE_SEND, CAN_E_PARAM_OBJ);
+      return ERR_STAT_NOK;
+    }
+    if (psMsg == 0)
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_MESSAGE_SEND, CAN_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+    if ((psMsg->id > CAN_STD_ID_MAX) || (psMsg->len > 8))
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_MESSAGE_SEND, CAN_E_PARAM_ID);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    if (HWREG(ui32Base + CAN_O_TXRQ1) & (1UL << (ui8ObjNum - 1)))
+    {
+      return ERR_STAT_NOK;
+    }
+
+    _CANIfWait(ui32Base, CAN_O_IF1CRQ);
+    HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IFCMSK_WRNRD | CAN_IFCMSK_ARB | CAN_IFCMSK_CONTROL |
+                                      CAN_IFCMSK_DATAA | CAN_IFCMSK_DATAB;
+    HWREG(ui32Base + CAN_O_IF1ARB1) = 0;
+    HWREG(ui32Base + CAN_O_IF1ARB2) = CAN_IFARB2_MSGVAL | CAN_IFARB2_DIR |
+                                      ((u32)psMsg->id << CAN_IFARB2_ID_S);
+    HWREG(ui32Base + CAN_O_IF1DA1) = psMsg->data[0] | ((u32)psMsg->data[1] << 8);
+    HWREG(ui32Base + CAN_O_IF1DA2) = psMsg->data[2] | ((u32)psMsg->data[3] << 8);
+    HWREG(ui32Base + CAN_O_IF1DB1) = psMsg->data[4] | ((u32)psMsg->data[5] << 8);
+    HWREG(ui32Base + CAN_O_IF1DB2) = psMsg->data[6] | ((u32)psMsg->data[7] << 8);
+    HWREG(ui32Base + CAN_O_IF1MCTL) = CAN_IFMCTL_NEWDAT | CAN_IFMCTL_TXRQST |
+                                      CAN_IFMCTL_EOB | psMsg->len;
+    HWREG(ui32Base + CAN_O_IF1CRQ) = ui8ObjNum;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Reads the frame stored in a receive message object and releases the
+    object for the next frame.
+
+    \param ui32Base is the base address of the CAN controller.
+    \param ui8ObjNum is the message object, 1 to CAN_OBJ_NUM.
+    \param psMsg receives the frame.
+
+    \return ERR_STAT_NOK if the object holds no new frame.
+
+    Uses the IF2 interface so it can be called from the receive handler
+    while the main loop uses IF1.
+
+/******************************************************************************/
+errStat CAN_MessageGet(u32 ui32Base, u8 ui8ObjNum, canMessage_t* psMsg)
+{
+    u32 ui32Ctl;
+    u32 ui32Data;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui32Base != CAN0_BASE)
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_MESSAGE_GET, CAN_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if ((ui8ObjNum == 0) || (ui8ObjNum > CAN_OBJ_NUM))
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_MESSAGE_GET, CAN_E_PARAM_OBJ);
+      return ERR_STAT_NOK;
+    }
+    if (psMsg == 0)
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_MESSAGE_GET, CAN_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    /*
+      Transfer the object into IF2, clearing NEWDAT and INTPND on the way.
+    */
+    _CANIfWait(ui32Base, CAN_O_IF2CRQ);
+    HWREG(ui32Base + CAN_O_IF2CMSK) = CAN_IFCMSK_ARB | CAN_IFCMSK_CONTROL | CAN_IFCMSK_CLRINTPND |
+                                      CAN_IFCMSK_NEWDAT | CAN_IFCMSK_DATAA | CAN_IFCMSK_DATAB;
+    HWREG(ui32Base + CAN_O_IF2CRQ) = ui8ObjNum;
+    _CANIfWait(ui32Base, CAN_O_IF2CRQ);
+
+    ui32Ctl = HWREG(ui32Base + CAN_O_IF2MCTL);
+    if (!(ui32Ctl & CAN_IFMCTL_NEWDAT))
+    {
+      return ERR_STAT_NOK;
+    }
+    if (ui32Ctl & CAN_IFMCTL_MSGLST)
+    {
+      /* A frame was overwritten before it was read */
+      ErrCnt_Report(MODULE_ID_CAN);
+    }
+
+    psMsg->id = (u16)((HWREG(ui32Base + CAN_O_IF2ARB2) >> CAN_IFARB2_ID_S) & CAN_STD_ID_MAX);
+    psMsg->len = (u8)(ui32Ctl & CAN_IFMCTL_DLC_M);
+    if (psMsg->len > 8)
+    {
+      psMsg->len = 8;
+    }
+    ui32Data = HWREG(ui32Base + CAN_O_IF2DA1);
+    psMsg->data[0] = (u8)ui32Data;
+    psMsg->data[1] = (u8)(ui32Data >> 8);
+    ui32Data = HWREG(ui32Base + CAN_O_IF2DA2);
+    psMsg->data[2] = (u8)ui32Data;
+    psMsg->data[3] = (u8)(ui32Data >> 8);
+    ui32Data = HWREG(ui32Base + CAN_O_IF2DB1);
+    psMsg->data[4] = (u8)ui32Data;
+    psMsg->data[5] = (u8)(ui32Data >> 8);
+    ui32Data = HWREG(ui32Base + CAN_O_IF2DB2);
+    psMsg->data[6] = (u8)ui32Data;
+    psMsg->data[7] = (u8)(ui32Data >> 8);
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Registers the function called from the CAN interrupt with the number of
+    every message object that received a frame. The handler must read the
+    object with CAN_MessageGet, which clears its interrupt.
+
+    \param ui32Base is the base address of the CAN controller.
+    \param pfnHandler is the function to call, or 0 to unregister.
+
+/******************************************************************************/
+errStat CAN_IntRegister(u32 ui32Base, void (*pfnHandler)(u8 ui8ObjNum))
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui32Base != CAN0_BASE)
+    {
+      Det_ReportError(MODULE_ID_CAN, CAN_API_INT_REGISTER, CAN_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    CAN_rxHandler = pfnHandler;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    CAN0 interrupt: serves every pending source. Status interrupts recover
+    from bus-off, message object interrupts are handed to the registered
+    handler, which reads the object through CAN_MessageGet.
+
+/******************************************************************************/
+void CAN0_Handler(void)
+{
+    u32 ui32Int;
+    u32 ui32Status;
+
+    while ((ui32Int = HWREG(CAN0_BASE + CAN_O_INT)) != 0)
+    {
+      if (ui32Int == CAN_INT_STATUS)
+      {
+        /* Reading the status register acknowledges the interrupt */
+        ui32Status = HWREG(CAN0_BASE + CAN_O_STS);
+        if (ui32Status & CAN_STS_BOFF)
+        {
+          /* Bus-off sets INIT, clearing it starts the recovery sequence */
+          ErrCnt_Report(MODULE_ID_CAN);
+          HWREG(CAN0_BASE + CAN_O_CTL) &= ~(CAN_CTL_INIT);
+        }
+      }
+      else if (CAN_rxHandler != 0)
+      {
+        CAN_rxHandler((u8)ui32Int);
+      }
+      else
+      {
+        /* Nobody reads the object, release it so the interrupt clears */
+        _CANIfWait(CAN0_BASE, CAN_O_IF2CRQ);
+        HWREG(CAN0_BASE + CAN_O_IF2CMSK) = CAN_IFCMSK_CLRINTPND | CAN_IFCMSK_NEWDAT;
+        HWREG(CAN0_BASE + CAN_O_IF2CRQ) = ui32Int;
+      }
+    }
+}
@@ -0,0 +1,136 @@
+#ifndef CAN_H
+#define CAN_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the CAN register offsets.
+
+/*******************************************************************************/
+#define CAN_O_CTL               0x00000000  /* CAN Control                     */
+#define CAN_O_STS               0x00000004  /* CAN Status                      */
+#define CAN_O_ERR               0x00000008  /* CAN Error Counter               */
+#define CAN_O_BIT               0x0000000C  /* CAN Bit Timing                  */
+#define CAN_O_INT               0x00000010  /* CAN Interrupt                   */
+#define CAN_O_BRPE              0x00000018  /* CAN Baud Rate Prescaler         */
+                                            /* Extension                       */
+#define CAN_O_IF1CRQ            0x00000020  /* CAN IF1 Command Request         */
+#define CAN_O_IF1CMSK           0x00000024  /* CAN IF1 Command Mask            */
+#define CAN_O_IF1MSK1           0x00000028  /* CAN IF1 Mask 1                  */
+#define CAN_O_IF1MSK2           0x0000002C  /* CAN IF1 Mask 2                  */
+#define CAN_O_IF1ARB1           0x00000030  /* CAN IF1 Arbitration 1           */
+#define CAN_O_IF1ARB2           0x00000034  /* CAN IF1 Arbitration 2           */
+#define CAN_O_IF1MCTL           0x00000038  /* CAN IF1 Message Control         */
+#define CAN_O_IF1DA1            0x0000003C  /* CAN IF1 Data A1                 */
+#define CAN_O_IF1DA2            0x00000040  /* CAN IF1 Data A2                 */
+#define CAN_O_IF1DB1            0x00000044  /* CAN IF1 Data B1                 */
+#define CAN_O_IF1DB2            0x00000048  /* CAN IF1 Data B2                 */
+#define CAN_O_IF2CRQ            0x00000080  /* CAN IF2 Command Request         */
+#define CAN_O_IF2CMSK           0x00000084  /* CAN IF2 Command Mask            */
+#define CAN_O_IF2ARB2           0x00000094  /* CAN IF2 Arbitration 2           */
+#define CAN_O_IF2MCTL           0x00000098  /* CAN IF2 Message Control         */
+#define CAN_O_IF2DA1            0x0000009C  /* CAN IF2 Data A1                 */
+#define CAN_O_IF2DA2            0x000000A0  /* CAN IF2 Data A2                 */
+#define CAN_O_IF2DB1            0x000000A4  /* CAN IF2 Data B1                 */
+#define CAN_O_IF2DB2            0x000000A8  /* CAN IF2 Data B2                 */
+#define CAN_O_TXRQ1             0x00000100  /* CAN Transmission Request 1      */
+
+/******************************************************************************
+  
+  The following are defines for the bit fields in the CAN registers.
+  
+******************************************************************************/
+#define CAN_CTL_INIT            0x00000001  /* Initialization                  */
+#define CAN_CTL_IE              0x00000002  /* CAN Interrupt Enable            */
+#define CAN_CTL_SIE             0x00000004  /* Status Interrupt Enable         */
+#define CAN_CTL_EIE             0x00000008  /* Error Interrupt Enable          */
+#define CAN_CTL_CCE             0x00000040  /* Configuration Change Enable     */
+
+#define CAN_STS_BOFF            0x00000080  /* Bus-Off Status                  */
+
+#define CAN_INT_STATUS          0x00008000  /* Status interrupt pending        */
+
+#define CAN_IFCRQ_BUSY          0x00008000  /* Busy Flag                       */
+
+#define CAN_IFCMSK_WRNRD        0x00000080  /* Write, Not Read                 */
+#define CAN_IFCMSK_MASK         0x00000040  /* Access Mask Bits                */
+#define CAN_IFCMSK_ARB          0x00000020  /* Access Arbitration Bits         */
+#define CAN_IFCMSK_CONTROL      0x00000010  /* Access Control Bits             */
+#define CAN_IFCMSK_CLRINTPND    0x00000008  /* Clear Interrupt Pending Bit     */
+#define CAN_IFCMSK_NEWDAT       0x00000004  /* Access New Data                 */
+#define CAN_IFCMSK_DATAA        0x00000002  /* Access Data Byte 0 to 3         */
+#define CAN_IFCMSK_DATAB        0x00000001  /* Access Data Byte 4 to 7         */
+
+#define CAN_IFMSK2_MXTD         0x00008000  /* Use Extended Identifier for     */
+                                            /* Acceptance Filtering            */
+#define CAN_IFARB2_MSGVAL       0x00008000  /* Message Valid                   */
+#define CAN_IFARB2_DIR          0x00002000  /* Message Direction, 1 = transmit */
+#define CAN_IFARB2_ID_S         2           /* Standard identifier shift       */
+
+#define CAN_IFMCTL_NEWDAT       0x00008000  /* New Data                        */
+#define CAN_IFMCTL_MSGLST       0x00004000  /* Message Lost                    */
+#define CAN_IFMCTL_UMASK        0x00001000  /* Use Acceptance Mask             */
+#define CAN_IFMCTL_RXIE         0x00000400  /* Receive Interrupt Enable        */
+#define CAN_IFMCTL_TXRQST       0x00000100  /* Transmit Request                */
+#define CAN_IFMCTL_EOB          0x00000080  /* End of Buffer                   */
+#define CAN_IFMCTL_DLC_M        0x0000000F  /* Data Length Code                */
+
+/*****************************************************************************
+ The following values define the bit field for the ui32Base argument to
+ several of the APIs.
+*****************************************************************************/
+#define CAN0_BASE               0x40040000  /* CAN0                            */
+
+/* Message objects are numbered 1 to CAN_OBJ_NUM */
+#define CAN_OBJ_NUM             32
+
+/* Largest standard identifier */
+#define CAN_STD_ID_MAX          0x7FF
+
+typedef struct 
+{
+  u16 id;             /* standard 11 bit identifier */
+  u8 len;             /* number of data bytes, 0 to 8 */
+  u8 data[8];
+} canMessage_t;
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define CAN_API_INIT            0x00
+#define CAN_API_RX_OBJECT_SET   0x01
+#define CAN_API_MESSAGE_SEND    0x02
+#define CAN_API_MESSAGE_GET     0x03
+#define CAN_API_INT_REGISTER    0x04
+
+#define CAN_E_PARAM_BASE        0x0A  /* Invalid CAN base address          */
+#define CAN_E_PARAM_BITRATE     0x0B  /* Bit rate not reachable            */
+#define CAN_E_PARAM_OBJ         0x0C  /* Invalid message object            */
+#define CAN_E_PARAM_ID          0x0D  /* Identifier or length out of range */
+#define CAN_E_PARAM_POINTER     0x0E  /* Null pointer                      */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat CAN_Init(u32 ui32Base, u32 ui32CANClk, u32 ui32BitRate);
+extern errStat CAN_RxObjectSet(u32 ui32Base, u8 ui8ObjNum, u16 ui16Id, u16 ui16Mask);
+extern errStat CAN_MessageSend(u32 ui32Base, u8 ui8ObjNum, const canMessage_t* psMsg);
+extern errStat CAN_MessageGet(u32 ui32Base, u8 ui8ObjNum, canMessage_t* psMsg);
+extern errStat CAN_IntRegister(u32 ui32Base, void (*pfnHandler)(u8 ui8ObjNum));
+
+/******************************************************************************
+ 
+ Interrupt service routine, to be placed in the vector table of the startup
+ file at the CAN0 entry.
+ 
+/*******************************************************************************/
+extern void CAN0_Handler(void);
+
+#endif
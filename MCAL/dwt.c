@@ -0,0 +1,18 @@
+#include "STD_TYPES.h"
+#include "dwt.h"
+
+/******************************************************************************
+
+    Starts the DWT cycle counter from zero.
+
+    The counter runs at the core clock and is used as the time base for
+    timestamps and run time measurements; it costs no interrupts.
+
+/******************************************************************************/
+errStat DWT_Init(void)
+{
+    HWREG(DWT_DEMCR) |= DWT_DEMCR_TRCENA;
+    HWREG(DWT_CYCCNT) = 0;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+    return ERR_STAT_OK;
+}
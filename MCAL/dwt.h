@@ -0,0 +1,37 @@
+#ifndef DWT_H
+#define DWT_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the Data Watchpoint and Trace registers used
+ as a free running cycle counter.
+
+/*******************************************************************************/
+#define DWT_DEMCR               0xE000EDFC  /* Debug Exception Monitor Control */
+#define DWT_CTRL                0xE0001000  /* DWT Control                     */
+#define DWT_CYCCNT              0xE0001004  /* DWT Cycle Count                 */
+
+#define DWT_DEMCR_TRCENA        0x01000000  /* Enable DWT and ITM              */
+#define DWT_CTRL_CYCCNTENA      0x00000001  /* Enable cycle counter            */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat DWT_Init(void);
+
+/******************************************************************************
+
+  Returns the number of core clock cycles since DWT_Init, wrapping at 2^32.
+  Differences of two readings are valid as long as they are computed in u32
+  arithmetic and less than 2^32 cycles apart.
+
+/******************************************************************************/
+#define DWT_CycleCountGet()     ((u32)HWREG(DWT_CYCCNT))
+
+#endif
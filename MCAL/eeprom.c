@@ -0,0 +1,185 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "eeprom.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+/******************************************************************************
+
+    Waits until the EEPROM has finished its current operation.
+
+/******************************************************************************/
+static void
+_EEPROMWaitDone(void)
+{
+    while (HWREG(EEPROM_BASE + EEPROM_O_EEDONE) & EEPROM_RC_WORKING)
+    {
+    }
+}
+
+/******************************************************************************
+
+    Enables the EEPROM and waits until it is ready.
+
+    After a power loss during programming the EEPROM finishes or undoes the
+    interrupted operation on its own before it becomes ready. If that
+    recovery failed the EEPROM is not usable. Otherwise the module is reset
+    and checked again, as the datasheet initialization sequence requires, so
+    that it starts from its recovered state.
+
+    \return ERR_STAT_NOK when an erase or programming retry is pending.
+
+/******************************************************************************/
+errStat EEPROM_Init(void)
+{
+    errStat status;
+    volatile u32 ui32Delay;
+
+    status = SYSCTL_controlEEPROM(SYSCTL_EEPROM_0, SYSCTL_EEPROM_ENABLE);
+    if (status != ERR_STAT_OK)
+    {
+      return status;
+    }
+
+    /*
+      The module needs 6 cycles after its clock is enabled before its
+      registers may be accessed.
+    */
+    for (ui32Delay = 0; ui32Delay < 2; ui32Delay++)
+    {
+    }
+
+    _EEPROMWaitDone();
+
+    if (HWREG(EEPROM_BASE + EEPROM_O_EESUPP) & (EEPROM_EESUPP_ERETRY | EEPROM_EESUPP_PRETRY))
+    {
+      return ERR_STAT_NOK;
+    }
+
+    status = SYSCTL_resetEEPROM(SYSCTL_EEPROM_0);
+    if (status != ERR_STAT_OK)
+    {
+      return status;
+    }
+
+    /* Same delay after the reset before the registers are accessed again */
+    for (ui32Delay = 0; ui32Delay < 2; ui32Delay++)
+    {
+    }
+
+    _EEPROMWaitDone();
+
+    if (HWREG(EEPROM_BASE + EEPROM_O_EESUPP) & (EEPROM_EESUPP_ERETRY | EEPROM_EESUPP_PRETRY))
+    {
+      return ERR_STAT_NOK;
+    }
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Reads words from the EEPROM.
+
+    \param ui32Address is the byte address of the first word, word aligned.
+    \param pui32Data receives the words.
+    \param ui32Count is the number of words to read.
+
+    Reads take a few cycles per word but are not possible while a write is
+    in progress.
+
+    \return ERR_STAT_NOK if a write is in progress, nothing is read then.
+
+/******************************************************************************/
+errStat EEPROM_Read(u32 ui32Address, u32* pui32Data, u32 ui32Count)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    /*
+      Check the arguments.
+    */
+    if ((ui32Address & 3) || (ui32Address > EEPROM_SIZE) ||
+        (ui32Count > ((EEPROM_SIZE - ui32Address) / 4)))
+    {
+      Det_ReportError(MODULE_ID_EEPROM, EEPROM_API_READ, EEPROM_E_PARAM_ADDRESS);
+      return ERR_STAT_NOK;
+    }
+    if (pui32Data == 0)
+    {
+      Det_ReportError(MODULE_ID_EEPROM, EEPROM_API_READ, EEPROM_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    if (HWREG(EEPROM_BASE + EEPROM_O_EEDONE) & EEPROM_RC_WORKING)
+    {
+      return ERR_STAT_NOK;
+    }
+
+    HWREG(EEPROM_BASE + EEPROM_O_EEBLOCK) = ui32Address / (EEPROM_BLOCK_WORDS * 4);
+    HWREG(EEPROM_BASE + EEPROM_O_EEOFFSET) = (ui32Address / 4) % EEPROM_BLOCK_WORDS;
+
+    while (ui32Count != 0)
+    {
+      *pui32Data++ = HWREG(EEPROM_BASE + EEPROM_O_EERDWRINC);
+      ui32Count--;
+
+      /*
+        The offset wraps inside the block, the next block has to be
+        selected explicitly.
+      */
+      if ((ui32Count != 0) && (HWREG(EEPROM_BASE + EEPROM_O_EEOFFSET) == 0))
+      {
+        HWREG(EEPROM_BASE + EEPROM_O_EEBLOCK) += 1;
+      }
+    }
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Starts writing one word and returns at once.
+
+    \param ui32Address is the byte address of the word, word aligned.
+    \param ui32Data is the word to write.
+
+    Programming a word takes up to a few milliseconds, longer when the
+    EEPROM has to erase and copy a sector first. EEPROM_StatusGet tells when
+    it is over and whether it failed; a new write or a read is only
+    accepted once it is.
+
+    \return ERR_STAT_NOK if the previous write is still in progress.
+
+/******************************************************************************/
+errStat EEPROM_WriteStart(u32 ui32Address, u32 ui32Data)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if ((ui32Address & 3) || (ui32Address >= EEPROM_SIZE))
+    {
+      Det_ReportError(MODULE_ID_EEPROM, EEPROM_API_WRITE_START, EEPROM_E_PARAM_ADDRESS);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    if (HWREG(EEPROM_BASE + EEPROM_O_EEDONE) & EEPROM_RC_WORKING)
+    {
+      return ERR_STAT_NOK;
+    }
+
+    HWREG(EEPROM_BASE + EEPROM_O_EEBLOCK) = ui32Address / (EEPROM_BLOCK_WORDS * 4);
+    HWREG(EEPROM_BASE + EEPROM_O_EEOFFSET) = (ui32Address / 4) % EEPROM_BLOCK_WORDS;
+    HWREG(EEPROM_BASE + EEPROM_O_EERDWR) = ui32Data;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Returns the state of the last write.
+
+    \return EEPROM_RC_WORKING while a write is in progress, then 0 or the
+    EEPROM_RC_NOPERM and EEPROM_RC_WRBUSY error bits of the last write.
+
+/******************************************************************************/
+u32 EEPROM_StatusGet(void)
+{
+    return(HWREG(EEPROM_BASE + EEPROM_O_EEDONE));
+}
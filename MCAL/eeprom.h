@@ -0,0 +1,71 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the EEPROM register offsets.
+
+/*******************************************************************************/
+#define EEPROM_BASE             0x400AF000  /* EEPROM                          */
+
+#define EEPROM_O_EESIZE         0x00000000  /* EEPROM Size Information         */
+#define EEPROM_O_EEBLOCK        0x00000004  /* EEPROM Current Block            */
+#define EEPROM_O_EEOFFSET       0x00000008  /* EEPROM Current Offset           */
+#define EEPROM_O_EERDWR         0x00000010  /* EEPROM Read-Write               */
+#define EEPROM_O_EERDWRINC      0x00000014  /* EEPROM Read-Write with Increment*/
+#define EEPROM_O_EEDONE         0x00000018  /* EEPROM Done Status              */
+#define EEPROM_O_EESUPP         0x0000001C  /* EEPROM Support Control & Status */
+
+/******************************************************************************
+
+  The following are defines for the bit fields in the EEPROM registers.
+
+******************************************************************************/
+#define EEPROM_EESUPP_ERETRY    0x00000004  /* Erase Must Be Retried           */
+#define EEPROM_EESUPP_PRETRY    0x00000008  /* Programming Must Be Retried     */
+
+/******************************************************************************
+
+ Values returned by EEPROM_StatusGet, the bits of the EEDONE register.
+
+/*******************************************************************************/
+#define EEPROM_RC_WORKING       0x00000001  /* A write is in progress          */
+#define EEPROM_RC_WKERASE       0x00000004  /* Erasing, the write is delayed   */
+#define EEPROM_RC_WKCOPY        0x00000008  /* Copying, the write is delayed   */
+#define EEPROM_RC_NOPERM        0x00000010  /* Write to a protected block      */
+#define EEPROM_RC_WRBUSY        0x00000020  /* Write while WORKING was set     */
+
+/* Geometry of the TM4C123 EEPROM: 32 blocks of 16 words, 2 KB */
+#define EEPROM_BLOCK_WORDS      16
+#define EEPROM_BLOCK_NUM        32
+#define EEPROM_SIZE             (EEPROM_BLOCK_NUM * EEPROM_BLOCK_WORDS * 4)
+
+/* Content of a word that was never written */
+#define EEPROM_ERASED_WORD      0xFFFFFFFF
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define EEPROM_API_READ         0x00
+#define EEPROM_API_WRITE_START  0x01
+
+#define EEPROM_E_PARAM_ADDRESS  0x0A  /* Unaligned address or out of range */
+#define EEPROM_E_PARAM_POINTER  0x0B  /* Null pointer                      */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat EEPROM_Init(void);
+extern errStat EEPROM_Read(u32 ui32Address, u32* pui32Data, u32 ui32Count);
+extern errStat EEPROM_WriteStart(u32 ui32Address, u32 ui32Data);
+extern u32 EEPROM_StatusGet(void);
+
+#endif
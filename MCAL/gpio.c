@@ -1,6 +1,36 @@
 #include "STD_TYPES.h"
 #include "gpio.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
 
+/* Number of GPIO ports served by this driver, A to F */
+#define GPIO_PORT_NUM           6
+
+/* Interrupt handlers registered by upper layers, indexed by port */
+static ECU_STATE void (*GPIO_handlers[GPIO_PORT_NUM])(u32 ui32Port, u8 ui8Pins);
+
+/******************************************************************************
+    \param ui32Port is the base address of the GPIO port.
+
+    This function shall determine the driver index of a GPIO port.
+
+    \return Returns the index, or GPIO_PORT_NUM if the base address is not
+    valid.
+
+/******************************************************************************/
+static u8
+_GPIOIndex(u32 ui32Port)
+{
+    return((ui32Port == GPIO_PORTA_BASE) ? 0 :
+           (ui32Port == GPIO_PORTB_BASE) ? 1 :
+           (ui32Port == GPIO_PORTC_BASE) ? 2 :
+           (ui32Port == GPIO_PORTD_BASE) ? 3 :
+           (ui32Port == GPIO_PORTE_BASE) ? 4 :
+           (ui32Port == GPIO_PORTF_BASE) ? 5 : GPIO_PORT_NUM);
+}
+
+#if (DET_DEV_ERROR_DETECT == 1)
 /******************************************************************************
     \param ui32Port is the base address of the GPIO port.                      
                                                                                
@@ -18,8 +48,9 @@ _GPIOBaseValid(u32 ui32Port)
            (ui32Port == GPIO_PORTC_BASE) ||
            (ui32Port == GPIO_PORTD_BASE) ||
            (ui32Port == GPIO_PORTE_BASE) ||
-           (ui32Port == GPIO_PORTF_BASE);
+           (ui32Port == GPIO_PORTF_BASE));
 }
+#endif
 /******************************************************************************
 
     Sets the direction and mode of the specified pin(s).
@@ -42,21 +73,30 @@ _GPIOBaseValid(u32 ui32Port)
 /******************************************************************************/
 errStat GPIO_DirModeSet(u32 ui32Port, u8 ui8Pins, u32 ui32PinIO)
 {
+#if (DET_DEV_ERROR_DETECT == 1)
     /*
       Check the arguments.
     */
-    if (_GPIOBaseValid(ui32Port) && ((ui32PinIO == GPIO_DIR_MODE_IN) || (ui32PinIO == GPIO_DIR_MODE_OUT) ||(ui32PinIO == GPIO_DIR_MODE_HW)))
+    if (!_GPIOBaseValid(ui32Port))
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_DIR_MODE_SET, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
+    }
+    if ((ui32PinIO != GPIO_DIR_MODE_IN) && (ui32PinIO != GPIO_DIR_MODE_OUT) && (ui32PinIO != GPIO_DIR_MODE_HW))
     {
-      /*
-        Set the pin direction and mode.
-      */
-      HWREG(ui32Port + GPIO_O_DIR) = ((ui32PinIO & 1) ?
-                                      (HWREG(ui32Port + GPIO_O_DIR) | ui8Pins) :
-                                      (HWREG(ui32Port + GPIO_O_DIR) & ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_DEN) |= ui8Pins;
-      return ERR_STAT_OK;
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_DIR_MODE_SET, GPIO_E_PARAM_VALUE);
+      return ERR_STAT_NOK;
     }
-    return ERR_STAT_NOK;
+#endif
+
+    /*
+      Set the pin direction and mode.
+    */
+    HWREG(ui32Port + GPIO_O_DIR) = ((ui32PinIO & 1) ?
+                                    (HWREG(ui32Port + GPIO_O_DIR) | ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_DIR) & ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_DEN) |= ui8Pins;
+    return ERR_STAT_OK;
 }
 
 /******************************************************************************
@@ -74,18 +114,27 @@ errStat GPIO_DirModeSet(u32 ui32Port, u8 ui8Pins, u32 ui32PinIO)
 /******************************************************************************/
 errStat GPIO_PinRead(u32 ui32Port, u8 ui8Pins, u8* ui8Val)
 {
+#if (DET_DEV_ERROR_DETECT == 1)
     /*
-       Check the arguments.
+      Check the arguments.
     */
-    if (_GPIOBaseValid(ui32Port))
+    if (!_GPIOBaseValid(ui32Port))
     {
-      /*
-         Return the pin value(s).
-      */
-      *ui8Val = (HWREG(ui32Port + (GPIO_O_DATA + (ui8Pins << 2))));
-      return ERR_STAT_OK;
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_PIN_READ, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
     }
-    return ERR_STAT_NOK;
+    if (ui8Val == 0)
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_PIN_READ, GPIO_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    /*
+       Return the pin value(s).
+    */
+    *ui8Val = (HWREG(ui32Port + (GPIO_O_DATA + (ui8Pins << 2))));
+    return ERR_STAT_OK;
 }
 
 /******************************************************************************
@@ -108,18 +157,22 @@ errStat GPIO_PinRead(u32 ui32Port, u8 ui8Pins, u8* ui8Val)
 /******************************************************************************/
 errStat GPIO_PinWrite(u32 ui32Port, u8 ui8Pins, u8 ui8Val)
 {
+#if (DET_DEV_ERROR_DETECT == 1)
     /*
-       Check the arguments.
+      Check the arguments.
     */
-    if(_GPIOBaseValid(ui32Port))
+    if (!_GPIOBaseValid(ui32Port))
     {
-      /*
-         Write the pins.
-      */
-      HWREG(ui32Port + (GPIO_O_DATA + (ui8Pins << 2))) = ui8Val;
-      return ERR_STAT_OK;
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_PIN_WRITE, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
     }
-    return ERR_STAT_NOK;
+#endif
+
+    /*
+       Write the pins.
+    */
+    HWREG(ui32Port + (GPIO_O_DATA + (ui8Pins << 2))) = ui8Val;
+    return ERR_STAT_OK;
 }
 
 /******************************************************************************
@@ -162,99 +215,325 @@ errStat GPIO_PadConfigSet(u32 ui32Port, u8 ui8Pins, u32 ui32Strength, u32 ui32Pi
 {
     u8 ui8Bit;
 
+#if (DET_DEV_ERROR_DETECT == 1)
     /*
-       Check the arguments.
+      Check the arguments.
     */
+    if (!_GPIOBaseValid(ui32Port))
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_PAD_CONFIG_SET, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
+    }
     if (
-        (_GPIOBaseValid(ui32Port)) &&
-        (
-         (ui32Strength == GPIO_STRENGTH_2MA) ||
-         (ui32Strength == GPIO_STRENGTH_4MA) ||
-         (ui32Strength == GPIO_STRENGTH_6MA) ||
-         (ui32Strength == GPIO_STRENGTH_8MA) ||
-         (ui32Strength == GPIO_STRENGTH_8MA_SC) ||
-         (ui32Strength == GPIO_STRENGTH_10MA) ||
-         (ui32Strength == GPIO_STRENGTH_12MA)
-         ) &&
-        (
-         (ui32PinType == GPIO_PIN_TYPE_STD) ||
-         (ui32PinType == GPIO_PIN_TYPE_STD_WPU) ||
-         (ui32PinType == GPIO_PIN_TYPE_STD_WPD) ||
-         (ui32PinType == GPIO_PIN_TYPE_OD) ||
-         (ui32PinType == GPIO_PIN_TYPE_WAKE_LOW) ||
-         (ui32PinType == GPIO_PIN_TYPE_WAKE_HIGH) ||
-         (ui32PinType == GPIO_PIN_TYPE_ANALOG)
-         )
+        (ui32Strength != GPIO_STRENGTH_2MA) &&
+        (ui32Strength != GPIO_STRENGTH_4MA) &&
+        (ui32Strength != GPIO_STRENGTH_6MA) &&
+        (ui32Strength != GPIO_STRENGTH_8MA) &&
+        (ui32Strength != GPIO_STRENGTH_8MA_SC) &&
+        (ui32Strength != GPIO_STRENGTH_10MA) &&
+        (ui32Strength != GPIO_STRENGTH_12MA)
        )
     {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_PAD_CONFIG_SET, GPIO_E_PARAM_VALUE);
+      return ERR_STAT_NOK;
+    }
+    if (
+        (ui32PinType != GPIO_PIN_TYPE_STD) &&
+        (ui32PinType != GPIO_PIN_TYPE_STD_WPU) &&
+        (ui32PinType != GPIO_PIN_TYPE_STD_WPD) &&
+        (ui32PinType != GPIO_PIN_TYPE_OD) &&
+        (ui32PinType != GPIO_PIN_TYPE_WAKE_LOW) &&
+        (ui32PinType != GPIO_PIN_TYPE_WAKE_HIGH) &&
+        (ui32PinType != GPIO_PIN_TYPE_ANALOG)
+       )
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_PAD_CONFIG_SET, GPIO_E_PARAM_VALUE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    for(ui8Bit = 0; ui8Bit < 8; ui8Bit++)
+    {
+        if(ui8Pins & (1 << ui8Bit))
+        {
+            HWREG(ui32Port + GPIO_O_PC) = (HWREG(ui32Port + GPIO_O_PC) &
+                                           ~(0x3 << (2 * ui8Bit)));
+            HWREG(ui32Port + GPIO_O_PC) |= (((ui32Strength >> 5) & 0x3) <<
+                                            (2 * ui8Bit));
+        }
+    }
+
+    /*
+       Set the output drive strength.
+    */
+    HWREG(ui32Port + GPIO_O_DR2R) = ((ui32Strength & 1) ?
+                                     (HWREG(ui32Port + GPIO_O_DR2R) |
+                                      ui8Pins) :
+                                     (HWREG(ui32Port + GPIO_O_DR2R) &
+                                      ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_DR4R) = ((ui32Strength & 2) ?
+                                     (HWREG(ui32Port + GPIO_O_DR4R) |
+                                      ui8Pins) :
+                                     (HWREG(ui32Port + GPIO_O_DR4R) &
+                                      ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_DR8R) = ((ui32Strength & 4) ?
+                                     (HWREG(ui32Port + GPIO_O_DR8R) |
+                                      ui8Pins) :
+                                     (HWREG(ui32Port + GPIO_O_DR8R) &
+                                      ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_SLR) = ((ui32Strength & 8) ?
+                                    (HWREG(ui32Port + GPIO_O_SLR) |
+                                     ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_SLR) &
+                                     ~(ui8Pins)));
+
+
+    /*
+       Set the pin type.
+    */
+    HWREG(ui32Port + GPIO_O_ODR) = ((ui32PinType & 1) ?
+                                    (HWREG(ui32Port + GPIO_O_ODR) | ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_ODR) & ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_PUR) = ((ui32PinType & 2) ?
+                                    (HWREG(ui32Port + GPIO_O_PUR) | ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_PUR) & ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_PDR) = ((ui32PinType & 4) ?
+                                    (HWREG(ui32Port + GPIO_O_PDR) | ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_PDR) & ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_DEN) = ((ui32PinType & 8) ?
+                                    (HWREG(ui32Port + GPIO_O_DEN) | ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_DEN) & ~(ui8Pins)));
 
-      for(ui8Bit = 0; ui8Bit < 8; ui8Bit++)
-      {
-          if(ui8Pins & (1 << ui8Bit))
-          {
-              HWREG(ui32Port + GPIO_O_PC) = (HWREG(ui32Port + GPIO_O_PC) &
-                                             ~(0x3 << (2 * ui8Bit)));
-              HWREG(ui32Port + GPIO_O_PC) |= (((ui32Strength >> 5) & 0x3) <<
-                                              (2 * ui8Bit));
-          }
-      }
-
-      /*
-         Set the output drive strength.
-      */
-      HWREG(ui32Port + GPIO_O_DR2R) = ((ui32Strength & 1) ?
-                                       (HWREG(ui32Port + GPIO_O_DR2R) |
-                                        ui8Pins) :
-                                       (HWREG(ui32Port + GPIO_O_DR2R) &
-                                        ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_DR4R) = ((ui32Strength & 2) ?
-                                       (HWREG(ui32Port + GPIO_O_DR4R) |
-                                        ui8Pins) :
-                                       (HWREG(ui32Port + GPIO_O_DR4R) &
-                                        ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_DR8R) = ((ui32Strength & 4) ?
-                                       (HWREG(ui32Port + GPIO_O_DR8R) |
-                                        ui8Pins) :
-                                       (HWREG(ui32Port + GPIO_O_DR8R) &
-                                        ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_SLR) = ((ui32Strength & 8) ?
-                                      (HWREG(ui32Port + GPIO_O_SLR) |
-                                       ui8Pins) :
-                                      (HWREG(ui32Port + GPIO_O_SLR) &
-                                       ~(ui8Pins)));
-
-
-      /*
-         Set the pin type.
-      */
-      HWREG(ui32Port + GPIO_O_ODR) = ((ui32PinType & 1) ?
-                                      (HWREG(ui32Port + GPIO_O_ODR) | ui8Pins) :
-                                      (HWREG(ui32Port + GPIO_O_ODR) & ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_PUR) = ((ui32PinType & 2) ?
-                                      (HWREG(ui32Port + GPIO_O_PUR) | ui8Pins) :
-                                      (HWREG(ui32Port + GPIO_O_PUR) & ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_PDR) = ((ui32PinType & 4) ?
-                                      (HWREG(ui32Port + GPIO_O_PDR) | ui8Pins) :
-                                      (HWREG(ui32Port + GPIO_O_PDR) & ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_DEN) = ((ui32PinType & 8) ?
-                                      (HWREG(ui32Port + GPIO_O_DEN) | ui8Pins) :
-                                      (HWREG(ui32Port + GPIO_O_DEN) & ~(ui8Pins)));
-
-
-      HWREG(ui32Port + GPIO_O_WAKELVL) = ((ui32PinType & 0x200) ?
-                                          (HWREG(ui32Port + GPIO_O_WAKELVL) |
-                                           ui8Pins) :
-                                          (HWREG(ui32Port + GPIO_O_WAKELVL) &
-                                           ~(ui8Pins)));
-      HWREG(ui32Port + GPIO_O_WAKEPEN) = ((ui32PinType & 0x300) ?
-                                          (HWREG(ui32Port + GPIO_O_WAKEPEN) |
-                                           ui8Pins) :
-                                          (HWREG(ui32Port + GPIO_O_WAKEPEN) &
-                                           ~(ui8Pins)));
+
+    HWREG(ui32Port + GPIO_O_WAKELVL) = ((ui32PinType & 0x200) ?
+                                        (HWREG(ui32Port + GPIO_O_WAKELVL) |
+                                         ui8Pins) :
+                                        (HWREG(ui32Port + GPIO_O_WAKELVL) &
+                                         ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_WAKEPEN) = ((ui32PinType & 0x300) ?
+                                        (HWREG(ui32Port + GPIO_O_WAKEPEN) |
+                                         ui8Pins) :
+                                        (HWREG(ui32Port + GPIO_O_WAKEPEN) &
+                                         ~(ui8Pins)));
 
      
-      return ERR_STAT_OK;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+  ! Hands the specified pin(s) over to a peripheral.
+
+  ! \param ui32Port is the base address of the GPIO port.
+  ! \param ui8Pins is the bit-packed representation of the pin(s).
+  ! \param ui8Func is the port control (PMCx) value of the peripheral signal.
+  !
+  ! This function sets the alternate function select bit and the port mux
+  ! encoding of every specified pin, and enables its digital function.
+  ! The encoding of \e ui8Func is given per pin in the device data sheet
+  ! (for example 1 selects U0Rx/U0Tx on PA0/PA1).
+  
+/******************************************************************************/
+errStat GPIO_AltFunctionSet(u32 ui32Port, u8 ui8Pins, u8 ui8Func)
+{
+    u8 ui8Bit;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    /*
+      Check the arguments.
+    */
+    if (!_GPIOBaseValid(ui32Port))
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_ALT_FUNCTION_SET, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
+    }
+    if (ui8Func > 0x0F)
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_ALT_FUNCTION_SET, GPIO_E_PARAM_VALUE);
+      return ERR_STAT_NOK;
     }
-    return ERR_STAT_NOK;
+#endif
+
+    for(ui8Bit = 0; ui8Bit < 8; ui8Bit++)
+    {
+        if(ui8Pins & (1 << ui8Bit))
+        {
+            HWREG(ui32Port + GPIO_O_PCTL) = ((HWREG(ui32Port + GPIO_O_PCTL) &
+                                              ~(0xFUL << (4 * ui8Bit))) |
+                                             ((u32)ui8Func << (4 * ui8Bit)));
+        }
+    }
+    HWREG(ui32Port + GPIO_O_AFSEL) |= ui8Pins;
+    HWREG(ui32Port + GPIO_O_AMSEL) &= ~(ui8Pins);
+    HWREG(ui32Port + GPIO_O_DEN) |= ui8Pins;
+    return ERR_STAT_OK;
 }
 
+/******************************************************************************
+
+  ! Sets the interrupt type of the specified pin(s).
+
+  ! \param ui32Port is the base address of the GPIO port.
+  ! \param ui8Pins is the bit-packed representation of the pin(s).
+  ! \param ui32IntType is the interrupt trigger of the pin(s).
+  !
+  ! \e ui32IntType is one of GPIO_FALLING_EDGE, GPIO_RISING_EDGE,
+  ! GPIO_BOTH_EDGES, GPIO_LOW_LEVEL or GPIO_HIGH_LEVEL. The pins should be
+  ! masked while their type is changed, a stale edge is cleared here.
+
+/******************************************************************************/
+errStat GPIO_IntTypeSet(u32 ui32Port, u8 ui8Pins, u32 ui32IntType)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    /*
+      Check the arguments.
+    */
+    if (!_GPIOBaseValid(ui32Port))
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_INT_TYPE_SET, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
+    }
+    if ((ui32IntType != GPIO_FALLING_EDGE) && (ui32IntType != GPIO_RISING_EDGE) &&
+        (ui32IntType != GPIO_BOTH_EDGES) && (ui32IntType != GPIO_LOW_LEVEL) &&
+        (ui32IntType != GPIO_HIGH_LEVEL))
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_INT_TYPE_SET, GPIO_E_PARAM_VALUE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Port + GPIO_O_IBE) = ((ui32IntType & 1) ?
+                                    (HWREG(ui32Port + GPIO_O_IBE) | ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_IBE) & ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_IS) = ((ui32IntType & 2) ?
+                                   (HWREG(ui32Port + GPIO_O_IS) | ui8Pins) :
+                                   (HWREG(ui32Port + GPIO_O_IS) & ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_IEV) = ((ui32IntType & 4) ?
+                                    (HWREG(ui32Port + GPIO_O_IEV) | ui8Pins) :
+                                    (HWREG(ui32Port + GPIO_O_IEV) & ~(ui8Pins)));
+    HWREG(ui32Port + GPIO_O_ICR) = ui8Pins;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+  ! Unmasks the interrupt of the specified pin(s).
+
+  ! \param ui32Port is the base address of the GPIO port.
+  ! \param ui8Pins is the bit-packed representation of the pin(s).
+  !
+  ! The port interrupt itself is enabled in the NVIC by the caller.
+
+/******************************************************************************/
+errStat GPIO_IntEnable(u32 ui32Port, u8 ui8Pins)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (!_GPIOBaseValid(ui32Port))
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_INT_ENABLE, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Port + GPIO_O_IM) |= ui8Pins;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+  ! Masks the interrupt of the specified pin(s).
+
+  ! \param ui32Port is the base address of the GPIO port.
+  ! \param ui8Pins is the bit-packed representation of the pin(s).
+
+/******************************************************************************/
+errStat GPIO_IntDisable(u32 ui32Port, u8 ui8Pins)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (!_GPIOBaseValid(ui32Port))
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_INT_DISABLE, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Port + GPIO_O_IM) &= ~(ui8Pins);
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+  ! Registers the function called from the interrupt of a port.
+
+  ! \param ui32Port is the base address of the GPIO port.
+  ! \param pfnHandler is the function to call, or 0 to unregister.
+  !
+  ! The handler runs in interrupt context and receives the port and the
+  ! pins whose interrupt was pending, those have already been cleared. Only
+  ! one handler serves a port, whatever pins it owns.
+
+/******************************************************************************/
+errStat GPIO_IntRegister(u32 ui32Port, void (*pfnHandler)(u32 ui32Port, u8 ui8Pins))
+{
+    u8 ui8Index = _GPIOIndex(ui32Port);
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Index >= GPIO_PORT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPIO, GPIO_API_INT_REGISTER, GPIO_E_PARAM_PORT);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    GPIO_handlers[ui8Index] = pfnHandler;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Common interrupt body: clears the pending edges of the port before the
+    handler runs, so an edge during the handler raises the interrupt again.
+
+/******************************************************************************/
+static void
+_GPIOIntHandler(u32 ui32Port, u8 ui8Index)
+{
+    u8 ui8Pins = (u8)HWREG(ui32Port + GPIO_O_MIS);
+
+    HWREG(ui32Port + GPIO_O_ICR) = ui8Pins;
+
+    if ((GPIO_handlers[ui8Index] != 0) && (ui8Pins != 0))
+    {
+      GPIO_handlers[ui8Index](ui32Port, ui8Pins);
+    }
+}
+
+void GPIOA_Handler(void)
+{
+    _GPIOIntHandler(GPIO_PORTA_BASE, 0);
+}
+
+void GPIOB_Handler(void)
+{
+    _GPIOIntHandler(GPIO_PORTB_BASE, 1);
+}
+
+void GPIOC_Handler(void)
+{
+    _GPIOIntHandler(GPIO_PORTC_BASE, 2);
+}
+
+void GPIOD_Handler(void)
+{
+    _GPIOIntHandler(GPIO_PORTD_BASE, 3);
+}
+
+void GPIOE_Handler(void)
+{
+    _GPIOIntHandler(GPIO_PORTE_BASE, 4);
+}
+
+void GPIOF_Handler(void)
+{
+    _GPIOIntHandler(GPIO_PORTF_BASE, 5);
+}
@@ -2,15 +2,7 @@
 #define GPIO_H
 
 
-/*****************************************************************************
- Macros for hardware access.
-*****************************************************************************/
-#define HWREG(x)                                                              \
-        (*((volatile u32 *)(x)))
-#define HWREGH(x)                                                             \
-        (*((volatile u16 *)(x)))
-#define HWREGB(x)                                                             \
-        (*((volatile u8 *)(x)))
+#include "HW_TYPES.h"
 
 
 /******************************************************************************
@@ -152,6 +144,25 @@
 #define GPIO_PIN_TYPE_WAKE_HIGH 0x00000208  /* Hibernate wake, high            */
 #define GPIO_PIN_TYPE_WAKE_LOW  0x00000108  /* Hibernate wake, low             */
 
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define GPIO_API_DIR_MODE_SET     0x00
+#define GPIO_API_PIN_READ         0x01
+#define GPIO_API_PIN_WRITE        0x02
+#define GPIO_API_PAD_CONFIG_SET   0x03
+#define GPIO_API_ALT_FUNCTION_SET 0x04
+#define GPIO_API_INT_TYPE_SET     0x05
+#define GPIO_API_INT_ENABLE       0x06
+#define GPIO_API_INT_DISABLE      0x07
+#define GPIO_API_INT_REGISTER     0x08
+
+#define GPIO_E_PARAM_PORT         0x0A  /* Invalid port base address       */
+#define GPIO_E_PARAM_VALUE        0x0B  /* Invalid mode, strength or type  */
+#define GPIO_E_PARAM_POINTER      0x0C  /* Null pointer                    */
+
 /******************************************************************************/
 /*
 /* Prototypes for the APIs.
@@ -161,5 +172,23 @@ extern errStat GPIO_DirModeSet(u32 ui32Port, u8 ui8Pins, u32 ui32PinIO);
 extern errStat GPIO_PinRead(u32 ui32Port, u8 ui8Pins, u8* ui8Val);
 extern errStat GPIO_PinWrite(u32 ui32Port, u8 ui8Pins, u8 ui8Val);
 extern errStat GPIO_PadConfigSet(u32 ui32Port, u8 ui8Pins,u32 ui32Strength, u32 ui32PinType);
+extern errStat GPIO_AltFunctionSet(u32 ui32Port, u8 ui8Pins, u8 ui8Func);
+extern errStat GPIO_IntTypeSet(u32 ui32Port, u8 ui8Pins, u32 ui32IntType);
+extern errStat GPIO_IntEnable(u32 ui32Port, u8 ui8Pins);
+extern errStat GPIO_IntDisable(u32 ui32Port, u8 ui8Pins);
+extern errStat GPIO_IntRegister(u32 ui32Port, void (*pfnHandler)(u32 ui32Port, u8 ui8Pins));
+
+/******************************************************************************
+
+ Interrupt service routines, to be placed in the vector table of the startup
+ file at the GPIO port A to F entries.
+
+/*******************************************************************************/
+extern void GPIOA_Handler(void);
+extern void GPIOB_Handler(void);
+extern void GPIOC_Handler(void);
+extern void GPIOD_Handler(void);
+extern void GPIOE_Handler(void);
+extern void GPIOF_Handler(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,252 @@
+#include "STD_TYPES.h"
+#include "gpt.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+/* Number of timer instances served by this driver */
+#define GPT_NUM                 3
+
+/* Match handlers registered by upper layers */
+static ECU_STATE void (*GPT_handlers[GPT_NUM])(void);
+
+/******************************************************************************
+    \param ui32Base is the base address of the timer.                          
+                                                                               
+    This function shall determine the driver index of a timer base address.   
+                                                                               
+    \return Returns the index, or GPT_NUM if the base address is not valid.    
+                                                                               
+/******************************************************************************/
+static u8
+_GPTIndex(u32 ui32Base)
+{
+    return((ui32Base == TIMER0_BASE) ? 0 :
+           (ui32Base == TIMER1_BASE) ? 1 :
+           (ui32Base == TIMER2_BASE) ? 2 : GPT_NUM);
+}
+
+/******************************************************************************
+
+    Starts a timer as a free running 32 bit up counter clocked by the system
+    clock, wrapping at 2^32. The match interrupt is left disabled.
+
+    \param ui32Base is the base address of the timer.
+
+    The timer clock must be enabled through SYSCTL_controlTimer before
+    calling this function. The counter stalls while the debugger halts the
+    core so time does not jump while single stepping.
+
+/******************************************************************************/
+errStat GPT_Init(u32 ui32Base)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_GPTIndex(ui32Base) >= GPT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_INIT, GPT_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Base + TIMER_O_CTL) &= ~(TIMER_CTL_TAEN);
+    HWREG(ui32Base + TIMER_O_CFG) = TIMER_CFG_32_BIT_TIMER;
+    HWREG(ui32Base + TIMER_O_TAMR) = TIMER_TAMR_TAMR_PERIOD | TIMER_TAMR_TACDIR | TIMER_TAMR_TAMIE;
+    HWREG(ui32Base + TIMER_O_TAILR) = 0xFFFFFFFF;
+    HWREG(ui32Base + TIMER_O_IMR) = 0;
+    HWREG(ui32Base + TIMER_O_ICR) = TIMER_INT_TATO | TIMER_INT_TAM;
+    HWREG(ui32Base + TIMER_O_CTL) |= TIMER_CTL_TAEN | TIMER_CTL_TASTALL;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Reads the free running counter.
+
+    \param ui32Base is the base address of the timer.
+    \param ui32Value receives the counter value in system clock cycles.
+
+/******************************************************************************/
+errStat GPT_CounterGet(u32 ui32Base, u32* ui32Value)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_GPTIndex(ui32Base) >= GPT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_COUNTER_GET, GPT_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if (ui32Value == 0)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_COUNTER_GET, GPT_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    *ui32Value = (u32)HWREG(ui32Base + TIMER_O_TAV);
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Arms the match interrupt for the next time the counter equals a value.
+
+    \param ui32Base is the base address of the timer.
+    \param ui32Match is the counter value to interrupt at.
+
+    A match value the counter already passed fires only after the counter
+    wrapped, callers must read the counter after arming to detect it.
+
+/******************************************************************************/
+errStat GPT_MatchSet(u32 ui32Base, u32 ui32Match)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_GPTIndex(ui32Base) >= GPT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_MATCH_SET, GPT_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Base + TIMER_O_TAMATCHR) = ui32Match;
+    HWREG(ui32Base + TIMER_O_ICR) = TIMER_INT_TAM;
+    HWREG(ui32Base + TIMER_O_IMR) |= TIMER_INT_TAM;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Disarms the match interrupt, the counter keeps running.
+
+    \param ui32Base is the base address of the timer.
+
+/******************************************************************************/
+errStat GPT_MatchDisable(u32 ui32Base)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_GPTIndex(ui32Base) >= GPT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_MATCH_DISABLE, GPT_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Base + TIMER_O_IMR) &= ~(TIMER_INT_TAM);
+    HWREG(ui32Base + TIMER_O_ICR) = TIMER_INT_TAM;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Registers the function called from the timer interrupt on a match or a
+    uDMA completion of the timer channel.
+
+    \param ui32Base is the base address of the timer.
+    \param pfnHandler is the function to call, or 0 to unregister.
+
+/******************************************************************************/
+errStat GPT_IntRegister(u32 ui32Base, void (*pfnHandler)(void))
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_GPTIndex(ui32Base) >= GPT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_INT_REGISTER, GPT_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    GPT_handlers[_GPTIndex(ui32Base)] = pfnHandler;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Starts a timer as a periodic 32 bit down counter that times out every
+    ui32Period system clock cycles. No interrupt is enabled: the time-out
+    raw status is the uDMA request of the timer, so a uDMA channel assigned
+    to it moves data at a fixed rate without the CPU.
+
+    \param ui32Base is the base address of the timer.
+    \param ui32Period is the time-out period in system clock cycles.
+
+    The timer clock must be enabled through SYSCTL_controlTimer before
+    calling this function.
+
+/******************************************************************************/
+errStat GPT_PeriodicInit(u32 ui32Base, u32 ui32Period)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_GPTIndex(ui32Base) >= GPT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_PERIODIC_INIT, GPT_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if (ui32Period == 0)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_PERIODIC_INIT, GPT_E_PARAM_PERIOD);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Base + TIMER_O_CTL) &= ~(TIMER_CTL_TAEN);
+    HWREG(ui32Base + TIMER_O_CFG) = TIMER_CFG_32_BIT_TIMER;
+    HWREG(ui32Base + TIMER_O_TAMR) = TIMER_TAMR_TAMR_PERIOD;
+    HWREG(ui32Base + TIMER_O_TAILR) = ui32Period - 1;
+    HWREG(ui32Base + TIMER_O_IMR) = 0;
+    HWREG(ui32Base + TIMER_O_ICR) = TIMER_INT_TATO | TIMER_INT_TAM;
+    HWREG(ui32Base + TIMER_O_CTL) |= TIMER_CTL_TAEN | TIMER_CTL_TASTALL;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Stops a timer started by GPT_Init or GPT_PeriodicInit.
+
+    \param ui32Base is the base address of the timer.
+
+/******************************************************************************/
+errStat GPT_Stop(u32 ui32Base)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_GPTIndex(ui32Base) >= GPT_NUM)
+    {
+      Det_ReportError(MODULE_ID_GPT, GPT_API_STOP, GPT_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Base + TIMER_O_CTL) &= ~(TIMER_CTL_TAEN);
+    HWREG(ui32Base + TIMER_O_IMR) = 0;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Common interrupt body: acknowledges the match and calls the handler.
+    The handler also runs for uDMA completions of the timer channel, which
+    use the timer vector without a timer status bit.
+
+/******************************************************************************/
+static void
+_GPTIntHandler(u32 ui32Base, u8 ui8Index)
+{
+    HWREG(ui32Base + TIMER_O_ICR) = HWREG(ui32Base + TIMER_O_MIS);
+
+    if (GPT_handlers[ui8Index] != 0)
+    {
+      GPT_handlers[ui8Index]();
+    }
+}
+
+void TIMER0A_Handler(void)
+{
+    _GPTIntHandler(TIMER0_BASE, 0);
+}
+
+void TIMER1A_Handler(void)
+{
+    _GPTIntHandler(TIMER1_BASE, 1);
+}
+
+void TIMER2A_Handler(void)
+{
+    _GPTIntHandler(TIMER2_BASE, 2);
+}
@@ -0,0 +1,91 @@
+#ifndef GPT_H
+#define GPT_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the General-Purpose Timer register offsets.
+
+/*******************************************************************************/
+#define TIMER_O_CFG             0x00000000  /* GPTM Configuration              */
+#define TIMER_O_TAMR            0x00000004  /* GPTM Timer A Mode               */
+#define TIMER_O_CTL             0x0000000C  /* GPTM Control                    */
+#define TIMER_O_IMR             0x00000018  /* GPTM Interrupt Mask             */
+#define TIMER_O_RIS             0x0000001C  /* GPTM Raw Interrupt Status       */
+#define TIMER_O_MIS             0x00000020  /* GPTM Masked Interrupt Status    */
+#define TIMER_O_ICR             0x00000024  /* GPTM Interrupt Clear            */
+#define TIMER_O_TAILR           0x00000028  /* GPTM Timer A Interval Load      */
+#define TIMER_O_TAMATCHR        0x00000030  /* GPTM Timer A Match              */
+#define TIMER_O_TAR             0x00000048  /* GPTM Timer A                    */
+#define TIMER_O_TAV             0x00000050  /* GPTM Timer A Value              */
+
+/******************************************************************************
+  
+  The following are defines for the bit fields in the GPTM registers.
+  
+******************************************************************************/
+#define TIMER_CFG_32_BIT_TIMER  0x00000000  /* 32-bit timer configuration      */
+
+#define TIMER_TAMR_TAMR_1_SHOT  0x00000001  /* One-Shot Timer mode             */
+#define TIMER_TAMR_TAMR_PERIOD  0x00000002  /* Periodic Timer mode             */
+#define TIMER_TAMR_TACDIR       0x00000010  /* Timer A counts up               */
+#define TIMER_TAMR_TAMIE        0x00000020  /* Timer A Match Interrupt Enable  */
+
+#define TIMER_CTL_TAEN          0x00000001  /* Timer A Enable                  */
+#define TIMER_CTL_TASTALL       0x00000002  /* Timer A Stall Enable            */
+
+#define TIMER_INT_TATO          0x00000001  /* Timer A Time-Out                */
+#define TIMER_INT_TAM           0x00000010  /* Timer A Match                   */
+
+/*****************************************************************************
+ The following values define the bit field for the ui32Base argument to
+ several of the APIs.
+*****************************************************************************/
+#define TIMER0_BASE             0x40030000  /* Timer0                          */
+#define TIMER1_BASE             0x40031000  /* Timer1                          */
+#define TIMER2_BASE             0x40032000  /* Timer2                          */
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define GPT_API_INIT            0x00
+#define GPT_API_COUNTER_GET     0x01
+#define GPT_API_MATCH_SET       0x02
+#define GPT_API_MATCH_DISABLE   0x03
+#define GPT_API_INT_REGISTER    0x04
+#define GPT_API_PERIODIC_INIT   0x05
+#define GPT_API_STOP            0x06
+
+#define GPT_E_PARAM_BASE        0x0A  /* Invalid timer base address        */
+#define GPT_E_PARAM_POINTER     0x0B  /* Null pointer                      */
+#define GPT_E_PARAM_PERIOD      0x0C  /* Period of 0 cycles                */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat GPT_Init(u32 ui32Base);
+extern errStat GPT_CounterGet(u32 ui32Base, u32* ui32Value);
+extern errStat GPT_MatchSet(u32 ui32Base, u32 ui32Match);
+extern errStat GPT_MatchDisable(u32 ui32Base);
+extern errStat GPT_IntRegister(u32 ui32Base, void (*pfnHandler)(void));
+extern errStat GPT_PeriodicInit(u32 ui32Base, u32 ui32Period);
+extern errStat GPT_Stop(u32 ui32Base);
+
+/******************************************************************************
+ 
+ Interrupt service routines, to be placed in the vector table of the startup
+ file at the Timer 0A, 1A and 2A entries.
+ 
+/*******************************************************************************/
+extern void TIMER0A_Handler(void);
+extern void TIMER1A_Handler(void);
+extern void TIMER2A_Handler(void);
+
+#endif
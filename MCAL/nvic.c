@@ -0,0 +1,139 @@
+#include "STD_TYPES.h"
+#include "nvic.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+#if defined(__ICCARM__)
+#include <intrinsics.h>
+#endif
+
+/******************************************************************************
+
+    Enables an interrupt line in the NVIC.
+
+    \param ui8Int is the interrupt number (NVIC_INT_xxx).
+
+/******************************************************************************/
+errStat NVIC_IntEnable(u8 ui8Int)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Int >= NVIC_INT_NUM)
+    {
+      Det_ReportError(MODULE_ID_NVIC, NVIC_API_INT_ENABLE, NVIC_E_PARAM_INT);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(NVIC_EN0 + ((ui8Int / 32) * 4)) = (1UL << (ui8Int % 32));
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Disables an interrupt line in the NVIC.
+
+    \param ui8Int is the interrupt number (NVIC_INT_xxx).
+
+/******************************************************************************/
+errStat NVIC_IntDisable(u8 ui8Int)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Int >= NVIC_INT_NUM)
+    {
+      Det_ReportError(MODULE_ID_NVIC, NVIC_API_INT_DISABLE, NVIC_E_PARAM_INT);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(NVIC_DIS0 + ((ui8Int / 32) * 4)) = (1UL << (ui8Int % 32));
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Sets the priority of an interrupt line.
+
+    \param ui8Int is the interrupt number (NVIC_INT_xxx).
+    \param ui8Priority is the priority from 0 (highest) to
+    NVIC_PRIORITY_LOWEST.
+
+/******************************************************************************/
+errStat NVIC_IntPrioritySet(u8 ui8Int, u8 ui8Priority)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Int >= NVIC_INT_NUM)
+    {
+      Det_ReportError(MODULE_ID_NVIC, NVIC_API_INT_PRIORITY_SET, NVIC_E_PARAM_INT);
+      return ERR_STAT_NOK;
+    }
+    if (ui8Priority > NVIC_PRIORITY_LOWEST)
+    {
+      Det_ReportError(MODULE_ID_NVIC, NVIC_API_INT_PRIORITY_SET, NVIC_E_PARAM_PRIORITY);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREGB(NVIC_PRI0 + ui8Int) = (u8)(ui8Priority << (8 - NVIC_PRIORITY_BITS));
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Sets an interrupt line pending, its handler runs as soon as the priority
+    allows it.
+
+    \param ui8Int is the interrupt number (NVIC_INT_xxx).
+
+/******************************************************************************/
+errStat NVIC_IntPend(u8 ui8Int)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Int >= NVIC_INT_NUM)
+    {
+      Det_ReportError(MODULE_ID_NVIC, NVIC_API_INT_PEND, NVIC_E_PARAM_INT);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(NVIC_PEND0 + ((ui8Int / 32) * 4)) = (1UL << (ui8Int % 32));
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Masks all configurable interrupts (PRIMASK) and returns the previous
+    mask so that critical sections can nest.
+
+    \return the PRIMASK value before the call.
+
+/******************************************************************************/
+u32 NVIC_IntMasterDisable(void)
+{
+    u32 ui32PriMask = 0;
+#if defined(__ICCARM__)
+    ui32PriMask = __get_PRIMASK();
+    __disable_interrupt();
+#elif defined(__GNUC__) && defined(__arm__)
+    __asm volatile ("mrs %0, primask\n cpsid i" : "=r" (ui32PriMask) : : "memory");
+#endif
+    return ui32PriMask;
+}
+
+/******************************************************************************
+
+    Restores the PRIMASK value returned by NVIC_IntMasterDisable.
+
+    \param ui32PriMask is the value returned by NVIC_IntMasterDisable.
+
+/******************************************************************************/
+void NVIC_IntMasterRestore(u32 ui32PriMask)
+{
+#if defined(__ICCARM__)
+    __set_PRIMASK(ui32PriMask);
+#elif defined(__GNUC__) && defined(__arm__)
+    __asm volatile ("msr primask, %0" : : "r" (ui32PriMask) : "memory");
+#else
+    (void)ui32PriMask;
+#endif
+}
@@ -0,0 +1,76 @@
+#ifndef NVIC_H
+#define NVIC_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the NVIC register addresses.
+
+/*******************************************************************************/
+#define NVIC_EN0                0xE000E100  /* Interrupt 0-31 Set Enable       */
+#define NVIC_DIS0               0xE000E180  /* Interrupt 0-31 Clear Enable     */
+#define NVIC_PEND0              0xE000E200  /* Interrupt 0-31 Set Pending      */
+#define NVIC_UNPEND0            0xE000E280  /* Interrupt 0-31 Clear Pending    */
+#define NVIC_PRI0               0xE000E400  /* Interrupt 0-3 Priority          */
+
+/******************************************************************************
+ 
+ Interrupt numbers (vector number - 16) used as the ui8Int argument.
+ 
+/*******************************************************************************/
+#define NVIC_INT_GPIOA          0           /* GPIO Port A                     */
+#define NVIC_INT_GPIOB          1           /* GPIO Port B                     */
+#define NVIC_INT_GPIOC          2           /* GPIO Port C                     */
+#define NVIC_INT_GPIOD          3           /* GPIO Port D                     */
+#define NVIC_INT_GPIOE          4           /* GPIO Port E                     */
+#define NVIC_INT_GPIOF          30          /* GPIO Port F                     */
+#define NVIC_INT_UART0          5           /* UART0 Rx and Tx                 */
+#define NVIC_INT_UART1          6           /* UART1 Rx and Tx                 */
+#define NVIC_INT_SSI0           7           /* SSI0 Rx and Tx                  */
+#define NVIC_INT_TIMER0A        19          /* 16/32-Bit Timer 0A              */
+#define NVIC_INT_TIMER1A        21          /* 16/32-Bit Timer 1A              */
+#define NVIC_INT_TIMER2A        23          /* 16/32-Bit Timer 2A              */
+#define NVIC_INT_SSI1           34          /* SSI1 Rx and Tx                  */
+#define NVIC_INT_CAN0           39          /* CAN0                            */
+#define NVIC_INT_SSI2           57          /* SSI2 Rx and Tx                  */
+#define NVIC_INT_SSI3           58          /* SSI3 Rx and Tx                  */
+#define NVIC_INT_NUM            139         /* Number of interrupt lines       */
+
+/******************************************************************************
+ 
+ The TM4C123 implements 3 priority bits, 0 is the highest priority and 7
+ the lowest.
+ 
+/*******************************************************************************/
+#define NVIC_PRIORITY_BITS      3
+#define NVIC_PRIORITY_LOWEST    7
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define NVIC_API_INT_ENABLE       0x00
+#define NVIC_API_INT_DISABLE      0x01
+#define NVIC_API_INT_PRIORITY_SET 0x02
+#define NVIC_API_INT_PEND         0x03
+
+#define NVIC_E_PARAM_INT          0x0A  /* Invalid interrupt number        */
+#define NVIC_E_PARAM_PRIORITY     0x0B  /* Priority out of range           */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat NVIC_IntEnable(u8 ui8Int);
+extern errStat NVIC_IntDisable(u8 ui8Int);
+extern errStat NVIC_IntPrioritySet(u8 ui8Int, u8 ui8Priority);
+extern errStat NVIC_IntPend(u8 ui8Int);
+extern u32 NVIC_IntMasterDisable(void);
+extern void NVIC_IntMasterRestore(u32 ui32PriMask);
+
+#endif
@@ -0,0 +1,258 @@
+#include "STD_TYPES.h"
+#include "ssi.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+/* Number of SSI instances served by this driver */
+#define SSI_NUM                 4
+
+/* Sources that have a bit in the interrupt mask register */
+#define SSI_INT_MASK_BITS       (SSI_INT_ROR | SSI_INT_RT | SSI_INT_RX | SSI_INT_TX)
+
+/* Interrupt handlers registered by upper layers, indexed by SSI */
+static ECU_STATE void (*SSI_handlers[SSI_NUM])(void);
+
+/******************************************************************************
+    \param ui32Base is the base address of the SSI module.
+
+    This function shall determine the driver index of an SSI base address.
+
+    \return Returns the index, or SSI_NUM if the base address is not valid.
+
+/******************************************************************************/
+static u8
+_SSIIndex(u32 ui32Base)
+{
+    return((ui32Base == SSI0_BASE) ? 0 :
+           (ui32Base == SSI1_BASE) ? 1 :
+           (ui32Base == SSI2_BASE) ? 2 :
+           (ui32Base == SSI3_BASE) ? 3 : SSI_NUM);
+}
+
+/******************************************************************************
+
+    Configures an SSI as a master sending 8 bit Freescale SPI frames, clock
+    idle low and data captured on the rising edge (mode 0).
+
+    \param ui32Base is the base address of the SSI module.
+    \param ui32SSIClk is the rate of the clock supplied to the SSI module.
+    \param ui32BitRate is the desired bit rate.
+
+    The bit rate is SSIClk / (CPSDVSR * (1 + SCR)); the smallest even
+    prescaler that lets SCR fit is chosen, so the rate is at most the one
+    requested. The SSI clock must be enabled through SYSCTL_controlSSI and
+    its pins handed over through GPIO_AltFunctionSet before calling this
+    function. All SSI interrupts are left masked.
+
+/******************************************************************************/
+errStat SSI_Init(u32 ui32Base, u32 ui32SSIClk, u32 ui32BitRate)
+{
+    u32 ui32MaxBitRate;
+    u32 ui32PreDiv;
+    u32 ui32SCR;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    /*
+      Check the arguments, the master bit rate is at most half the SSI
+      clock and at least SSIClk / (254 * 256).
+    */
+    if (_SSIIndex(ui32Base) >= SSI_NUM)
+    {
+      Det_ReportError(MODULE_ID_SSI, SSI_API_INIT, SSI_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if ((ui32BitRate == 0) || (ui32SSIClk < (SSI_CPSR_MIN * ui32BitRate)) ||
+        ((ui32SSIClk / ui32BitRate) > (SSI_CPSR_MAX * (SSI_SCR_MAX + 1))))
+    {
+      Det_ReportError(MODULE_ID_SSI, SSI_API_INIT, SSI_E_PARAM_BITRATE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    /*
+      Disable the SSI while it is being configured, master mode.
+    */
+    HWREG(ui32Base + SSI_O_CR1) = 0;
+
+    ui32MaxBitRate = ui32SSIClk / ui32BitRate;
+    ui32PreDiv = 0;
+    do
+    {
+      ui32PreDiv += 2;
+      ui32SCR = (ui32MaxBitRate / ui32PreDiv) - 1;
+    }
+    while (ui32SCR > SSI_SCR_MAX);
+
+    HWREG(ui32Base + SSI_O_CC) = SSI_CC_CS_SYSCLK;
+    HWREG(ui32Base + SSI_O_CPSR) = ui32PreDiv;
+    HWREG(ui32Base + SSI_O_CR0) = (ui32SCR << SSI_CR0_SCR_S) | SSI_CR0_FRF_MOTO | SSI_CR0_DSS_8;
+    HWREG(ui32Base + SSI_O_IM) = 0;
+    HWREG(ui32Base + SSI_O_ICR) = SSI_INT_ROR | SSI_INT_RT;
+
+    HWREG(ui32Base + SSI_O_CR1) = SSI_CR1_SSE;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Writes one frame to the transmit FIFO if it has room.
+
+    \param ui32Base is the base address of the SSI module.
+    \param ui8Data is the frame to send.
+
+    \return ERR_STAT_NOK if the FIFO is full, the frame is then not sent.
+
+/******************************************************************************/
+errStat SSI_DataPutNonBlocking(u32 ui32Base, u8 ui8Data)
+{
+    if (HWREG(ui32Base + SSI_O_SR) & SSI_SR_TNF)
+    {
+      HWREG(ui32Base + SSI_O_DR) = ui8Data;
+      return ERR_STAT_OK;
+    }
+    return ERR_STAT_NOK;
+}
+
+/******************************************************************************
+
+    Tells whether the SSI is still shifting or has frames left to send.
+
+    \param ui32Base is the base address of the SSI module.
+
+    \return 1 while busy, 0 once the last frame has left the shifter.
+
+/******************************************************************************/
+u8 SSI_IsBusy(u32 ui32Base)
+{
+    return((HWREG(ui32Base + SSI_O_SR) & SSI_SR_BSY) ? 1 : 0);
+}
+
+/******************************************************************************
+
+    Unmasks the specified SSI interrupt sources.
+
+    \param ui32Base is the base address of the SSI module.
+    \param ui32IntFlags is a bit mask of SSI_INT_xxx values.
+
+    SSI_INT_TXEOT switches the transmit interrupt to end of transmission
+    mode: it then asserts once the FIFO is empty and the last frame has been
+    shifted out, instead of while the FIFO is half empty.
+
+/******************************************************************************/
+errStat SSI_IntEnable(u32 ui32Base, u32 ui32IntFlags)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_SSIIndex(ui32Base) >= SSI_NUM)
+    {
+      Det_ReportError(MODULE_ID_SSI, SSI_API_INT_ENABLE, SSI_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    if (ui32IntFlags & SSI_INT_TXEOT)
+    {
+      HWREG(ui32Base + SSI_O_CR1) |= SSI_CR1_EOT;
+      ui32IntFlags |= SSI_INT_TX;
+    }
+    HWREG(ui32Base + SSI_O_IM) |= (ui32IntFlags & SSI_INT_MASK_BITS);
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Masks the specified SSI interrupt sources.
+
+    \param ui32Base is the base address of the SSI module.
+    \param ui32IntFlags is a bit mask of SSI_INT_xxx values.
+
+    SSI_INT_TXEOT also returns the transmit interrupt to FIFO level mode.
+
+/******************************************************************************/
+errStat SSI_IntDisable(u32 ui32Base, u32 ui32IntFlags)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_SSIIndex(ui32Base) >= SSI_NUM)
+    {
+      Det_ReportError(MODULE_ID_SSI, SSI_API_INT_DISABLE, SSI_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    if (ui32IntFlags & SSI_INT_TXEOT)
+    {
+      ui32IntFlags |= SSI_INT_TX;
+    }
+    HWREG(ui32Base + SSI_O_IM) &= ~(ui32IntFlags & SSI_INT_MASK_BITS);
+    if (ui32IntFlags & SSI_INT_TXEOT)
+    {
+      HWREG(ui32Base + SSI_O_CR1) &= ~(SSI_CR1_EOT);
+    }
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Registers the function called from the SSI interrupt.
+
+    \param ui32Base is the base address of the SSI module.
+    \param pfnHandler is the function to call, or 0 to unregister.
+
+    The handler runs in interrupt context and must not block. The transmit
+    interrupt is a level: the handler has to fill the FIFO or mask it.
+
+/******************************************************************************/
+errStat SSI_IntRegister(u32 ui32Base, void (*pfnHandler)(void))
+{
+    u8 ui8Index = _SSIIndex(ui32Base);
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Index >= SSI_NUM)
+    {
+      Det_ReportError(MODULE_ID_SSI, SSI_API_INT_REGISTER, SSI_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    SSI_handlers[ui8Index] = pfnHandler;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Common interrupt body: acknowledges the receive sources that can be
+    cleared and calls the registered handler.
+
+/******************************************************************************/
+static void
+_SSIIntHandler(u32 ui32Base, u8 ui8Index)
+{
+    u32 ui32Status = HWREG(ui32Base + SSI_O_MIS);
+
+    HWREG(ui32Base + SSI_O_ICR) = ui32Status & (SSI_INT_ROR | SSI_INT_RT);
+
+    if (SSI_handlers[ui8Index] != 0)
+    {
+      SSI_handlers[ui8Index]();
+    }
+}
+
+void SSI0_Handler(void)
+{
+    _SSIIntHandler(SSI0_BASE, 0);
+}
+
+void SSI1_Handler(void)
+{
+    _SSIIntHandler(SSI1_BASE, 1);
+}
+
+void SSI2_Handler(void)
+{
+    _SSIIntHandler(SSI2_BASE, 2);
+}
+
+void SSI3_Handler(void)
+{
+    _SSIIntHandler(SSI3_BASE, 3);
+}
@@ -0,0 +1,112 @@
+#ifndef SSI_H
+#define SSI_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the SSI register offsets.
+
+/*******************************************************************************/
+#define SSI_O_CR0               0x00000000  /* SSI Control 0                   */
+#define SSI_O_CR1               0x00000004  /* SSI Control 1                   */
+#define SSI_O_DR                0x00000008  /* SSI Data                        */
+#define SSI_O_SR                0x0000000C  /* SSI Status                      */
+#define SSI_O_CPSR              0x00000010  /* SSI Clock Prescale              */
+#define SSI_O_IM                0x00000014  /* SSI Interrupt Mask              */
+#define SSI_O_RIS               0x00000018  /* SSI Raw Interrupt Status        */
+#define SSI_O_MIS               0x0000001C  /* SSI Masked Interrupt Status     */
+#define SSI_O_ICR               0x00000020  /* SSI Interrupt Clear             */
+#define SSI_O_DMACTL            0x00000024  /* SSI DMA Control                 */
+#define SSI_O_CC                0x00000FC8  /* SSI Clock Configuration         */
+
+/******************************************************************************
+
+  The following are defines for the bit fields in the SSI registers.
+
+******************************************************************************/
+#define SSI_CR0_SCR_S           8           /* Serial Clock Rate shift         */
+#define SSI_CR0_SPH             0x00000080  /* Serial Clock Phase              */
+#define SSI_CR0_SPO             0x00000040  /* Serial Clock Polarity           */
+#define SSI_CR0_FRF_MOTO        0x00000000  /* Freescale SPI Frame Format      */
+#define SSI_CR0_DSS_8           0x00000007  /* 8-bit data                      */
+
+#define SSI_CR1_SSE             0x00000002  /* SSI Synchronous Serial Enable   */
+#define SSI_CR1_MS              0x00000004  /* SSI Master/Slave Select         */
+#define SSI_CR1_EOT             0x00000010  /* End of Transmission             */
+
+#define SSI_SR_TFE              0x00000001  /* SSI Transmit FIFO Empty         */
+#define SSI_SR_TNF              0x00000002  /* SSI Transmit FIFO Not Full      */
+#define SSI_SR_RNE              0x00000004  /* SSI Receive FIFO Not Empty      */
+#define SSI_SR_BSY              0x00000010  /* SSI Busy Bit                    */
+
+#define SSI_CPSR_MIN            2           /* Smallest even prescale divisor  */
+#define SSI_CPSR_MAX            254         /* Largest even prescale divisor   */
+#define SSI_SCR_MAX             255         /* Largest serial clock rate value */
+
+#define SSI_CC_CS_SYSCLK        0x00000000  /* Bit clock from the system clock */
+
+/******************************************************************************
+
+ Values that can be passed to SSI_IntEnable and SSI_IntDisable as the
+ ui32IntFlags parameter.
+
+/*******************************************************************************/
+#define SSI_INT_ROR             0x00000001  /* Receive overrun                 */
+#define SSI_INT_RT              0x00000002  /* Receive time-out                */
+#define SSI_INT_RX              0x00000004  /* Receive FIFO half full or more  */
+#define SSI_INT_TX              0x00000008  /* Transmit FIFO half empty or less*/
+#define SSI_INT_TXEOT           0x00000040  /* Transmission complete: the TX   */
+                                            /* interrupt in EOT mode (CR1.EOT) */
+
+/*****************************************************************************
+ The following values define the bit field for the ui32Base argument to
+ several of the APIs.
+*****************************************************************************/
+#define SSI0_BASE               0x40008000  /* SSI0                            */
+#define SSI1_BASE               0x40009000  /* SSI1                            */
+#define SSI2_BASE               0x4000A000  /* SSI2                            */
+#define SSI3_BASE               0x4000B000  /* SSI3                            */
+
+/* Depth of the hardware transmit and receive FIFOs */
+#define SSI_FIFO_DEPTH          8
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define SSI_API_INIT            0x00
+#define SSI_API_INT_ENABLE      0x01
+#define SSI_API_INT_DISABLE     0x02
+#define SSI_API_INT_REGISTER    0x03
+
+#define SSI_E_PARAM_BASE        0x0A  /* Invalid SSI base address          */
+#define SSI_E_PARAM_BITRATE     0x0B  /* Bit rate out of divisor range     */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat SSI_Init(u32 ui32Base, u32 ui32SSIClk, u32 ui32BitRate);
+extern errStat SSI_DataPutNonBlocking(u32 ui32Base, u8 ui8Data);
+extern u8 SSI_IsBusy(u32 ui32Base);
+extern errStat SSI_IntEnable(u32 ui32Base, u32 ui32IntFlags);
+extern errStat SSI_IntDisable(u32 ui32Base, u32 ui32IntFlags);
+extern errStat SSI_IntRegister(u32 ui32Base, void (*pfnHandler)(void));
+
+/******************************************************************************
+
+ Interrupt service routines, to be placed in the vector table of the startup
+ file at the SSI0 to SSI3 entries.
+
+/*******************************************************************************/
+extern void SSI0_Handler(void);
+extern void SSI1_Handler(void);
+extern void SSI2_Handler(void);
+extern void SSI3_Handler(void);
+
+#endif
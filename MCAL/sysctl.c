@@ -1,10 +1,22 @@
 #include "STD_TYPES.h"
+#include "HW_TYPES.h"
 #include "sysctl.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
 
 #define SYSCTL_BASEADDRESS 0x400FE000
 
-#define SYSCTL_RCC *((volatile u32*) (SYSCTL_BASEADDRESS + 0x060))
-#define SYSCTL_RCGGPIO *((volatile u32*)(SYSCTL_BASEADDRESS + 0x608))
+#define SYSCTL_RCC HWREG(SYSCTL_BASEADDRESS + 0x060)
+#define SYSCTL_RCGGPIO HWREG(SYSCTL_BASEADDRESS + 0x608)
+#define SYSCTL_RCGCUART HWREG(SYSCTL_BASEADDRESS + 0x618)
+#define SYSCTL_RCGCCAN HWREG(SYSCTL_BASEADDRESS + 0x634)
+#define SYSCTL_RCGCTIMER HWREG(SYSCTL_BASEADDRESS + 0x604)
+#define SYSCTL_RCGCDMA HWREG(SYSCTL_BASEADDRESS + 0x60C)
+#define SYSCTL_RCGCSSI HWREG(SYSCTL_BASEADDRESS + 0x61C)
+#define SYSCTL_RCGCEEPROM HWREG(SYSCTL_BASEADDRESS + 0x658)
+#define SYSCTL_RESC HWREG(SYSCTL_BASEADDRESS + 0x05C)
+#define SYSCTL_SREEPROM HWREG(SYSCTL_BASEADDRESS + 0x558)
 
 
 /* Masks used by SYSCTL_setSystemClock */
@@ -15,45 +27,290 @@
 /* API used to initialize (select) system clock to Clock argument */
 errStat SYSCTL_setSystemClock (u32 Clock)
 {
-  if (Clock == SYSCTL_MAIN_OSCILLATOR_CLOCK)
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (Clock != SYSCTL_MAIN_OSCILLATOR_CLOCK)
   {
-    SYSCTL_RCC &= SYSCTL_BYPASS_OSC;
-    SYSCTL_RCC &= Clock & SYSCTL_OSCSRC_MOSC &  SYSCTL_USESYSDIV;
-    return ERR_STAT_OK;
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_SET_SYSTEM_CLOCK, SYSCTL_E_PARAM_CLOCK);
+    return ERR_STAT_NOK;
   }
-  return ERR_STAT_NOK;
+#endif
+  
+  SYSCTL_RCC &= SYSCTL_BYPASS_OSC;
+  SYSCTL_RCC &= Clock & SYSCTL_OSCSRC_MOSC &  SYSCTL_USESYSDIV;
+  return ERR_STAT_OK;
 }
 
 
 /* API used to enable/disable GPIO peripheral */
 errStat SYSCTL_controlGPIO(u32 GPIO_Num, u8 status)
 {
+#if (DET_DEV_ERROR_DETECT == 1)
   if (
-      (
-        (GPIO_Num == SYSCTL_GPIO_A) || 
-        (GPIO_Num == SYSCTL_GPIO_B) || 
-        (GPIO_Num == SYSCTL_GPIO_C) || 
-        (GPIO_Num == SYSCTL_GPIO_D) || 
-        (GPIO_Num == SYSCTL_GPIO_E) || 
-        (GPIO_Num == SYSCTL_GPIO_F)
-      ) && 
-      (
-        (status == SYSCTL_GPIO_ENABLE) || 
-        (status == SYSCTL_GPIO_DISABLE)
-      )
+      (GPIO_Num != SYSCTL_GPIO_A) && 
+      (GPIO_Num != SYSCTL_GPIO_B) && 
+      (GPIO_Num != SYSCTL_GPIO_C) && 
+      (GPIO_Num != SYSCTL_GPIO_D) && 
+      (GPIO_Num != SYSCTL_GPIO_E) && 
+      (GPIO_Num != SYSCTL_GPIO_F)
      )
   {
-    switch(status)
-    {
-      case SYSCTL_GPIO_DISABLE:
-        SYSCTL_RCGGPIO &= ~GPIO_Num;
-      break;
-      
-      case SYSCTL_GPIO_ENABLE:
-        SYSCTL_RCGGPIO |= GPIO_Num;
-      break;
-    }
-    return ERR_STAT_OK;
-  }
-  return ERR_STAT_NOK;
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_GPIO, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+  if ((status != SYSCTL_GPIO_ENABLE) && (status != SYSCTL_GPIO_DISABLE))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_GPIO, SYSCTL_E_PARAM_STATUS);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  switch(status)
+  {
+    case SYSCTL_GPIO_DISABLE:
+      SYSCTL_RCGGPIO &= ~GPIO_Num;
+    break;
+    
+    case SYSCTL_GPIO_ENABLE:
+      SYSCTL_RCGGPIO |= GPIO_Num;
+    break;
+  }
+  return ERR_STAT_OK;
+}
+
+/* API used to enable/disable UART peripheral */
+errStat SYSCTL_controlUART(u32 UART_Num, u8 status)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (
+      (UART_Num != SYSCTL_UART_0) && 
+      (UART_Num != SYSCTL_UART_1) && 
+      (UART_Num != SYSCTL_UART_2) && 
+      (UART_Num != SYSCTL_UART_3) && 
+      (UART_Num != SYSCTL_UART_4) && 
+      (UART_Num != SYSCTL_UART_5) && 
+      (UART_Num != SYSCTL_UART_6) && 
+      (UART_Num != SYSCTL_UART_7)
+     )
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_UART, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+  if ((status != SYSCTL_UART_ENABLE) && (status != SYSCTL_UART_DISABLE))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_UART, SYSCTL_E_PARAM_STATUS);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  switch(status)
+  {
+    case SYSCTL_UART_DISABLE:
+      SYSCTL_RCGCUART &= ~UART_Num;
+    break;
+    
+    case SYSCTL_UART_ENABLE:
+      SYSCTL_RCGCUART |= UART_Num;
+    break;
+  }
+  return ERR_STAT_OK;
+}
+
+/* API used to enable/disable CAN peripheral */
+errStat SYSCTL_controlCAN(u32 CAN_Num, u8 status)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((CAN_Num != SYSCTL_CAN_0) && (CAN_Num != SYSCTL_CAN_1))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_CAN, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+  if ((status != SYSCTL_CAN_ENABLE) && (status != SYSCTL_CAN_DISABLE))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_CAN, SYSCTL_E_PARAM_STATUS);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  switch(status)
+  {
+    case SYSCTL_CAN_DISABLE:
+      SYSCTL_RCGCCAN &= ~CAN_Num;
+    break;
+    
+    case SYSCTL_CAN_ENABLE:
+      SYSCTL_RCGCCAN |= CAN_Num;
+    break;
+  }
+  return ERR_STAT_OK;
+}
+
+/* API used to enable/disable general-purpose timer peripheral */
+errStat SYSCTL_controlTimer(u32 Timer_Num, u8 status)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (
+      (Timer_Num != SYSCTL_TIMER_0) && 
+      (Timer_Num != SYSCTL_TIMER_1) && 
+      (Timer_Num != SYSCTL_TIMER_2) && 
+      (Timer_Num != SYSCTL_TIMER_3) && 
+      (Timer_Num != SYSCTL_TIMER_4) && 
+      (Timer_Num != SYSCTL_TIMER_5)
+     )
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_TIMER, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+  if ((status != SYSCTL_TIMER_ENABLE) && (status != SYSCTL_TIMER_DISABLE))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_TIMER, SYSCTL_E_PARAM_STATUS);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  switch(status)
+  {
+    case SYSCTL_TIMER_DISABLE:
+      SYSCTL_RCGCTIMER &= ~Timer_Num;
+    break;
+    
+    case SYSCTL_TIMER_ENABLE:
+      SYSCTL_RCGCTIMER |= Timer_Num;
+    break;
+  }
+  return ERR_STAT_OK;
+}
+
+/* API used to enable/disable the micro DMA controller */
+errStat SYSCTL_controlDMA(u32 DMA_Num, u8 status)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (DMA_Num != SYSCTL_DMA_0)
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_DMA, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+  if ((status != SYSCTL_DMA_ENABLE) && (status != SYSCTL_DMA_DISABLE))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_DMA, SYSCTL_E_PARAM_STATUS);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  switch(status)
+  {
+    case SYSCTL_DMA_DISABLE:
+      SYSCTL_RCGCDMA &= ~DMA_Num;
+    break;
+    
+    case SYSCTL_DMA_ENABLE:
+      SYSCTL_RCGCDMA |= DMA_Num;
+    break;
+  }
+  return ERR_STAT_OK;
+}
+
+/* API used to enable/disable synchronous serial interface peripheral */
+errStat SYSCTL_controlSSI(u32 SSI_Num, u8 status)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (
+      (SSI_Num != SYSCTL_SSI_0) && 
+      (SSI_Num != SYSCTL_SSI_1) && 
+      (SSI_Num != SYSCTL_SSI_2) && 
+      (SSI_Num != SYSCTL_SSI_3)
+     )
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_SSI, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+  if ((status != SYSCTL_SSI_ENABLE) && (status != SYSCTL_SSI_DISABLE))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_SSI, SYSCTL_E_PARAM_STATUS);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  switch(status)
+  {
+    case SYSCTL_SSI_DISABLE:
+      SYSCTL_RCGCSSI &= ~SSI_Num;
+    break;
+    
+    case SYSCTL_SSI_ENABLE:
+      SYSCTL_RCGCSSI |= SSI_Num;
+    break;
+  }
+  return ERR_STAT_OK;
+}
+
+/* API used to enable/disable the EEPROM module */
+errStat SYSCTL_controlEEPROM(u32 EEPROM_Num, u8 status)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (EEPROM_Num != SYSCTL_EEPROM_0)
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_EEPROM, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+  if ((status != SYSCTL_EEPROM_ENABLE) && (status != SYSCTL_EEPROM_DISABLE))
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_CONTROL_EEPROM, SYSCTL_E_PARAM_STATUS);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  switch(status)
+  {
+    case SYSCTL_EEPROM_DISABLE:
+      SYSCTL_RCGCEEPROM &= ~EEPROM_Num;
+    break;
+    
+    case SYSCTL_EEPROM_ENABLE:
+      SYSCTL_RCGCEEPROM |= EEPROM_Num;
+    break;
+  }
+  return ERR_STAT_OK;
+}
+
+/* API used to put the EEPROM module through a reset, its clock must be enabled */
+errStat SYSCTL_resetEEPROM(u32 EEPROM_Num)
+{
+  volatile u32 delay;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (EEPROM_Num != SYSCTL_EEPROM_0)
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_RESET_EEPROM, SYSCTL_E_PARAM_PERIPH);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  SYSCTL_SREEPROM |= EEPROM_Num;
+  /* Hold the reset for a few cycles before releasing it */
+  for (delay = 0; delay < 16; delay++)
+  {
+  }
+  SYSCTL_SREEPROM &= ~EEPROM_Num;
+  return ERR_STAT_OK;
+}
+
+/* API used to read the causes of the resets since they were last cleared */
+errStat SYSCTL_getResetCause(u32* cause)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (cause == 0)
+  {
+    Det_ReportError(MODULE_ID_SYSCTL, SYSCTL_API_GET_RESET_CAUSE, SYSCTL_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+  
+  *cause = SYSCTL_RESC;
+  return ERR_STAT_OK;
+}
+
+/* API used to clear reset causes, so that the next reset reports only its own */
+void SYSCTL_clearResetCause(u32 cause)
+{
+  SYSCTL_RESC &= ~cause;
 }
@@ -27,7 +27,148 @@ API: void SYSCTL_controlGPIO(u32 GPIO_Num, u8 status)
 #define SYSCTL_GPIO_E 0x00000010
 #define SYSCTL_GPIO_F 0x00000020
 
+/* 
+Parameter: status
+API: void SYSCTL_controlUART(u32 UART_Num, u8 status)
+*/
+
+#define SYSCTL_UART_ENABLE 0
+#define SYSCTL_UART_DISABLE 1
+
+/* 
+Parameter: UART_Num
+API: void SYSCTL_controlUART(u32 UART_Num, u8 status) 
+*/
+#define SYSCTL_UART_0 0x00000001
+#define SYSCTL_UART_1 0x00000002
+#define SYSCTL_UART_2 0x00000004
+#define SYSCTL_UART_3 0x00000008
+#define SYSCTL_UART_4 0x00000010
+#define SYSCTL_UART_5 0x00000020
+#define SYSCTL_UART_6 0x00000040
+#define SYSCTL_UART_7 0x00000080
+
+/* 
+Parameter: status
+API: void SYSCTL_controlCAN(u32 CAN_Num, u8 status)
+*/
+
+#define SYSCTL_CAN_ENABLE 0
+#define SYSCTL_CAN_DISABLE 1
+
+/* 
+Parameter: CAN_Num
+API: void SYSCTL_controlCAN(u32 CAN_Num, u8 status) 
+*/
+#define SYSCTL_CAN_0 0x00000001
+#define SYSCTL_CAN_1 0x00000002
+
+/* 
+Parameter: status
+API: void SYSCTL_controlTimer(u32 Timer_Num, u8 status)
+*/
+
+#define SYSCTL_TIMER_ENABLE 0
+#define SYSCTL_TIMER_DISABLE 1
+
+/* 
+Parameter: Timer_Num
+API: void SYSCTL_controlTimer(u32 Timer_Num, u8 status) 
+*/
+#define SYSCTL_TIMER_0 0x00000001
+#define SYSCTL_TIMER_1 0x00000002
+#define SYSCTL_TIMER_2 0x00000004
+#define SYSCTL_TIMER_3 0x00000008
+#define SYSCTL_TIMER_4 0x00000010
+#define SYSCTL_TIMER_5 0x00000020
+
+/* 
+Parameter: status
+API: void SYSCTL_controlDMA(u32 DMA_Num, u8 status)
+*/
+
+#define SYSCTL_DMA_ENABLE 0
+#define SYSCTL_DMA_DISABLE 1
+
+/* 
+Parameter: DMA_Num
+API: void SYSCTL_controlDMA(u32 DMA_Num, u8 status) 
+*/
+#define SYSCTL_DMA_0 0x00000001
+
+/* 
+Parameter: status
+API: void SYSCTL_controlSSI(u32 SSI_Num, u8 status)
+*/
+
+#define SYSCTL_SSI_ENABLE 0
+#define SYSCTL_SSI_DISABLE 1
+
+/* 
+Parameter: SSI_Num
+API: void SYSCTL_controlSSI(u32 SSI_Num, u8 status) 
+*/
+#define SYSCTL_SSI_0 0x00000001
+#define SYSCTL_SSI_1 0x00000002
+#define SYSCTL_SSI_2 0x00000004
+#define SYSCTL_SSI_3 0x00000008
+
+/* 
+Parameter: status
+API: void SYSCTL_controlEEPROM(u32 EEPROM_Num, u8 status)
+*/
+
+#define SYSCTL_EEPROM_ENABLE 0
+#define SYSCTL_EEPROM_DISABLE 1
+
+/* 
+Parameter: EEPROM_Num
+API: void SYSCTL_controlEEPROM(u32 EEPROM_Num, u8 status) 
+API: errStat SYSCTL_resetEEPROM(u32 EEPROM_Num)
+*/
+#define SYSCTL_EEPROM_0 0x00000001
+
+/* 
+Return value of SYSCTL_getResetCause, argument of SYSCTL_clearResetCause
+*/
+#define SYSCTL_CAUSE_EXT      0x00000001  /* External (RST pin) reset     */
+#define SYSCTL_CAUSE_POR      0x00000002  /* Power-on reset               */
+#define SYSCTL_CAUSE_BOR      0x00000004  /* Brown-out reset              */
+#define SYSCTL_CAUSE_WDOG0    0x00000008  /* Watchdog 0 reset             */
+#define SYSCTL_CAUSE_SW       0x00000010  /* Software reset               */
+#define SYSCTL_CAUSE_WDOG1    0x00000020  /* Watchdog 1 reset             */
+#define SYSCTL_CAUSE_MOSCFAIL 0x00010000  /* Main oscillator failure      */
+
+/* Frequency of the main oscillator selected by SYSCTL_setSystemClock */
+#define SYSCTL_MAIN_OSCILLATOR_HZ 16000000
+
+/* API and error ids reported to the Development Error Tracer */
+#define SYSCTL_API_SET_SYSTEM_CLOCK 0x00
+#define SYSCTL_API_CONTROL_GPIO     0x01
+#define SYSCTL_API_CONTROL_UART     0x02
+#define SYSCTL_API_CONTROL_CAN      0x03
+#define SYSCTL_API_CONTROL_TIMER    0x04
+#define SYSCTL_API_CONTROL_DMA      0x05
+#define SYSCTL_API_CONTROL_SSI      0x06
+#define SYSCTL_API_CONTROL_EEPROM   0x07
+#define SYSCTL_API_GET_RESET_CAUSE  0x08
+#define SYSCTL_API_RESET_EEPROM     0x09
+
+#define SYSCTL_E_PARAM_CLOCK        0x0A
+#define SYSCTL_E_PARAM_PERIPH       0x0B
+#define SYSCTL_E_PARAM_STATUS       0x0C
+#define SYSCTL_E_PARAM_POINTER      0x0D
+
 errStat SYSCTL_setSystemClock (u32 Clock);
 errStat SYSCTL_controlGPIO(u32 GPIO_Num, u8 status);
+errStat SYSCTL_controlUART(u32 UART_Num, u8 status);
+errStat SYSCTL_controlCAN(u32 CAN_Num, u8 status);
+errStat SYSCTL_controlTimer(u32 Timer_Num, u8 status);
+errStat SYSCTL_controlDMA(u32 DMA_Num, u8 status);
+errStat SYSCTL_controlSSI(u32 SSI_Num, u8 status);
+errStat SYSCTL_controlEEPROM(u32 EEPROM_Num, u8 status);
+errStat SYSCTL_resetEEPROM(u32 EEPROM_Num);
+errStat SYSCTL_getResetCause(u32* cause);
+void SYSCTL_clearResetCause(u32 cause);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "STD_TYPES.h"
+#include "uart.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+/* Number of UART instances served by this driver */
+#define UART_NUM                2
+
+/* Event handlers registered by upper layers, indexed by UART and event */
+static ECU_STATE void (*UART_handlers[UART_NUM][UART_EVENT_NUM])(void);
+
+/******************************************************************************
+    \param ui32Base is the base address of the UART port.                      
+                                                                               
+    This function shall determine the driver index of a UART base address.     
+                                                                               
+    \return Returns the index, or UART_NUM if the base address is not valid.   
+                                                                               
+/******************************************************************************/
+static u8
+_UARTIndex(u32 ui32Base)
+{
+    return((ui32Base == UART0_BASE) ? 0 :
+           (ui32Base == UART1_BASE) ? 1 : UART_NUM);
+}
+
+/******************************************************************************
+
+    Configures a UART for 8-N-1 framing with FIFOs enabled.
+
+    \param ui32Base is the base address of the UART port.
+    \param ui32UARTClk is the rate of the clock supplied to the UART module.
+    \param ui32Baud is the desired baud rate.
+
+    The UART clock must be enabled through SYSCTL_controlUART and its pins
+    handed over through GPIO_AltFunctionSet before calling this function.
+    All UART interrupts are left masked.
+
+/******************************************************************************/
+errStat UART_Init(u32 ui32Base, u32 ui32UARTClk, u32 ui32Baud)
+{
+    u32 ui32Div;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    /*
+      Check the arguments, the divisor has to fit the 16 bit IBRD register.
+    */
+    if (_UARTIndex(ui32Base) >= UART_NUM)
+    {
+      Det_ReportError(MODULE_ID_UART, UART_API_INIT, UART_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if ((ui32Baud == 0) || (ui32UARTClk < (16 * ui32Baud)) ||
+        ((ui32UARTClk / (16 * ui32Baud)) > 0xFFFF))
+    {
+      Det_ReportError(MODULE_ID_UART, UART_API_INIT, UART_E_PARAM_BAUD);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    /*
+      Disable the UART while it is being configured.
+    */
+    HWREG(ui32Base + UART_O_CTL) &= ~(UART_CTL_UARTEN);
+
+    /*
+      Baud divisor in 1/64 units, rounded to nearest:
+      BRD = UARTClk / (16 * Baud), FBRD = fraction(BRD) * 64.
+    */
+    ui32Div = (((ui32UARTClk * 8) / ui32Baud) + 1) / 2;
+    HWREG(ui32Base + UART_O_IBRD) = ui32Div / 64;
+    HWREG(ui32Base + UART_O_FBRD) = ui32Div % 64;
+
+    /*
+      8 data bits, no parity, one stop bit, FIFOs on. Writing LCRH latches
+      the divisor registers.
+    */
+    HWREG(ui32Base + UART_O_LCRH) = UART_LCRH_WLEN_8 | UART_LCRH_FEN;
+    HWREG(ui32Base + UART_O_CC) = UART_CC_CS_SYSCLK;
+    HWREG(ui32Base + UART_O_IFLS) = UART_IFLS_TX1_8 | UART_IFLS_RX4_8;
+    HWREG(ui32Base + UART_O_IM) = 0;
+    HWREG(ui32Base + UART_O_ICR) = 0xFFFFFFFF;
+
+    HWREG(ui32Base + UART_O_CTL) = UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Writes one byte to the transmit FIFO if it has room.
+
+    \param ui32Base is the base address of the UART port.
+    \param ui8Data is the byte to send.
+
+    \return ERR_STAT_NOK if the FIFO is full, the byte is then not sent.
+
+/******************************************************************************/
+errStat UART_CharPutNonBlocking(u32 ui32Base, u8 ui8Data)
+{
+    if (!(HWREG(ui32Base + UART_O_FR) & UART_FR_TXFF))
+    {
+      HWREG(ui32Base + UART_O_DR) = ui8Data;
+      return ERR_STAT_OK;
+    }
+    return ERR_STAT_NOK;
+}
+
+/******************************************************************************
+
+    Reads one byte from the receive FIFO if it is not empty.
+
+    \param ui32Base is the base address of the UART port.
+    \param ui8Data receives the byte read.
+
+    \return ERR_STAT_NOK if the FIFO is empty.
+
+/******************************************************************************/
+errStat UART_CharGetNonBlocking(u32 ui32Base, u8* ui8Data)
+{
+    if (!(HWREG(ui32Base + UART_O_FR) & UART_FR_RXFE))
+    {
+      *ui8Data = (u8)HWREG(ui32Base + UART_O_DR);
+      return ERR_STAT_OK;
+    }
+    return ERR_STAT_NOK;
+}
+
+/******************************************************************************
+
+    Unmasks the specified UART interrupt sources.
+
+    \param ui32Base is the base address of the UART port.
+    \param ui32IntFlags is a bit mask of UART_INT_xxx values.
+
+/******************************************************************************/
+errStat UART_IntEnable(u32 ui32Base, u32 ui32IntFlags)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_UARTIndex(ui32Base) >= UART_NUM)
+    {
+      Det_ReportError(MODULE_ID_UART, UART_API_INT_ENABLE, UART_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Base + UART_O_IM) |= ui32IntFlags;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Masks the specified UART interrupt sources.
+
+    \param ui32Base is the base address of the UART port.
+    \param ui32IntFlags is a bit mask of UART_INT_xxx values.
+
+/******************************************************************************/
+errStat UART_IntDisable(u32 ui32Base, u32 ui32IntFlags)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (_UARTIndex(ui32Base) >= UART_NUM)
+    {
+      Det_ReportError(MODULE_ID_UART, UART_API_INT_DISABLE, UART_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(ui32Base + UART_O_IM) &= ~(ui32IntFlags);
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Registers the function called from the UART interrupt for an event.
+
+    \param ui32Base is the base address of the UART port.
+    \param ui8Event is UART_EVENT_TX or UART_EVENT_RX.
+    \param pfnHandler is the function to call, or 0 to unregister.
+
+    Handlers run in interrupt context and must not block.
+
+/******************************************************************************/
+errStat UART_IntRegister(u32 ui32Base, u8 ui8Event, void (*pfnHandler)(void))
+{
+    u8 ui8Index = _UARTIndex(ui32Base);
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Index >= UART_NUM)
+    {
+      Det_ReportError(MODULE_ID_UART, UART_API_INT_REGISTER, UART_E_PARAM_BASE);
+      return ERR_STAT_NOK;
+    }
+    if (ui8Event >= UART_EVENT_NUM)
+    {
+      Det_ReportError(MODULE_ID_UART, UART_API_INT_REGISTER, UART_E_PARAM_EVENT);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    UART_handlers[ui8Index][ui8Event] = pfnHandler;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Common interrupt body: acknowledges the pending sources and dispatches
+    them to the registered event handlers.
+
+/******************************************************************************/
+static void
+_UARTIntHandler(u32 ui32Base, u8 ui8Index)
+{
+    u32 ui32Status = HWREG(ui32Base + UART_O_MIS);
+
+    HWREG(ui32Base + UART_O_ICR) = ui32Status;
+
+    if ((ui32Status & (UART_INT_RX | UART_INT_RT | UART_INT_OE)) &&
+        (UART_handlers[ui8Index][UART_EVENT_RX] != 0))
+    {
+      UART_handlers[ui8Index][UART_EVENT_RX]();
+    }
+    if ((ui32Status & UART_INT_TX) && (UART_handlers[ui8Index][UART_EVENT_TX] != 0))
+    {
+      UART_handlers[ui8Index][UART_EVENT_TX]();
+    }
+}
+
+void UART0_Handler(void)
+{
+    _UARTIntHandler(UART0_BASE, 0);
+}
+
+void UART1_Handler(void)
+{
+    _UARTIntHandler(UART1_BASE, 1);
+}
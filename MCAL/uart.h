@@ -0,0 +1,116 @@
+#ifndef UART_H
+#define UART_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the UART register offsets.
+
+/*******************************************************************************/
+#define UART_O_DR               0x00000000  /* UART Data                       */
+#define UART_O_RSR              0x00000004  /* UART Receive Status/Error Clear */
+#define UART_O_FR               0x00000018  /* UART Flag                       */
+#define UART_O_IBRD             0x00000024  /* UART Integer Baud-Rate Divisor  */
+#define UART_O_FBRD             0x00000028  /* UART Fractional Baud-Rate       */
+                                            /* Divisor                         */
+#define UART_O_LCRH             0x0000002C  /* UART Line Control               */
+#define UART_O_CTL              0x00000030  /* UART Control                    */
+#define UART_O_IFLS             0x00000034  /* UART Interrupt FIFO Level Select*/
+#define UART_O_IM               0x00000038  /* UART Interrupt Mask             */
+#define UART_O_RIS              0x0000003C  /* UART Raw Interrupt Status       */
+#define UART_O_MIS              0x00000040  /* UART Masked Interrupt Status    */
+#define UART_O_ICR              0x00000044  /* UART Interrupt Clear            */
+#define UART_O_CC               0x00000FC8  /* UART Clock Configuration        */
+
+/******************************************************************************
+  
+  The following are defines for the bit fields in the UART registers.
+  
+******************************************************************************/
+#define UART_FR_BUSY            0x00000008  /* UART Busy                       */
+#define UART_FR_RXFE            0x00000010  /* UART Receive FIFO Empty         */
+#define UART_FR_TXFF            0x00000020  /* UART Transmit FIFO Full         */
+#define UART_FR_RXFF            0x00000040  /* UART Receive FIFO Full          */
+#define UART_FR_TXFE            0x00000080  /* UART Transmit FIFO Empty        */
+
+#define UART_LCRH_FEN           0x00000010  /* UART Enable FIFOs               */
+#define UART_LCRH_WLEN_8        0x00000060  /* 8 data bits                     */
+
+#define UART_CTL_UARTEN         0x00000001  /* UART Enable                     */
+#define UART_CTL_TXE            0x00000100  /* UART Transmit Enable            */
+#define UART_CTL_RXE            0x00000200  /* UART Receive Enable             */
+
+#define UART_IFLS_TX1_8         0x00000000  /* TX FIFO <= 1/8 full             */
+#define UART_IFLS_RX4_8         0x00000010  /* RX FIFO >= 1/2 full             */
+
+#define UART_CC_CS_SYSCLK       0x00000000  /* Baud clock is the system clock  */
+
+/******************************************************************************
+ 
+ Values that can be passed to UART_IntEnable, UART_IntDisable and
+ UART_IntClear as the ui32IntFlags parameter.
+ 
+/*******************************************************************************/
+#define UART_INT_RX             0x00000010  /* Receive FIFO level              */
+#define UART_INT_TX             0x00000020  /* Transmit FIFO level             */
+#define UART_INT_RT             0x00000040  /* Receive time-out                */
+#define UART_INT_OE             0x00000400  /* Overrun error                   */
+
+/******************************************************************************
+ 
+ Values that can be passed to UART_IntRegister as the ui8Event parameter.
+ 
+/*******************************************************************************/
+#define UART_EVENT_TX           0           /* TX FIFO has room                */
+#define UART_EVENT_RX           1           /* RX FIFO level or time-out       */
+#define UART_EVENT_NUM          2
+
+/*****************************************************************************
+ The following values define the bit field for the ui32Base argument to
+ several of the APIs.
+*****************************************************************************/
+#define UART0_BASE              0x4000C000  /* UART0                           */
+#define UART1_BASE              0x4000D000  /* UART1                           */
+
+/* Depth of the hardware transmit and receive FIFOs */
+#define UART_FIFO_DEPTH         16
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define UART_API_INIT           0x00
+#define UART_API_INT_ENABLE     0x01
+#define UART_API_INT_DISABLE    0x02
+#define UART_API_INT_REGISTER   0x03
+
+#define UART_E_PARAM_BASE       0x0A  /* Invalid UART base address         */
+#define UART_E_PARAM_BAUD       0x0B  /* Baud rate out of divisor range    */
+#define UART_E_PARAM_EVENT      0x0C  /* Invalid event                     */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat UART_Init(u32 ui32Base, u32 ui32UARTClk, u32 ui32Baud);
+extern errStat UART_CharPutNonBlocking(u32 ui32Base, u8 ui8Data);
+extern errStat UART_CharGetNonBlocking(u32 ui32Base, u8* ui8Data);
+extern errStat UART_IntEnable(u32 ui32Base, u32 ui32IntFlags);
+extern errStat UART_IntDisable(u32 ui32Base, u32 ui32IntFlags);
+extern errStat UART_IntRegister(u32 ui32Base, u8 ui8Event, void (*pfnHandler)(void));
+
+/******************************************************************************
+ 
+ Interrupt service routines, to be placed in the vector table of the startup
+ file at the UART0 and UART1 entries.
+ 
+/*******************************************************************************/
+extern void UART0_Handler(void);
+extern void UART1_Handler(void);
+
+#endif
@@ -0,0 +1,283 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "udma.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+
+/* Control structure of a channel in the control table */
+typedef struct
+{
+    volatile u32 ui32SrcEnd;
+    volatile u32 ui32DstEnd;
+    volatile u32 ui32Control;
+    volatile u32 ui32Spare;
+} udmaControl_t;
+
+/*
+  Primary structures of the 32 channels followed by the alternate ones. The
+  controller requires the table on a 1024 byte boundary.
+*/
+static ECU_STATE udmaControl_t UDMA_controlTable[2 * UDMA_CHANNEL_NUM] __attribute__((aligned(1024)));
+
+/******************************************************************************
+
+    Enables the uDMA controller and hands it the control table. All channels
+    start disabled, unmasked, without burst and on their primary structure.
+
+    The controller clock is enabled here through SYSCTL_controlDMA.
+
+/******************************************************************************/
+errStat UDMA_Init(void)
+{
+    errStat status;
+    u8 ui8Index;
+
+    status = SYSCTL_controlDMA(SYSCTL_DMA_0, SYSCTL_DMA_ENABLE);
+    if (status != ERR_STAT_OK)
+    {
+      return status;
+    }
+
+    for (ui8Index = 0; ui8Index < (2 * UDMA_CHANNEL_NUM); ui8Index++)
+    {
+      UDMA_controlTable[ui8Index].ui32Control = UDMA_MODE_STOP;
+    }
+    HWREG(UDMA_BASE + UDMA_O_CFG) = UDMA_CFG_MASTEN;
+    HWREG(UDMA_BASE + UDMA_O_CTLBASE) = UDMA_ADDRESS(UDMA_controlTable);
+    HWREG(UDMA_BASE + UDMA_O_ENACLR) = 0xFFFFFFFF;
+    HWREG(UDMA_BASE + UDMA_O_ALTCLR) = 0xFFFFFFFF;
+    HWREG(UDMA_BASE + UDMA_O_USEBURSTCLR) = 0xFFFFFFFF;
+    HWREG(UDMA_BASE + UDMA_O_REQMASKCLR) = 0xFFFFFFFF;
+    HWREG(UDMA_BASE + UDMA_O_CHIS) = 0xFFFFFFFF;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Selects the peripheral that drives the request of a channel.
+
+    \param ui8Channel is the channel number, 0 to 31.
+    \param ui8Encoding is the peripheral encoding of the channel (0 to 4),
+    see the channel assignment table of the data sheet.
+
+/******************************************************************************/
+errStat UDMA_ChannelAssign(u8 ui8Channel, u8 ui8Encoding)
+{
+    u32 ui32MapReg;
+    u32 ui32Shift;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if ((ui8Channel >= UDMA_CHANNEL_NUM) || (ui8Encoding > 4))
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_CHANNEL_ASSIGN, UDMA_E_PARAM_CHANNEL);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    /* Eight channels per map register, four bits each */
+    ui32MapReg = UDMA_BASE + UDMA_O_CHMAP0 + ((ui8Channel / 8) * 4);
+    ui32Shift = (ui8Channel % 8) * 4;
+    HWREG(ui32MapReg) = (HWREG(ui32MapReg) & ~(0xFUL << ui32Shift)) | ((u32)ui8Encoding << ui32Shift);
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Sets up one control structure of a channel for a transfer.
+
+    \param ui8ChannelStruct is the channel number ORed with UDMA_PRI_SELECT
+    or UDMA_ALT_SELECT.
+    \param ui32Control is the data size, increment and arbitration size,
+    a combination of the UDMA_CHCTL_ values.
+    \param ui32Mode is the transfer mode, one of the UDMA_MODE_ values.
+    \param pvSrc is the address of the first item to read.
+    \param pvDst is the address of the first item to write.
+    \param ui16Count is the number of items, 1 to UDMA_TRANSFER_MAX.
+
+    The controller works with end addresses, they are derived here from the
+    increments. The channel is not enabled by this function.
+
+/******************************************************************************/
+errStat UDMA_TransferSet(u8 ui8ChannelStruct, u32 ui32Control, u32 ui32Mode,
+                         volatile void* pvSrc, volatile void* pvDst, u16 ui16Count)
+{
+    udmaControl_t *psControl;
+    u32 ui32Inc;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if ((ui8ChannelStruct & ~UDMA_ALT_SELECT) >= UDMA_CHANNEL_NUM)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_TRANSFER_SET, UDMA_E_PARAM_CHANNEL);
+      return ERR_STAT_NOK;
+    }
+    if ((pvSrc == 0) || (pvDst == 0))
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_TRANSFER_SET, UDMA_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+    if ((ui16Count == 0) || (ui16Count > UDMA_TRANSFER_MAX))
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_TRANSFER_SET, UDMA_E_PARAM_SIZE);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    psControl = &UDMA_controlTable[(ui8ChannelStruct & ~UDMA_ALT_SELECT) +
+                                   ((ui8ChannelStruct & UDMA_ALT_SELECT) ? UDMA_CHANNEL_NUM : 0)];
+
+    /* The end address points at the last item, fixed addresses stay as they are */
+    ui32Inc = ui32Control & UDMA_CHCTL_SRCINC_NONE;
+    psControl->ui32SrcEnd = UDMA_ADDRESS(pvSrc) +
+      ((ui32Inc == UDMA_CHCTL_SRCINC_NONE) ? 0 : ((u32)(ui16Count - 1) << (ui32Inc >> 26)));
+    ui32Inc = ui32Control & UDMA_CHCTL_DSTINC_NONE;
+    psControl->ui32DstEnd = UDMA_ADDRESS(pvDst) +
+      ((ui32Inc == UDMA_CHCTL_DSTINC_NONE) ? 0 : ((u32)(ui16Count - 1) << (ui32Inc >> 30)));
+
+    psControl->ui32Control = (ui32Control & ~(UDMA_CHCTL_XFERSIZE_M | UDMA_CHCTL_XFERMODE_M)) |
+                             ((u32)(ui16Count - 1) << UDMA_CHCTL_XFERSIZE_S) |
+                             (ui32Mode & UDMA_CHCTL_XFERMODE_M);
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Enables a channel, it transfers on the requests of its peripheral.
+
+    \param ui8ChannelStruct is the channel number ORed with UDMA_PRI_SELECT
+    or UDMA_ALT_SELECT, the structure the transfer starts with.
+
+/******************************************************************************/
+errStat UDMA_ChannelEnable(u8 ui8ChannelStruct)
+{
+    u8 ui8Channel = ui8ChannelStruct & ~UDMA_ALT_SELECT;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Channel >= UDMA_CHANNEL_NUM)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_CHANNEL_ENABLE, UDMA_E_PARAM_CHANNEL);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    if (ui8ChannelStruct & UDMA_ALT_SELECT)
+    {
+      HWREG(UDMA_BASE + UDMA_O_ALTSET) = 1UL << ui8Channel;
+    }
+    else
+    {
+      HWREG(UDMA_BASE + UDMA_O_ALTCLR) = 1UL << ui8Channel;
+    }
+    HWREG(UDMA_BASE + UDMA_O_ENASET) = 1UL << ui8Channel;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Disables a channel.
+
+    \param ui8Channel is the channel number, 0 to 31.
+
+/******************************************************************************/
+errStat UDMA_ChannelDisable(u8 ui8Channel)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Channel >= UDMA_CHANNEL_NUM)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_CHANNEL_DISABLE, UDMA_E_PARAM_CHANNEL);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    HWREG(UDMA_BASE + UDMA_O_ENACLR) = 1UL << ui8Channel;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Tells whether a channel is enabled. The controller disables a channel
+    by itself when it reaches a structure in stop mode.
+
+    \param ui8Channel is the channel number, 0 to 31.
+    \param pui8Enabled receives 1 when enabled, 0 otherwise.
+
+/******************************************************************************/
+errStat UDMA_ChannelIsEnabled(u8 ui8Channel, u8* pui8Enabled)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Channel >= UDMA_CHANNEL_NUM)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_CHANNEL_IS_ENABLED, UDMA_E_PARAM_CHANNEL);
+      return ERR_STAT_NOK;
+    }
+    if (pui8Enabled == 0)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_CHANNEL_IS_ENABLED, UDMA_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    *pui8Enabled = (HWREG(UDMA_BASE + UDMA_O_ENASET) & (1UL << ui8Channel)) ? 1 : 0;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Reads the transfer mode of a control structure, the controller sets it to
+    UDMA_MODE_STOP when the structure completed.
+
+    \param ui8ChannelStruct is the channel number ORed with UDMA_PRI_SELECT
+    or UDMA_ALT_SELECT.
+    \param pui32Mode receives the mode.
+
+/******************************************************************************/
+errStat UDMA_ModeGet(u8 ui8ChannelStruct, u32* pui32Mode)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if ((ui8ChannelStruct & ~UDMA_ALT_SELECT) >= UDMA_CHANNEL_NUM)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_MODE_GET, UDMA_E_PARAM_CHANNEL);
+      return ERR_STAT_NOK;
+    }
+    if (pui32Mode == 0)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_MODE_GET, UDMA_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    *pui32Mode = UDMA_controlTable[(ui8ChannelStruct & ~UDMA_ALT_SELECT) +
+                                   ((ui8ChannelStruct & UDMA_ALT_SELECT) ? UDMA_CHANNEL_NUM : 0)].ui32Control &
+                 UDMA_CHCTL_XFERMODE_M;
+    return ERR_STAT_OK;
+}
+
+/******************************************************************************
+
+    Reads and clears the completion status of a channel. Completions of
+    peripheral channels arrive on the interrupt vector of the peripheral.
+
+    \param ui8Channel is the channel number, 0 to 31.
+    \param pui8Done receives 1 when a structure of the channel completed
+    since the last call, 0 otherwise.
+
+/******************************************************************************/
+errStat UDMA_IntStatusClear(u8 ui8Channel, u8* pui8Done)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+    if (ui8Channel >= UDMA_CHANNEL_NUM)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_INT_STATUS, UDMA_E_PARAM_CHANNEL);
+      return ERR_STAT_NOK;
+    }
+    if (pui8Done == 0)
+    {
+      Det_ReportError(MODULE_ID_UDMA, UDMA_API_INT_STATUS, UDMA_E_PARAM_POINTER);
+      return ERR_STAT_NOK;
+    }
+#endif
+
+    *pui8Done = (HWREG(UDMA_BASE + UDMA_O_CHIS) & (1UL << ui8Channel)) ? 1 : 0;
+    HWREG(UDMA_BASE + UDMA_O_CHIS) = 1UL << ui8Channel;
+    return ERR_STAT_OK;
+}
@@ -0,0 +1,118 @@
+#ifndef UDMA_H
+#define UDMA_H
+
+
+#include "HW_TYPES.h"
+
+
+/******************************************************************************
+
+ The following are defines for the Micro Direct Memory Access register
+ addresses.
+
+/*******************************************************************************/
+#define UDMA_BASE               0x400FF000  /* uDMA                            */
+
+#define UDMA_O_STAT             0x00000000  /* DMA Status                      */
+#define UDMA_O_CFG              0x00000004  /* DMA Configuration               */
+#define UDMA_O_CTLBASE          0x00000008  /* DMA Channel Control Base Pointer*/
+#define UDMA_O_ALTBASE          0x0000000C  /* DMA Alternate Control Base Ptr  */
+#define UDMA_O_USEBURSTSET      0x00000018  /* DMA Channel Useburst Set        */
+#define UDMA_O_USEBURSTCLR      0x0000001C  /* DMA Channel Useburst Clear      */
+#define UDMA_O_REQMASKSET       0x00000020  /* DMA Channel Request Mask Set    */
+#define UDMA_O_REQMASKCLR       0x00000024  /* DMA Channel Request Mask Clear  */
+#define UDMA_O_ENASET           0x00000028  /* DMA Channel Enable Set          */
+#define UDMA_O_ENACLR           0x0000002C  /* DMA Channel Enable Clear        */
+#define UDMA_O_ALTSET           0x00000030  /* DMA Channel Primary Alt Set     */
+#define UDMA_O_ALTCLR           0x00000034  /* DMA Channel Primary Alt Clear   */
+#define UDMA_O_PRIOSET          0x00000038  /* DMA Channel Priority Set        */
+#define UDMA_O_PRIOCLR          0x0000003C  /* DMA Channel Priority Clear      */
+#define UDMA_O_ERRCLR           0x0000004C  /* DMA Bus Error Clear             */
+#define UDMA_O_CHASGN           0x00000500  /* DMA Channel Assignment          */
+#define UDMA_O_CHIS             0x00000504  /* DMA Channel Interrupt Status    */
+#define UDMA_O_CHMAP0           0x00000510  /* DMA Channel Map Select 0        */
+
+/******************************************************************************
+
+  The following are defines for the bit fields in the uDMA registers and in
+  the channel control word of the control table.
+
+******************************************************************************/
+#define UDMA_CFG_MASTEN         0x00000001  /* Controller Master Enable        */
+
+#define UDMA_CHCTL_DSTINC_8     0x00000000  /* Destination increment, byte     */
+#define UDMA_CHCTL_DSTINC_16    0x40000000  /* Destination increment, half word*/
+#define UDMA_CHCTL_DSTINC_32    0x80000000  /* Destination increment, word     */
+#define UDMA_CHCTL_DSTINC_NONE  0xC0000000  /* Destination address fixed       */
+#define UDMA_CHCTL_DSTSIZE_8    0x00000000  /* Destination data size, byte     */
+#define UDMA_CHCTL_DSTSIZE_16   0x10000000  /* Destination data size, half word*/
+#define UDMA_CHCTL_DSTSIZE_32   0x20000000  /* Destination data size, word     */
+#define UDMA_CHCTL_SRCINC_8     0x00000000  /* Source increment, byte          */
+#define UDMA_CHCTL_SRCINC_16    0x04000000  /* Source increment, half word     */
+#define UDMA_CHCTL_SRCINC_32    0x08000000  /* Source increment, word          */
+#define UDMA_CHCTL_SRCINC_NONE  0x0C000000  /* Source address fixed            */
+#define UDMA_CHCTL_SRCSIZE_8    0x00000000  /* Source data size, byte          */
+#define UDMA_CHCTL_SRCSIZE_16   0x01000000  /* Source data size, half word     */
+#define UDMA_CHCTL_SRCSIZE_32   0x02000000  /* Source data size, word          */
+#define UDMA_CHCTL_ARBSIZE_1    0x00000000  /* Arbitrate after 1 transfer      */
+#define UDMA_CHCTL_ARBSIZE_M    0x0003C000  /* Arbitration size field          */
+#define UDMA_CHCTL_XFERSIZE_S   4           /* Transfer size field shift       */
+#define UDMA_CHCTL_XFERSIZE_M   0x00003FF0  /* Transfer size field, minus one  */
+#define UDMA_CHCTL_XFERMODE_M   0x00000007  /* Transfer mode field             */
+
+/* Values of the transfer mode field */
+#define UDMA_MODE_STOP          0x00000000
+#define UDMA_MODE_BASIC         0x00000001
+#define UDMA_MODE_AUTO          0x00000002
+#define UDMA_MODE_PINGPONG      0x00000003
+
+/*****************************************************************************
+ The following values define the arguments of several of the APIs.
+*****************************************************************************/
+#define UDMA_CHANNEL_NUM        32          /* Channels of the controller      */
+#define UDMA_TRANSFER_MAX       1024        /* Items of one control structure  */
+
+#define UDMA_PRI_SELECT         0x00        /* Primary control structure       */
+#define UDMA_ALT_SELECT         0x20        /* Alternate control structure     */
+
+/* Channels and their peripheral encodings (CHMAPn) used in this project */
+#define UDMA_CH20_TIMER1A       20
+#define UDMA_CH20_TIMER1A_ENC   0
+
+/* Address of a buffer as written to the control table */
+#define UDMA_ADDRESS(p)         ((u32)(unsigned long)(p))
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define UDMA_API_INIT               0x00
+#define UDMA_API_CHANNEL_ASSIGN     0x01
+#define UDMA_API_TRANSFER_SET       0x02
+#define UDMA_API_CHANNEL_ENABLE     0x03
+#define UDMA_API_CHANNEL_DISABLE    0x04
+#define UDMA_API_CHANNEL_IS_ENABLED 0x05
+#define UDMA_API_MODE_GET           0x06
+#define UDMA_API_INT_STATUS         0x07
+
+#define UDMA_E_PARAM_CHANNEL    0x0A  /* Channel or structure out of range */
+#define UDMA_E_PARAM_POINTER    0x0B  /* Null pointer                      */
+#define UDMA_E_PARAM_SIZE       0x0C  /* Transfer size 0 or too large      */
+
+/******************************************************************************/
+/*
+/* Prototypes for the APIs.
+/*
+/******************************************************************************/
+extern errStat UDMA_Init(void);
+extern errStat UDMA_ChannelAssign(u8 ui8Channel, u8 ui8Encoding);
+extern errStat UDMA_TransferSet(u8 ui8ChannelStruct, u32 ui32Control, u32 ui32Mode,
+                                volatile void* pvSrc, volatile void* pvDst, u16 ui16Count);
+extern errStat UDMA_ChannelEnable(u8 ui8ChannelStruct);
+extern errStat UDMA_ChannelDisable(u8 ui8Channel);
+extern errStat UDMA_ChannelIsEnabled(u8 ui8Channel, u8* pui8Enabled);
+extern errStat UDMA_ModeGet(u8 ui8ChannelStruct, u32* pui32Mode);
+extern errStat UDMA_IntStatusClear(u8 ui8Channel, u8* pui8Done);
+
+#endif
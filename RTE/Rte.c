@@ -0,0 +1,32 @@
+#include "STD_TYPES.h"
+
+/* Initial values of the ports */
+#include "leftDoor.h"
+#include "doorDimmer.h"
+
+#include "Rte.h"
+
+
+/* Published values */
+#define RTE_DEFINE_PORT(name, type, init)                       \
+  ECU_STATE Rte_Type_##name Rte_Port_##name = init;
+
+/* Implicit buffers, one per component and port */
+#define RTE_DEFINE_BUFFER(swc, port)                            \
+  ECU_STATE Rte_Type_##port Rte_Buffer_##swc##_##port;
+
+#define RTE_DEFINE_BUFFERS(swc, reads, writes)                  \
+  reads(RTE_DEFINE_BUFFER, swc)                                 \
+  writes(RTE_DEFINE_BUFFER, swc)
+
+#define RTE_INIT_PORT(name, type, init)                         \
+  Rte_Port_##name = init;
+
+RTE_PORT_TABLE(RTE_DEFINE_PORT)
+RTE_RUNNABLE_TABLE(RTE_DEFINE_BUFFERS)
+
+
+void Rte_Init(void)
+{
+  RTE_PORT_TABLE(RTE_INIT_PORT)
+}
@@ -0,0 +1,88 @@
+#ifndef RTE_H
+#define RTE_H
+
+/*
+  Runtime environment of the APP software components. Components exchange
+  data only through the sender-receiver ports of Rte_config.h, never by
+  calling each other, so a value read from the hardware once by its sender
+  reaches any number of receivers without another access. Only the
+  components at the edges call the basic software: the door components
+  read their doors, the cabin button takes the gestures of its switch, the
+  dimmer lamp drives the lamp and the usage report passes port changes to
+  the telemetry stream and the event log. The door logic in between only
+  reads and writes ports.
+
+  Communication is implicit. Rte_Run_<component> copies every port the
+  runnable reads (and the last published value of every port it writes)
+  into buffers of that runnable, runs it, then publishes the ports it
+  wrote. Inside the runnable
+      Rte_IRead_<component>_<port>()        returns the copy taken at start
+      Rte_IWrite_<component>_<port>(value)  sets the value published at end
+  so a runnable sees the same inputs from its first to its last statement
+  and its receivers never see a half-updated set of outputs. The accessors
+  are inline buffer accesses; only ports listed for a component in
+  Rte_config.h have accessors for it.
+
+  Everything below is generated from the tables of Rte_config.h.
+*/
+
+#include "Rte_config.h"
+
+
+/* Port types, storage of the published values */
+#define RTE_DECLARE_PORT(name, type, init)                      \
+  typedef type Rte_Type_##name;                                 \
+  extern ECU_STATE Rte_Type_##name Rte_Port_##name;
+
+/* Implicit buffers and accessors of one component */
+#define RTE_DECLARE_READ(swc, port)                             \
+  extern ECU_STATE Rte_Type_##port Rte_Buffer_##swc##_##port;   \
+  static inline Rte_Type_##port Rte_IRead_##swc##_##port(void)  \
+  {                                                             \
+    return Rte_Buffer_##swc##_##port;                           \
+  }
+
+#define RTE_DECLARE_WRITE(swc, port)                            \
+  extern ECU_STATE Rte_Type_##port Rte_Buffer_##swc##_##port;   \
+  static inline void Rte_IWrite_##swc##_##port(Rte_Type_##port value) \
+  {                                                             \
+    Rte_Buffer_##swc##_##port = value;                          \
+  }
+
+#define RTE_DECLARE_RUNNABLE(swc, reads, writes)                \
+  extern void swc##_MainFunction(void);                         \
+  reads(RTE_DECLARE_READ, swc)                                  \
+  writes(RTE_DECLARE_WRITE, swc)
+
+/* Runnable wrappers: copy in, run, publish */
+#define RTE_COPY_IN(swc, port)                                  \
+  Rte_Buffer_##swc##_##port = Rte_Port_##port;
+
+#define RTE_COPY_OUT(swc, port)                                 \
+  Rte_Port_##port = Rte_Buffer_##swc##_##port;
+
+#define RTE_DEFINE_RUN(swc, reads, writes)                      \
+  static inline void Rte_Run_##swc(void)                        \
+  {                                                             \
+    reads(RTE_COPY_IN, swc)                                     \
+    writes(RTE_COPY_IN, swc)                                    \
+    swc##_MainFunction();                                       \
+    writes(RTE_COPY_OUT, swc)                                   \
+  }
+
+RTE_PORT_TABLE(RTE_DECLARE_PORT)
+RTE_RUNNABLE_TABLE(RTE_DECLARE_RUNNABLE)
+RTE_RUNNABLE_TABLE(RTE_DEFINE_RUN)
+
+
+/*
+  Description: This function shall set every port to its initial value
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Rte_Init(void);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef RTE_CONFIG_H
+#define RTE_CONFIG_H
+
+/*
+  Port description of the software components. Rte.h generates the port
+  storage, the implicit buffers, the accessors and the runnable wrappers
+  from these tables; adding a port or a component only takes a line here.
+
+  Sender-receiver ports, one data element each:
+      PORT(name, type, initial value)
+*/
+#define RTE_PORT_TABLE(PORT)                                    \
+  PORT(LeftDoorStatus,     u8,  DOOR_CLOSED)                    \
+  PORT(RightDoorStatus,    u8,  DOOR_CLOSED)                    \
+  PORT(CabinLampForced,    u8,  0)                              \
+  PORT(DoorTriggerEnabled, u8,  1)                              \
+  PORT(LampRequest,        u8,  LAMP_OFF)
+
+/*
+  Ports read and written by each component's runnable:
+      PORT(component, port)
+*/
+#define RTE_LEFTDOOR_READS(PORT, SWC)
+#define RTE_LEFTDOOR_WRITES(PORT, SWC)    PORT(SWC, LeftDoorStatus)
+
+#define RTE_RIGHTDOOR_READS(PORT, SWC)
+#define RTE_RIGHTDOOR_WRITES(PORT, SWC)   PORT(SWC, RightDoorStatus)
+
+#define RTE_CABINBUTTON_READS(PORT, SWC)
+#define RTE_CABINBUTTON_WRITES(PORT, SWC) PORT(SWC, CabinLampForced) PORT(SWC, DoorTriggerEnabled)
+
+#define RTE_DOORDIMMER_READS(PORT, SWC)   PORT(SWC, LeftDoorStatus) PORT(SWC, RightDoorStatus) \
+                                          PORT(SWC, CabinLampForced) PORT(SWC, DoorTriggerEnabled)
+#define RTE_DOORDIMMER_WRITES(PORT, SWC)  PORT(SWC, LampRequest)
+
+#define RTE_DIMMERLAMP_READS(PORT, SWC)   PORT(SWC, LampRequest)
+#define RTE_DIMMERLAMP_WRITES(PORT, SWC)
+
+#define RTE_USAGEREPORT_READS(PORT, SWC)  PORT(SWC, LeftDoorStatus) PORT(SWC, RightDoorStatus) \
+                                          PORT(SWC, LampRequest)
+#define RTE_USAGEREPORT_WRITES(PORT, SWC)
+
+/*
+  Components, each with one runnable <component>_MainFunction:
+      RUNNABLE(component, reads, writes)
+*/
+#define RTE_RUNNABLE_TABLE(RUNNABLE)                                        \
+  RUNNABLE(LeftDoor,    RTE_LEFTDOOR_READS,    RTE_LEFTDOOR_WRITES)         \
+  RUNNABLE(RightDoor,   RTE_RIGHTDOOR_READS,   RTE_RIGHTDOOR_WRITES)        \
+  RUNNABLE(CabinButton, RTE_CABINBUTTON_READS, RTE_CABINBUTTON_WRITES)      \
+  RUNNABLE(DoorDimmer,  RTE_DOORDIMMER_READS,  RTE_DOORDIMMER_WRITES)       \
+  RUNNABLE(DimmerLamp,  RTE_DIMMERLAMP_READS,  RTE_DIMMERLAMP_WRITES)       \
+  RUNNABLE(UsageReport, RTE_USAGEREPORT_READS, RTE_USAGEREPORT_WRITES)
+
+#endif
@@ -0,0 +1,357 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "udma.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+
+#include "Capture.h"
+#include "Capture_config.h"
+
+
+/* Source of every sample, the DATA window of the captured pins */
+#define CAPTURE_SOURCE   ((volatile void*)(unsigned long)(CAPTURE_PORT + GPIO_O_DATA + (CAPTURE_PINS << 2)))
+
+/* Byte source, byte destination walking the half, one sample per request */
+#define CAPTURE_CONTROL  (UDMA_CHCTL_SRCSIZE_8 | UDMA_CHCTL_SRCINC_NONE | \
+                          UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_DSTINC_8 | UDMA_CHCTL_ARBSIZE_1)
+
+/*
+  Halves written by the uDMA. A half is armed (owned by the uDMA), full
+  (completed, waiting for or owned by the consumer) or neither while the
+  consumer releases it. Full halves are consumed alternately like the uDMA
+  fills them.
+*/
+static ECU_STATE u8 captureBuffer[2][CAPTURE_BUFFER_SAMPLES] __attribute__((aligned(4)));
+static ECU_STATE volatile u8 captureArmed[2];
+static ECU_STATE volatile u8 captureFull[2];
+static ECU_STATE volatile u8 captureGapBefore[2];
+static ECU_STATE volatile u8 captureStalled;
+static ECU_STATE u8 captureReadHalf;
+static ECU_STATE u8 captureRunning;
+static ECU_STATE u16 captureGaps;
+
+/* Bounce analysis, sample indexes count from the first analysed sample */
+static ECU_STATE u8 capturePinMask[CAPTURE_PIN_NUM];
+static ECU_STATE u8 capturePrevious;
+static ECU_STATE u8 captureHavePrevious;
+static ECU_STATE u32 captureSampleIndex;
+static ECU_STATE u8 captureInBurst;
+static ECU_STATE u32 captureBurstStart[CAPTURE_PIN_NUM];
+static ECU_STATE u32 captureLastEdge[CAPTURE_PIN_NUM];
+static ECU_STATE u16 captureBurstEdges[CAPTURE_PIN_NUM];
+static ECU_STATE captureBounce_t captureBounce[CAPTURE_PIN_NUM];
+
+
+/* Hands a half to the uDMA */
+static void Capture_Arm(u8 half)
+{
+  UDMA_TransferSet(CAPTURE_UDMA_CHANNEL | (half ? UDMA_ALT_SELECT : UDMA_PRI_SELECT), CAPTURE_CONTROL,
+                   UDMA_MODE_PINGPONG, CAPTURE_SOURCE, captureBuffer[half], CAPTURE_BUFFER_SAMPLES);
+  captureArmed[half] = 1;
+}
+
+/*
+  Timer vector, entered on uDMA completions of the capture channel. The
+  completed structure is back in stop mode.
+*/
+static void Capture_Notification(void)
+{
+  u8 done;
+  u8 enabled;
+  u8 half;
+  u32 mode;
+
+  UDMA_IntStatusClear(CAPTURE_UDMA_CHANNEL, &done);
+  if (!done)
+  {
+    return;
+  }
+  for (half = 0; half < 2; half++)
+  {
+    UDMA_ModeGet(CAPTURE_UDMA_CHANNEL | (half ? UDMA_ALT_SELECT : UDMA_PRI_SELECT), &mode);
+    if (captureArmed[half] && (mode == UDMA_MODE_STOP))
+    {
+      captureArmed[half] = 0;
+      captureFull[half] = 1;
+    }
+  }
+
+  /* The next half was not released in time, the channel ran into it and stopped */
+  UDMA_ChannelIsEnabled(CAPTURE_UDMA_CHANNEL, &enabled);
+  if (captureRunning && !enabled)
+  {
+    captureStalled = 1;
+  }
+}
+
+errStat Capture_Init(void)
+{
+  u8 pin;
+  u8 i = 0;
+
+  NVIC_IntDisable(CAPTURE_GPT_INT);
+  captureRunning = 0;
+  captureStalled = 0;
+  captureReadHalf = 0;
+  captureGaps = 0;
+  captureArmed[0] = captureArmed[1] = 0;
+  captureFull[0] = captureFull[1] = 0;
+  captureGapBefore[0] = captureGapBefore[1] = 0;
+
+  captureHavePrevious = 0;
+  captureSampleIndex = 0;
+  captureInBurst = 0;
+  for (pin = 1; pin != 0; pin <<= 1)
+  {
+    if ((CAPTURE_PINS & pin) && (i < CAPTURE_PIN_NUM))
+    {
+      capturePinMask[i] = pin;
+      captureBounce[i].bursts = 0;
+      captureBounce[i].lastEdges = 0;
+      captureBounce[i].maxEdges = 0;
+      captureBounce[i].lastDuration = 0;
+      captureBounce[i].maxDuration = 0;
+      i++;
+    }
+  }
+
+  if (SYSCTL_controlTimer(CAPTURE_GPT_SYSCTL, SYSCTL_TIMER_ENABLE) != ERR_STAT_OK)
+  {
+    return ERR_STAT_NOK;
+  }
+  GPT_Stop(CAPTURE_GPT_BASE);
+  UDMA_ChannelDisable(CAPTURE_UDMA_CHANNEL);
+  if (UDMA_ChannelAssign(CAPTURE_UDMA_CHANNEL, CAPTURE_UDMA_ENCODING) != ERR_STAT_OK)
+  {
+    return ERR_STAT_NOK;
+  }
+
+  GPT_IntRegister(CAPTURE_GPT_BASE, Capture_Notification);
+  NVIC_IntPrioritySet(CAPTURE_GPT_INT, CAPTURE_GPT_PRIORITY);
+  NVIC_IntEnable(CAPTURE_GPT_INT);
+  return ERR_STAT_OK;
+}
+
+errStat Capture_Start(void)
+{
+  u32 priMask = NVIC_IntMasterDisable();
+
+  captureStalled = 0;
+  captureReadHalf = 0;
+  captureFull[0] = captureFull[1] = 0;
+  /* Whatever was captured before is not continuous with the new samples */
+  captureGapBefore[0] = captureHavePrevious;
+  captureGapBefore[1] = 0;
+  Capture_Arm(0);
+  Capture_Arm(1);
+  UDMA_ChannelEnable(CAPTURE_UDMA_CHANNEL | UDMA_PRI_SELECT);
+  captureRunning = 1;
+  NVIC_IntMasterRestore(priMask);
+
+  return GPT_PeriodicInit(CAPTURE_GPT_BASE, CAPTURE_PERIOD_CYCLES);
+}
+
+void Capture_Stop(void)
+{
+  u32 priMask = NVIC_IntMasterDisable();
+
+  GPT_Stop(CAPTURE_GPT_BASE);
+  UDMA_ChannelDisable(CAPTURE_UDMA_CHANNEL);
+  captureRunning = 0;
+  captureArmed[0] = captureArmed[1] = 0;
+  NVIC_IntMasterRestore(priMask);
+}
+
+errStat Capture_GetBuffer(const u8** samples, u16* count, u8* gap)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((samples == 0) || (count == 0) || (gap == 0))
+  {
+    Det_ReportError(MODULE_ID_CAPTURE, CAPTURE_API_GET_BUFFER, CAPTURE_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  if (!captureFull[captureReadHalf])
+  {
+    return ERR_STAT_NOK;
+  }
+  *samples = captureBuffer[captureReadHalf];
+  *count = CAPTURE_BUFFER_SAMPLES;
+  *gap = captureGapBefore[captureReadHalf];
+  return ERR_STAT_OK;
+}
+
+void Capture_ReleaseBuffer(void)
+{
+  u8 half = captureReadHalf;
+  u32 priMask;
+
+  if (!captureFull[half])
+  {
+    return;
+  }
+
+  priMask = NVIC_IntMasterDisable();
+  captureFull[half] = 0;
+  captureGapBefore[half] = 0;
+  captureReadHalf = half ^ 1;
+  if (captureRunning)
+  {
+    Capture_Arm(half);
+    if (captureStalled)
+    {
+      /* Samples were lost while both halves were full, restart on this one */
+      captureStalled = 0;
+      captureGapBefore[half] = 1;
+      captureGaps++;
+      ErrCnt_Report(MODULE_ID_CAPTURE);
+      UDMA_ChannelEnable(CAPTURE_UDMA_CHANNEL | (half ? UDMA_ALT_SELECT : UDMA_PRI_SELECT));
+    }
+  }
+  NVIC_IntMasterRestore(priMask);
+}
+
+/* Closes the bursts of the pins that stayed stable long enough */
+static void Capture_Settle(void)
+{
+  captureBounce_t * bounce;
+  u32 duration;
+  u8 i;
+
+  for (i = 0; i < CAPTURE_PIN_NUM; i++)
+  {
+    if ((captureInBurst & capturePinMask[i]) &&
+        ((u32)(captureSampleIndex - captureLastEdge[i]) >= CAPTURE_SETTLE_SAMPLES))
+    {
+      bounce = &captureBounce[i];
+      duration = captureLastEdge[i] - captureBurstStart[i];
+      bounce->bursts++;
+      bounce->lastEdges = captureBurstEdges[i];
+      bounce->lastDuration = duration;
+      if (captureBurstEdges[i] > bounce->maxEdges)
+      {
+        bounce->maxEdges = captureBurstEdges[i];
+      }
+      if (duration > bounce->maxDuration)
+      {
+        bounce->maxDuration = duration;
+      }
+      captureInBurst &= ~capturePinMask[i];
+    }
+  }
+}
+
+/* Edges of the pins in changed at a sample index */
+static void Capture_Edge(u8 changed, u32 index)
+{
+  u8 i;
+
+  for (i = 0; i < CAPTURE_PIN_NUM; i++)
+  {
+    if (changed & capturePinMask[i])
+    {
+      if (!(captureInBurst & capturePinMask[i]))
+      {
+        captureInBurst |= capturePinMask[i];
+        captureBurstStart[i] = index;
+        captureBurstEdges[i] = 0;
+      }
+      if (captureBurstEdges[i] != 0xFFFF)
+      {
+        captureBurstEdges[i]++;
+      }
+      captureLastEdge[i] = index;
+    }
+  }
+}
+
+/*
+  Finds the edges of a half. Pins are stable most of the time, so the
+  samples are compared four at a time against the last level and only
+  words holding a change are looked at byte by byte.
+*/
+static void Capture_Analyse(const u8* samples, u16 count)
+{
+  const u32 * words = (const u32 *)samples;
+  u32 same;
+  u16 w;
+  u8 j;
+
+  if (!captureHavePrevious)
+  {
+    capturePrevious = samples[0];
+    captureHavePrevious = 1;
+  }
+  same = capturePrevious * 0x01010101UL;
+
+  for (w = 0; w < (count / 4); w++)
+  {
+    if (words[w] == same)
+    {
+      continue;
+    }
+    for (j = 0; j < 4; j++)
+    {
+      if (samples[(4 * w) + j] != capturePrevious)
+      {
+        Capture_Edge(samples[(4 * w) + j] ^ capturePrevious, captureSampleIndex + (4 * w) + j);
+        capturePrevious = samples[(4 * w) + j];
+      }
+    }
+    same = capturePrevious * 0x01010101UL;
+  }
+  captureSampleIndex += count;
+  Capture_Settle();
+}
+
+void Capture_MainFunction(void)
+{
+  const u8 * samples;
+  u16 count;
+  u8 gap;
+
+  if (Capture_GetBuffer(&samples, &count, &gap) != ERR_STAT_OK)
+  {
+    return;
+  }
+  if (gap)
+  {
+    /* Bursts cut by the gap are not measured */
+    captureInBurst = 0;
+    captureHavePrevious = 0;
+  }
+  Capture_Analyse(samples, count);
+  Capture_ReleaseBuffer();
+}
+
+errStat Capture_GetBounce(u8 pinIndex, captureBounce_t* bounce)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (bounce == 0)
+  {
+    Det_ReportError(MODULE_ID_CAPTURE, CAPTURE_API_GET_BOUNCE, CAPTURE_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+  if (pinIndex >= CAPTURE_PIN_NUM)
+  {
+    Det_ReportError(MODULE_ID_CAPTURE, CAPTURE_API_GET_BOUNCE, CAPTURE_E_PARAM_PIN);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  *bounce = captureBounce[pinIndex];
+  return ERR_STAT_OK;
+}
+
+u16 Capture_GetGapCount(void)
+{
+  return captureGaps;
+}
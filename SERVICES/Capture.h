@@ -0,0 +1,132 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+/*
+  Logic analyser mode for the door switch pins. A timer times out every
+  CAPTURE_PERIOD_CYCLES and each time-out makes the uDMA copy the masked
+  DATA register of the switch port into a ping-pong buffer, one byte per
+  sample, without the CPU. The CPU only sees completed buffers: the timer
+  vector notes which half completed and re-arms the halves the consumer
+  released.
+
+  If the consumer keeps both halves for longer than one buffer period the
+  channel stops; it restarts when a half is released and the next buffer is
+  marked as following a gap.
+
+  Capture_MainFunction is such a consumer: it measures the contact bounce
+  of every captured pin (edges and duration of each burst of edges) and
+  keeps statistics for the diagnostics.
+*/
+
+/* Bounce statistics of one captured pin */
+typedef struct
+{
+  u16 bursts;          /* bursts of edges seen                      */
+  u16 lastEdges;       /* edges of the last burst                   */
+  u16 maxEdges;        /* most edges in one burst                   */
+  u32 lastDuration;    /* first to last edge of the last burst, in samples */
+  u32 maxDuration;     /* longest burst, in samples                 */
+} captureBounce_t;
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define CAPTURE_API_GET_BUFFER      0x00
+#define CAPTURE_API_GET_BOUNCE      0x01
+
+#define CAPTURE_E_PARAM_POINTER     0x0A  /* Null pointer                    */
+#define CAPTURE_E_PARAM_PIN         0x0B  /* Pin index out of range          */
+
+
+/*
+  Description: This function shall configure the timer, the uDMA channel and
+  the timer interrupt, the capture stays stopped
+
+  Input: void
+
+  Output: errStat
+
+ */
+extern errStat Capture_Init(void);
+
+/*
+  Description: This function shall start sampling into both halves
+
+  Input: void
+
+  Output: errStat
+
+ */
+extern errStat Capture_Start(void);
+
+/*
+  Description: This function shall stop sampling, completed halves stay readable
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Capture_Stop(void);
+
+/*
+  Description: This function shall return the oldest completed half, it stays
+  owned by the caller until Capture_ReleaseBuffer
+
+  Input:
+        1- samples receives the address of the samples
+        2- count receives the number of samples
+        3- gap receives 1 when samples were lost before this buffer
+
+  Output: errStat, ERR_STAT_NOK when no half is complete
+
+ */
+extern errStat Capture_GetBuffer(const u8** samples, u16* count, u8* gap);
+
+/*
+  Description: This function shall give the half returned by Capture_GetBuffer
+  back to the uDMA
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Capture_ReleaseBuffer(void);
+
+/*
+  Description: This function shall be called from the main loop, it analyses
+  at most one completed half and releases it
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Capture_MainFunction(void);
+
+/*
+  Description: This function shall return the bounce statistics of a pin
+
+  Input:
+        1- pinIndex index of the pin in CAPTURE_PINS, lowest pin first
+        2- bounce receives the statistics
+
+  Output: errStat
+
+ */
+extern errStat Capture_GetBounce(u8 pinIndex, captureBounce_t* bounce);
+
+/*
+  Description: This function shall return the number of gaps since Capture_Init
+
+  Input: void
+
+  Output: u16
+
+ */
+extern u16 Capture_GetGapCount(void);
+
+#endif
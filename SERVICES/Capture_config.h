@@ -0,0 +1,40 @@
+#ifndef CAPTURE_CONFIG_H
+#define CAPTURE_CONFIG_H
+
+/*
+  1 starts the capture at start up (switch characterisation builds), 0 leaves
+  the module unused.
+*/
+#define CAPTURE_MODE                0
+
+/* Timer 1A paces the samples, its uDMA channel copies them */
+#define CAPTURE_GPT_BASE            TIMER1_BASE
+#define CAPTURE_GPT_SYSCTL          SYSCTL_TIMER_1
+#define CAPTURE_GPT_INT             NVIC_INT_TIMER1A
+#define CAPTURE_GPT_PRIORITY        4
+#define CAPTURE_UDMA_CHANNEL        UDMA_CH20_TIMER1A
+#define CAPTURE_UDMA_ENCODING       UDMA_CH20_TIMER1A_ENC
+
+/* The door switches, both on the same port */
+#define CAPTURE_PORT                SWITCH_LEFTDOOR_PORT
+#define CAPTURE_PINS                (SWITCH_LEFTDOOR_PIN | SWITCH_RIGHTDOOR_PIN)
+#define CAPTURE_PIN_NUM             2
+
+/* One sample per microsecond */
+#define CAPTURE_PERIOD_CYCLES       (SYSCTL_MAIN_OSCILLATOR_HZ / 1000000)
+
+/* Samples of one half, at most UDMA_TRANSFER_MAX, a multiple of 4 */
+#define CAPTURE_BUFFER_SAMPLES      1024
+
+/* A burst of edges ends after this many samples without an edge (5 ms) */
+#define CAPTURE_SETTLE_SAMPLES      5000
+
+#if (CAPTURE_BUFFER_SAMPLES > UDMA_TRANSFER_MAX) || ((CAPTURE_BUFFER_SAMPLES % 4) != 0)
+#error "CAPTURE_BUFFER_SAMPLES must be a multiple of 4 up to UDMA_TRANSFER_MAX"
+#endif
+
+#if (SWITCH_LEFTDOOR_PORT != SWITCH_RIGHTDOOR_PORT)
+#error "Captured pins must be on one port"
+#endif
+
+#endif
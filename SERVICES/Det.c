@@ -0,0 +1,153 @@
+#include "STD_TYPES.h"
+#include "HW_TYPES.h"
+#include "nvic.h"
+#include "dwt.h"
+#include "MODULE_IDS.h"
+
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+
+#if (DET_DEV_ERROR_DETECT == 1)
+
+#define DET_RING_MASK        (DET_ERROR_RING_SIZE - 1)
+
+/* Debug Halting Control and Status, C_DEBUGEN is set while a debugger is attached */
+#define DET_DHCSR            0xE000EDF0
+#define DET_DHCSR_C_DEBUGEN  0x00000001
+
+static ECU_STATE detError_t detRing[DET_ERROR_RING_SIZE];
+static ECU_STATE u16 detCount;
+static ECU_STATE u8 detHead;
+
+
+/* 
+  Description: This function shall clear the recorded errors
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Det_Init(void)
+{
+  detCount = 0;
+  detHead = 0;
+}
+
+/* 
+  Description: This function shall record a development error and call the
+  configured error hook, it is safe to call from interrupts
+  
+  Input: 
+        1- moduleId the MODULE_ID_xxx of the reporting module
+        2- apiId the id of the API that detected the error
+        3- errorId the id of the error
+        
+  Output: void
+
+ */
+extern void Det_ReportError(u8 moduleId, u8 apiId, u8 errorId)
+{
+  detError_t * errorElement;
+  u32 priMask = NVIC_IntMasterDisable();
+  
+  errorElement = &detRing[detHead & DET_RING_MASK];
+  errorElement->timestamp = DWT_CycleCountGet();
+  errorElement->moduleId = moduleId;
+  errorElement->apiId = apiId;
+  errorElement->errorId = errorId;
+  detHead++;
+  if (detCount != 0xFFFF)
+  {
+    detCount++;
+  }
+  
+  NVIC_IntMasterRestore(priMask);
+  
+  /* Keep the per module counters read by diagnostics up to date */
+  ErrCnt_Report(moduleId);
+  
+  DET_ERROR_HOOK(moduleId, apiId, errorId);
+}
+
+/* 
+  Description: This function shall copy the most recent errors, newest first
+  
+  Input: 
+        1- errors receives the errors
+        2- maxCount the number of elements in errors
+        3- count receives the number of errors copied
+        
+  Output: errStat
+
+ */
+extern errStat Det_GetRecentErrors(detError_t* errors, u8 maxCount, u8* count)
+{
+  u8 available;
+  u8 i;
+  u32 priMask;
+  
+  if ((errors == 0) || (count == 0))
+  {
+    return ERR_STAT_NOK;
+  }
+  
+  priMask = NVIC_IntMasterDisable();
+  available = (detCount < DET_ERROR_RING_SIZE) ? (u8)detCount : DET_ERROR_RING_SIZE;
+  if (available > maxCount)
+  {
+    available = maxCount;
+  }
+  for (i = 0; i < available; i++)
+  {
+    errors[i] = detRing[(u8)(detHead - 1 - i) & DET_RING_MASK];
+  }
+  NVIC_IntMasterRestore(priMask);
+  
+  *count = available;
+  
+  return ERR_STAT_OK;
+}
+
+/* 
+  Description: This function shall return the number of errors reported since
+  Det_Init, saturated at 0xFFFF
+  
+  Input: void
+  
+  Output: error count
+
+ */
+extern u16 Det_GetErrorCount(void)
+{
+  return detCount;
+}
+
+/* 
+  Description: Default error hook, stops at a breakpoint when a debugger is
+  attached and returns otherwise
+  
+  Input: 
+        1- moduleId the MODULE_ID_xxx of the reporting module
+        2- apiId the id of the API that detected the error
+        3- errorId the id of the error
+        
+  Output: void
+
+ */
+extern void Det_BreakHook(u8 moduleId, u8 apiId, u8 errorId)
+{
+  (void)moduleId;
+  (void)apiId;
+  (void)errorId;
+#if defined(__arm__) || defined(__ICCARM__)
+  /* A breakpoint without a debugger would escalate to a HardFault */
+  if (HWREG(DET_DHCSR) & DET_DHCSR_C_DEBUGEN)
+  {
+    __asm("bkpt #0");
+  }
+#endif
+}
+
+#endif
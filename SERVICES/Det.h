@@ -0,0 +1,84 @@
+#ifndef DET_H
+#define DET_H
+
+/*
+  Development Error Tracer.
+
+  Every API checks its arguments inside #if (DET_DEV_ERROR_DETECT == 1)
+  blocks, reports violations here and returns ERR_STAT_NOK without touching
+  the hardware. With detection off the checks do not exist and the APIs
+  trust their callers.
+*/
+
+typedef struct 
+{
+  u32 timestamp;      /* DWT cycles at the time of the report */
+  u8 moduleId;        /* MODULE_ID_xxx */
+  u8 apiId;           /* <MODULE>_API_xxx of the failing API */
+  u8 errorId;         /* <MODULE>_E_xxx */
+} detError_t;
+
+
+/* 
+  Description: This function shall clear the recorded errors
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Det_Init(void);
+
+/* 
+  Description: This function shall record a development error and call the
+  configured error hook, it is safe to call from interrupts
+  
+  Input: 
+        1- moduleId the MODULE_ID_xxx of the reporting module
+        2- apiId the id of the API that detected the error
+        3- errorId the id of the error
+        
+  Output: void
+
+ */
+extern void Det_ReportError(u8 moduleId, u8 apiId, u8 errorId);
+
+/* 
+  Description: This function shall copy the most recent errors, newest first
+  
+  Input: 
+        1- errors receives the errors
+        2- maxCount the number of elements in errors
+        3- count receives the number of errors copied
+        
+  Output: errStat
+
+ */
+extern errStat Det_GetRecentErrors(detError_t* errors, u8 maxCount, u8* count);
+
+/* 
+  Description: This function shall return the number of errors reported since
+  Det_Init, saturated at 0xFFFF
+  
+  Input: void
+  
+  Output: error count
+
+ */
+extern u16 Det_GetErrorCount(void);
+
+/* 
+  Description: Default error hook, stops at a breakpoint when a debugger is
+  attached and returns otherwise
+  
+  Input: 
+        1- moduleId the MODULE_ID_xxx of the reporting module
+        2- apiId the id of the API that detected the error
+        3- errorId the id of the error
+        
+  Output: void
+
+ */
+extern void Det_BreakHook(u8 moduleId, u8 apiId, u8 errorId);
+
+#endif
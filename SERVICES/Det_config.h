@@ -0,0 +1,37 @@
+#ifndef DET_CONFIG_H
+#define DET_CONFIG_H
+
+/*
+  Development error detection switch, 1 to check the arguments of every API
+  and report violations to Det_ReportError, 0 to compile the checks out.
+  Release builds are made with RELEASE_BUILD defined, which turns detection
+  off unless it is forced on, and forcing it on is rejected.
+*/
+#ifndef DET_DEV_ERROR_DETECT
+#ifdef RELEASE_BUILD
+#define DET_DEV_ERROR_DETECT      0
+#else
+#define DET_DEV_ERROR_DETECT      1
+#endif
+#endif
+
+/* Number of most recent errors kept, must be a power of two */
+#define DET_ERROR_RING_SIZE       16
+
+/* Function called on every reported error, after it is recorded */
+#define DET_ERROR_HOOK            Det_BreakHook
+
+
+#if (DET_DEV_ERROR_DETECT != 0) && (DET_DEV_ERROR_DETECT != 1)
+#error "DET_DEV_ERROR_DETECT must be 0 or 1"
+#endif
+
+#if defined(RELEASE_BUILD) && (DET_DEV_ERROR_DETECT == 1)
+#error "Development error detection must be off in release builds"
+#endif
+
+#if (DET_ERROR_RING_SIZE & (DET_ERROR_RING_SIZE - 1)) != 0
+#error "DET_ERROR_RING_SIZE must be a power of two"
+#endif
+
+#endif
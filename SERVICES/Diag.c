@@ -0,0 +1,295 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "uart.h"
+#include "MODULE_IDS.h"
+
+#include "COBS.h"
+#include "CRC8.h"
+
+#include "ErrCnt.h"
+#include "Telemetry.h"
+#include "Telemetry_config.h"
+#include "Det_config.h"
+#include "Trace.h"
+#include "Diag.h"
+#include "Diag_config.h"
+
+
+#define DIAG_RING_MASK   (DIAG_RX_RING_SIZE - 1)
+
+/*
+  Single producer (UART RX interrupt) single consumer (Diag_MainFunction)
+  ring, same scheme as the telemetry transmit ring.
+*/
+static ECU_STATE volatile u8 rxRing[DIAG_RX_RING_SIZE];
+static ECU_STATE volatile u16 rxHead;
+static ECU_STATE volatile u16 rxTail;
+
+/* Encoded request being assembled */
+static ECU_STATE u8 reqBuffer[DIAG_REQUEST_MAX];
+static ECU_STATE u8 reqLen;
+static ECU_STATE u8 reqOverflow;
+
+
+/* 
+  Description: This function shall be called from the UART interrupt and moves the
+  received bytes from the FIFO into the ring
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void Diag_RxNotification(void)
+{
+  u8 data;
+  u16 head = rxHead;
+  
+  while (UART_CharGetNonBlocking(DIAG_UART_BASE, &data) == ERR_STAT_OK)
+  {
+    if ((u16)(head - rxTail) < DIAG_RX_RING_SIZE)
+    {
+      rxRing[head & DIAG_RING_MASK] = data;
+      head++;
+    }
+    else
+    {
+      ErrCnt_Report(MODULE_ID_DIAG);
+    }
+  }
+  rxHead = head;
+}
+
+/* 
+  Description: This function shall send a negative response
+  
+  Input: 
+        1- sid the service id of the request
+        2- nrc the negative response code
+  
+  Output: void
+
+ */
+static void Diag_SendNegative(u8 sid, u8 nrc)
+{
+  u8 response[3];
+  
+  response[0] = DIAG_NEGATIVE_RESPONSE;
+  response[1] = sid;
+  response[2] = nrc;
+  Telemetry_SendRecord(TELEMETRY_REC_DIAG_RESPONSE, response, 3);
+}
+
+/* 
+  Description: This function shall answer a ReadDataByIdentifier request
+  
+  Input: 
+        1- req the decoded request without its CRC
+        2- len the number of bytes in req
+  
+  Output: void
+
+ */
+static void Diag_ReadDataByIdentifier(const u8* req, u16 len)
+{
+  u8 response[TELEMETRY_PAYLOAD_MAX];
+  const diagDid_t * didElement;
+  u16 did;
+  u8 i;
+  
+  if (len != 3)
+  {
+    Diag_SendNegative(req[0], DIAG_NRC_INVALID_FORMAT);
+    return;
+  }
+  did = ((u16)req[1] << 8) | req[2];
+  
+  for (i = 0; i < DIAG_DID_NUM; i++)
+  {
+    didElement = getDiagDid(i);
+    if (didElement->did == did)
+    {
+      break;
+    }
+  }
+  if ((i == DIAG_DID_NUM) || (didElement->length > DIAG_DATA_MAX))
+  {
+    Diag_SendNegative(req[0], DIAG_NRC_REQUEST_OUT_OF_RANGE);
+    return;
+  }
+  
+  if (didElement->getData(&response[3]) != ERR_STAT_OK)
+  {
+    Diag_SendNegative(req[0], DIAG_NRC_CONDITIONS_NOT_CORRECT);
+    return;
+  }
+  response[0] = DIAG_SID_READ_DATA_BY_ID + DIAG_POSITIVE_OFFSET;
+  response[1] = req[1];
+  response[2] = req[2];
+  Telemetry_SendRecord(TELEMETRY_REC_DIAG_RESPONSE, response, 3 + didElement->length);
+}
+
+/* 
+  Description: This function shall answer a ReadMemoryByAddress request on the
+  input trace
+  
+  Input: 
+        1- req the decoded request without its CRC
+        2- len the number of bytes in req
+  
+  Output: void
+
+ */
+static void Diag_ReadMemoryByAddress(const u8* req, u16 len)
+{
+  u8 response[TELEMETRY_PAYLOAD_MAX];
+  traceInfo_t info;
+  u16 offset;
+  
+  if (len != 4)
+  {
+    Diag_SendNegative(req[0], DIAG_NRC_INVALID_FORMAT);
+    return;
+  }
+  offset = ((u16)req[1] << 8) | req[2];
+  
+  Trace_GetInfo(&info);
+  if (!info.frozen)
+  {
+    Diag_SendNegative(req[0], DIAG_NRC_CONDITIONS_NOT_CORRECT);
+    return;
+  }
+  if ((req[3] > DIAG_DATA_MAX) || (Trace_Read(offset, &response[3], req[3]) != ERR_STAT_OK))
+  {
+    Diag_SendNegative(req[0], DIAG_NRC_REQUEST_OUT_OF_RANGE);
+    return;
+  }
+  response[0] = DIAG_SID_READ_MEMORY_BY_ADDRESS + DIAG_POSITIVE_OFFSET;
+  response[1] = req[1];
+  response[2] = req[2];
+  Telemetry_SendRecord(TELEMETRY_REC_DIAG_RESPONSE, response, 3 + req[3]);
+}
+
+/* 
+  Description: This function shall validate a complete encoded request and
+  dispatch it to its service
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void Diag_ProcessRequest(void)
+{
+  u8 req[DIAG_REQUEST_MAX];
+  u8 response[1];
+  u16 len;
+  
+  if ((COBS_Decode(reqBuffer, reqLen, req, &len) != ERR_STAT_OK) || (len < 2) ||
+      (CRC8_Update(CRC8_INIT, req, len - 1) != req[len - 1]))
+  {
+    /* Corrupted requests are not answered, the tool times out and retries */
+    ErrCnt_Report(MODULE_ID_DIAG);
+    return;
+  }
+  len--;
+  
+  switch (req[0])
+  {
+    case DIAG_SID_READ_DATA_BY_ID:
+      Diag_ReadDataByIdentifier(req, len);
+    break;
+    
+    case DIAG_SID_READ_MEMORY_BY_ADDRESS:
+      Diag_ReadMemoryByAddress(req, len);
+    break;
+    
+    case DIAG_SID_CLEAR_DIAG_INFO:
+      ErrCnt_Clear();
+      Trace_Restart();
+      response[0] = DIAG_SID_CLEAR_DIAG_INFO + DIAG_POSITIVE_OFFSET;
+      Telemetry_SendRecord(TELEMETRY_REC_DIAG_RESPONSE, response, 1);
+    break;
+    
+    default:
+      Diag_SendNegative(req[0], DIAG_NRC_SERVICE_NOT_SUPPORTED);
+    break;
+  }
+}
+
+/* 
+  Description: This function shall start the reception of requests, the UART must
+  already be initiated by Telemetry_Init
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+extern errStat Diag_Init(void)
+{
+  errStat status = ERR_STAT_OK;
+  
+  rxHead = 0;
+  rxTail = 0;
+  reqLen = 0;
+  reqOverflow = 0;
+  
+  status |= UART_IntRegister(DIAG_UART_BASE,UART_EVENT_RX,Diag_RxNotification);
+  status |= UART_IntEnable(DIAG_UART_BASE,UART_INT_RX | UART_INT_RT | UART_INT_OE);
+  
+  return status;
+}
+
+/* 
+  Description: This function shall be called from the main loop after the door
+  handling. It consumes at most DIAG_BYTES_PER_CALL received bytes and answers
+  at most one request per call so its run time stays bounded.
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Diag_MainFunction(void)
+{
+  u16 tail = rxTail;
+  u8 budget = DIAG_BYTES_PER_CALL;
+  u8 data;
+  
+  while ((tail != rxHead) && budget--)
+  {
+    data = rxRing[tail & DIAG_RING_MASK];
+    tail++;
+    
+    if (data != COBS_DELIMITER)
+    {
+      if (reqLen < DIAG_REQUEST_MAX)
+      {
+        reqBuffer[reqLen++] = data;
+      }
+      else
+      {
+        reqOverflow = 1;
+      }
+      continue;
+    }
+    
+    /* End of frame */
+    if (reqOverflow)
+    {
+      ErrCnt_Report(MODULE_ID_DIAG);
+    }
+    else if (reqLen != 0)
+    {
+      Diag_ProcessRequest();
+    }
+    reqLen = 0;
+    reqOverflow = 0;
+    
+    /* One request per call, the rest waits for the next loop */
+    break;
+  }
+  rxTail = tail;
+}
@@ -0,0 +1,89 @@
+#ifndef DIAG_H
+#define DIAG_H
+
+/*
+  Request/response diagnostic service on the serial link.
+
+  A request is built as
+      service id (1) | parameters | CRC-8 over all previous bytes (1)
+  then COBS encoded and terminated by 0x00, like the telemetry records.
+  The response is sent as a TELEMETRY_REC_DIAG_RESPONSE record whose
+  payload is
+      service id + DIAG_POSITIVE_OFFSET | parameters | data
+  or, on failure,
+      DIAG_NEGATIVE_RESPONSE | service id | response code
+
+  Supported services:
+      DIAG_SID_READ_DATA_BY_ID    parameters: identifier (2, big endian)
+      DIAG_SID_CLEAR_DIAG_INFO    no parameters, clears the error counters
+                                  and restarts the input trace
+      DIAG_SID_READ_MEMORY_BY_ADDRESS
+                                  parameters: offset (2, big endian),
+                                  length (1, at most DIAG_DATA_MAX)
+                                  reads the frozen input trace (Trace.h),
+                                  the offset counts from its oldest byte
+
+  Reading DIAG_DID_TRACE_INFO freezes the input trace, so the length it
+  returns stays valid while the trace is read out.
+*/
+#define DIAG_SID_CLEAR_DIAG_INFO       0x14
+#define DIAG_SID_READ_DATA_BY_ID       0x22
+#define DIAG_SID_READ_MEMORY_BY_ADDRESS 0x23
+
+#define DIAG_POSITIVE_OFFSET           0x40
+#define DIAG_NEGATIVE_RESPONSE         0x7F
+
+/* Negative response codes */
+#define DIAG_NRC_SERVICE_NOT_SUPPORTED 0x11
+#define DIAG_NRC_INVALID_FORMAT        0x13
+#define DIAG_NRC_CONDITIONS_NOT_CORRECT 0x22
+#define DIAG_NRC_REQUEST_OUT_OF_RANGE  0x31
+
+/* Longest request accepted, encoded */
+#define DIAG_REQUEST_MAX               16
+
+/* Largest data record of an identifier */
+#define DIAG_DATA_MAX                  (TELEMETRY_PAYLOAD_MAX - 3)
+
+typedef struct 
+{
+  u16 did;
+  u8 length;
+  errStat (*getData)(u8* data);
+} diagDid_t;
+
+
+/* 
+  Description: This function shall start the reception of requests, the UART must
+  already be initiated by Telemetry_Init
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+extern errStat Diag_Init(void);
+
+/* 
+  Description: This function shall be called from the main loop after the door
+  handling. It consumes at most DIAG_BYTES_PER_CALL received bytes and answers
+  at most one request per call so its run time stays bounded.
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Diag_MainFunction(void);
+
+/* 
+  Description: This function shall return an element of the identifier table
+  
+  Input: didIndex which holds the index of the identifier in the table 
+  
+  Output: Address of the identifier struct
+ 
+ */
+extern const diagDid_t * getDiagDid (u8 didIndex);
+
+#endif
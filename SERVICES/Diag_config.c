@@ -0,0 +1,254 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "uart.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "udma.h"
+#include "can.h"
+#include "eeprom.h"
+#include "MODULE_IDS.h"
+
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+#include "Door.h"
+#include "Door_config.h"
+#include "Lamp.h"
+#include "Lamp_config.h"
+
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+#include "Perf.h"
+#include "Telemetry.h"
+#include "Telemetry_config.h"
+#include "Trace.h"
+#include "Capture.h"
+#include "Capture_config.h"
+#include "EventLog.h"
+#include "EventLog_config.h"
+#include "Diag.h"
+#include "Diag_config.h"
+
+/* Checked here, the capture configuration is not visible to Diag.c */
+#if ((2 + (14 * CAPTURE_PIN_NUM)) > DIAG_DATA_MAX)
+#error "DIAG_DID_BOUNCE_STATS does not fit a response, raise TELEMETRY_PAYLOAD_MAX"
+#endif
+
+#if ((8 + (2 * EVENTLOG_DOOR_NUM)) > DIAG_DATA_MAX)
+#error "DIAG_DID_EVENT_LOG does not fit a response, raise TELEMETRY_PAYLOAD_MAX"
+#endif
+
+
+/* 
+  Description: Data getters of the identifier table, each fills exactly the
+  length declared in diagDidTable
+  
+  Input: data the response buffer
+  
+  Output: errStat
+
+ */
+static errStat Diag_GetDoorStates(u8* data)
+{
+  u8 i;
+  
+  /* A lost remote door reads its timeout state, as the lamp logic sees it */
+  for (i = 0; i < DOOR_NUM; i++)
+  {
+    Door_GetStatus(i, &data[i]);
+  }
+  return ERR_STAT_OK;
+}
+
+static errStat Diag_GetLampStates(u8* data)
+{
+  errStat status = ERR_STAT_OK;
+  u8 i;
+  
+  for (i = 0; i < Lamps_NUM; i++)
+  {
+    status |= Lamp_GetState(i, &data[i]);
+  }
+  return status;
+}
+
+/* Module ids past MODULE_ID_NUM read 0 */
+static void Diag_PutErrorCounters(u8* data, u8 page)
+{
+  u16 count;
+  u8 i;
+  
+  for (i = 0; i < DIAG_ERRCNT_PAGE_SIZE; i++)
+  {
+    count = 0;
+    ErrCnt_Get((page * DIAG_ERRCNT_PAGE_SIZE) + i, &count);
+    data[2 * i] = (u8)(count);
+    data[(2 * i) + 1] = (u8)(count >> 8);
+  }
+}
+
+static errStat Diag_GetErrorCounters0(u8* data)
+{
+  Diag_PutErrorCounters(data, 0);
+  return ERR_STAT_OK;
+}
+
+static errStat Diag_GetErrorCounters1(u8* data)
+{
+  Diag_PutErrorCounters(data, 1);
+  return ERR_STAT_OK;
+}
+
+static errStat Diag_GetErrorCounters2(u8* data)
+{
+  Diag_PutErrorCounters(data, 2);
+  return ERR_STAT_OK;
+}
+
+static void Diag_PutU32(u8* data, u32 value)
+{
+  data[0] = (u8)(value);
+  data[1] = (u8)(value >> 8);
+  data[2] = (u8)(value >> 16);
+  data[3] = (u8)(value >> 24);
+}
+
+static errStat Diag_GetLoopStats(u8* data)
+{
+  perfStats_t stats;
+  
+  Perf_GetStats(&stats, PERF_KEEP_WINDOW);
+  Diag_PutU32(&data[0], stats.loops);
+  Diag_PutU32(&data[4], stats.minCycles);
+  Diag_PutU32(&data[8], stats.maxCycles);
+  Diag_PutU32(&data[12], stats.lifetimeMax);
+  return ERR_STAT_OK;
+}
+
+static errStat Diag_GetTelemetryDropped(u8* data)
+{
+  u16 dropped = Telemetry_GetDroppedCount();
+  
+  data[0] = (u8)(dropped);
+  data[1] = (u8)(dropped >> 8);
+  return ERR_STAT_OK;
+}
+
+/* Freezes the trace, it is read out with DIAG_SID_READ_MEMORY_BY_ADDRESS */
+static errStat Diag_GetTraceInfo(u8* data)
+{
+  traceInfo_t info;
+  
+  Trace_Freeze();
+  Trace_GetInfo(&info);
+  data[0] = (u8)(info.length);
+  data[1] = (u8)(info.length >> 8);
+  data[2] = (u8)(info.dropped);
+  data[3] = (u8)(info.dropped >> 8);
+  data[4] = info.pins;
+  return ERR_STAT_OK;
+}
+
+/* Gaps, then per captured pin bursts, last and max edges, last and max duration in samples */
+static errStat Diag_GetBounceStats(u8* data)
+{
+  captureBounce_t bounce;
+  u16 gaps = Capture_GetGapCount();
+  u8 * pin;
+  u8 i;
+  
+  data[0] = (u8)(gaps);
+  data[1] = (u8)(gaps >> 8);
+  for (i = 0; i < CAPTURE_PIN_NUM; i++)
+  {
+    pin = &data[2 + (14 * i)];
+    Capture_GetBounce(i, &bounce);
+    pin[0] = (u8)(bounce.bursts);
+    pin[1] = (u8)(bounce.bursts >> 8);
+    pin[2] = (u8)(bounce.lastEdges);
+    pin[3] = (u8)(bounce.lastEdges >> 8);
+    pin[4] = (u8)(bounce.maxEdges);
+    pin[5] = (u8)(bounce.maxEdges >> 8);
+    Diag_PutU32(&pin[6], bounce.lastDuration);
+    Diag_PutU32(&pin[10], bounce.maxDuration);
+  }
+  return ERR_STAT_OK;
+}
+
+/* Records, resets, lamp on seconds, then the openings per door, over the log */
+static errStat Diag_GetEventLog(u8* data)
+{
+  eventLogUsage_t usage;
+  u16 opens;
+  u8 i;
+  
+  EventLog_GetUsage(&usage);
+  data[0] = (u8)(usage.records);
+  data[1] = (u8)(usage.records >> 8);
+  data[2] = (u8)(usage.resets);
+  data[3] = (u8)(usage.resets >> 8);
+  Diag_PutU32(&data[4], usage.lampOnSeconds);
+  for (i = 0; i < EVENTLOG_DOOR_NUM; i++)
+  {
+    opens = EventLog_GetDoorOpens(i);
+    data[8 + (2 * i)] = (u8)(opens);
+    data[9 + (2 * i)] = (u8)(opens >> 8);
+  }
+  return ERR_STAT_OK;
+}
+
+#if (DET_DEV_ERROR_DETECT == 1)
+static errStat Diag_GetDetErrors(u8* data)
+{
+  detError_t errors[DIAG_DET_ERRORS_NUM];
+  u16 total = Det_GetErrorCount();
+  u8 count;
+  u8 i;
+  
+  Det_GetRecentErrors(errors, DIAG_DET_ERRORS_NUM, &count);
+  data[0] = (u8)(total);
+  data[1] = (u8)(total >> 8);
+  for (i = 0; i < DIAG_DET_ERRORS_NUM; i++)
+  {
+    data[2 + (3 * i)] = (i < count) ? errors[i].moduleId : 0xFF;
+    data[3 + (3 * i)] = (i < count) ? errors[i].apiId : 0xFF;
+    data[4 + (3 * i)] = (i < count) ? errors[i].errorId : 0xFF;
+  }
+  return ERR_STAT_OK;
+}
+#endif
+
+
+/*
+  Creating an array of identifier struct that holds the readable data
+*/
+const diagDid_t diagDidTable [DIAG_DID_NUM] = {
+  {DIAG_DID_DOOR_STATES,DOOR_NUM,Diag_GetDoorStates},
+  {DIAG_DID_LAMP_STATES,Lamps_NUM,Diag_GetLampStates},
+  {DIAG_DID_LOOP_STATS,16,Diag_GetLoopStats},
+  {DIAG_DID_TELEMETRY_DROPPED,2,Diag_GetTelemetryDropped},
+  {DIAG_DID_TRACE_INFO,5,Diag_GetTraceInfo},
+  {DIAG_DID_BOUNCE_STATS,(2 + (14 * CAPTURE_PIN_NUM)),Diag_GetBounceStats},
+  {DIAG_DID_EVENT_LOG,(8 + (2 * EVENTLOG_DOOR_NUM)),Diag_GetEventLog},
+  {DIAG_DID_ERROR_COUNTERS,(2 * DIAG_ERRCNT_PAGE_SIZE),Diag_GetErrorCounters0},
+  {(DIAG_DID_ERROR_COUNTERS + 1),(2 * DIAG_ERRCNT_PAGE_SIZE),Diag_GetErrorCounters1},
+  {(DIAG_DID_ERROR_COUNTERS + 2),(2 * DIAG_ERRCNT_PAGE_SIZE),Diag_GetErrorCounters2},
+#if (DET_DEV_ERROR_DETECT == 1)
+  {DIAG_DID_DET_ERRORS,(2 + (3 * DIAG_DET_ERRORS_NUM)),Diag_GetDetErrors}
+#endif
+};
+
+
+/* 
+  Description: This function shall return an element of the identifier table
+  
+  Input: didIndex which holds the index of the identifier in the table 
+  
+  Output: Address of the identifier struct
+ 
+ */
+extern const diagDid_t * getDiagDid (u8 didIndex)
+{
+  return &diagDidTable[didIndex];
+}
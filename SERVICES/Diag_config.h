@@ -0,0 +1,49 @@
+#ifndef DIAG_CONFIG_H
+#define DIAG_CONFIG_H
+
+/* Requests arrive on the telemetry UART, responses leave as telemetry records */
+#define DIAG_UART_BASE              TELEMETRY_UART_BASE
+
+/* Size of the receive ring in bytes, must be a power of two */
+#define DIAG_RX_RING_SIZE           64
+
+/* Received bytes consumed by one call of Diag_MainFunction */
+#define DIAG_BYTES_PER_CALL         8
+
+/* Identifier table, the DET errors are only readable in development builds */
+#if (DET_DEV_ERROR_DETECT == 1)
+#define DIAG_DID_NUM                11
+#else
+#define DIAG_DID_NUM                10
+#endif
+
+#define DIAG_DID_DOOR_STATES        0x0100
+#define DIAG_DID_LAMP_STATES        0x0101
+#define DIAG_DID_LOOP_STATS         0x0103
+#define DIAG_DID_TELEMETRY_DROPPED  0x0104
+#define DIAG_DID_DET_ERRORS         0x0105
+#define DIAG_DID_TRACE_INFO         0x0106
+#define DIAG_DID_BOUNCE_STATS       0x0107
+#define DIAG_DID_EVENT_LOG          0x0108
+
+/* Error counters, one identifier per page of DIAG_ERRCNT_PAGE_SIZE module ids */
+#define DIAG_DID_ERROR_COUNTERS     0x0110
+#define DIAG_ERRCNT_PAGE_SIZE       8
+#define DIAG_ERRCNT_PAGE_NUM        3
+
+/* Most recent DET errors returned by DIAG_DID_DET_ERRORS */
+#define DIAG_DET_ERRORS_NUM         5
+
+#if ((2 * DIAG_ERRCNT_PAGE_SIZE) > DIAG_DATA_MAX)
+#error "An error counter page does not fit a response, lower DIAG_ERRCNT_PAGE_SIZE"
+#endif
+
+#if (MODULE_ID_NUM > (DIAG_ERRCNT_PAGE_SIZE * DIAG_ERRCNT_PAGE_NUM))
+#error "Not every module id has an error counter page, add one to diagDidTable"
+#endif
+
+#if (DIAG_RX_RING_SIZE & (DIAG_RX_RING_SIZE - 1)) != 0
+#error "DIAG_RX_RING_SIZE must be a power of two"
+#endif
+
+#endif
@@ -0,0 +1,73 @@
+#include "STD_TYPES.h"
+#include "MODULE_IDS.h"
+#include "nvic.h"
+#include "ErrCnt.h"
+
+
+static ECU_STATE u16 errCount[MODULE_ID_NUM];
+
+
+/* 
+  Description: This function shall count one error of a module, it is safe to
+  call from interrupts
+  
+  Input: moduleId the MODULE_ID_xxx of the reporting module
+  
+  Output: void
+
+ */
+extern void ErrCnt_Report(u8 moduleId)
+{
+  u32 priMask;
+  
+  if (moduleId < MODULE_ID_NUM)
+  {
+    priMask = NVIC_IntMasterDisable();
+    if (errCount[moduleId] != 0xFFFF)
+    {
+      errCount[moduleId]++;
+    }
+    NVIC_IntMasterRestore(priMask);
+  }
+}
+
+/* 
+  Description: This function shall return the error count of a module
+  
+  Input: 
+        1- moduleId the MODULE_ID_xxx of the module
+        2- count receives the error count
+        
+  Output: errStat
+
+ */
+extern errStat ErrCnt_Get(u8 moduleId, u16* count)
+{
+  if ((moduleId >= MODULE_ID_NUM) || (count == 0))
+  {
+    return ERR_STAT_NOK;
+  }
+  *count = errCount[moduleId];
+  
+  return ERR_STAT_OK;
+}
+
+/* 
+  Description: This function shall clear the error counters of all modules
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void ErrCnt_Clear(void)
+{
+  u8 i;
+  u32 priMask = NVIC_IntMasterDisable();
+  
+  for (i = 0; i < MODULE_ID_NUM; i++)
+  {
+    errCount[i] = 0;
+  }
+  NVIC_IntMasterRestore(priMask);
+}
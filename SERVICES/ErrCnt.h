@@ -0,0 +1,44 @@
+#ifndef ERRCNT_H
+#define ERRCNT_H
+
+/*
+  Per module counters of the ERR_STAT_NOK paths taken, so that rejected
+  calls are visible through diagnostics instead of being silently dropped.
+  Counters saturate at 0xFFFF.
+*/
+
+
+/* 
+  Description: This function shall count one error of a module, it is safe to
+  call from interrupts
+  
+  Input: moduleId the MODULE_ID_xxx of the reporting module
+  
+  Output: void
+
+ */
+extern void ErrCnt_Report(u8 moduleId);
+
+/* 
+  Description: This function shall return the error count of a module
+  
+  Input: 
+        1- moduleId the MODULE_ID_xxx of the module
+        2- count receives the error count
+        
+  Output: errStat
+
+ */
+extern errStat ErrCnt_Get(u8 moduleId, u16* count);
+
+/* 
+  Description: This function shall clear the error counters of all modules
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void ErrCnt_Clear(void);
+
+#endif
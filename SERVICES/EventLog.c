@@ -0,0 +1,467 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "eeprom.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+#include "TimerWheel.h"
+#include "EventLog.h"
+#include "EventLog_config.h"
+
+/* Write in progress */
+#define EVENTLOG_WRITE_NONE       0
+#define EVENTLOG_WRITE_HEADER     1
+#define EVENTLOG_WRITE_RECORD     2
+
+/* Byte address of a word of a log block */
+#define EVENTLOG_ADDRESS(block, word) \
+  ((((EVENTLOG_FIRST_BLOCK + (block)) * EEPROM_BLOCK_WORDS) + (word)) * 4)
+
+/* Records waiting for the EEPROM, type and data without the tag */
+static ECU_STATE u32 eventLogQueue[EVENTLOG_QUEUE_SIZE];
+static ECU_STATE u8 eventLogHead;
+static ECU_STATE u8 eventLogTail;
+static ECU_STATE u32 eventLogLastPut;
+static ECU_STATE u8 eventLogFlushing;
+
+/* End of the log: current block, its sequence and its next free word */
+static ECU_STATE u8 eventLogReady;
+static ECU_STATE u8 eventLogBlock;
+static ECU_STATE u32 eventLogSeq;
+static ECU_STATE u8 eventLogIndex;
+static ECU_STATE u8 eventLogHeaderPending;
+static ECU_STATE u8 eventLogWrite;
+
+/* Totals of the records in the log */
+static ECU_STATE eventLogUsage_t eventLogUsage;
+static ECU_STATE u16 eventLogDoorOpens[EVENTLOG_DOOR_NUM];
+
+static ECU_STATE u8 eventLogLampOn[EVENTLOG_LAMP_NUM];
+static ECU_STATE u32 eventLogLampSince[EVENTLOG_LAMP_NUM];
+
+static ECU_STATE u32 eventLogErrCntTicks;
+static ECU_STATE u16 eventLogErrCnt[MODULE_ID_NUM];
+
+
+/*
+  Description: This function shall add a record to the totals or take it out
+  again when its block is reused
+
+  Input:
+        1- word the record
+        2- add 1 to add the record, 0 to take it out
+
+  Output: void
+
+ */
+static void EventLog_Account(u32 word, u8 add)
+{
+  u16 step = add ? 1 : 0xFFFF;
+  u32 data = EVENTLOG_DATA(word);
+  u8 door;
+
+  eventLogUsage.records += step;
+  switch (EVENTLOG_TYPE(word))
+  {
+    case EVENTLOG_REC_DOOR_OPENED:
+      door = (u8)(data >> 16);
+      if (door < EVENTLOG_DOOR_NUM)
+      {
+        eventLogDoorOpens[door] += step;
+      }
+    break;
+
+    case EVENTLOG_REC_LAMP_ON_TIME:
+      eventLogUsage.lampOnSeconds += add ? (data & 0xFFFF) : (0 - (data & 0xFFFF));
+    break;
+
+    case EVENTLOG_REC_RESET:
+      eventLogUsage.resets += step;
+    break;
+  }
+}
+
+/*
+  Description: This function shall queue a record and count it, the record is
+  dropped and counted as an error when the queue is full
+
+  Input:
+        1- type the EVENTLOG_REC_ type
+        2- data the 24 bit data of the record
+
+  Output: void
+
+ */
+static void EventLog_Put(u8 type, u32 data)
+{
+  u32 word = ((u32)type << 24) | (data & 0x00FFFFFF);
+
+  if ((u8)(eventLogHead - eventLogTail) >= EVENTLOG_QUEUE_SIZE)
+  {
+    ErrCnt_Report(MODULE_ID_EVENTLOG);
+    return;
+  }
+  eventLogQueue[eventLogHead & (EVENTLOG_QUEUE_SIZE - 1)] = word;
+  eventLogHead++;
+  TimerWheel_GetTicks(&eventLogLastPut);
+  EventLog_Account(word, 1);
+}
+
+/*
+  Description: This function shall count the records of a block read from the
+  EEPROM, they end at the first word without the tag of the block
+
+  Input:
+        1- words the 16 words of the block
+        2- add 1 to add the records to the totals, 0 to take them out
+
+  Output: index of the first free word, EEPROM_BLOCK_WORDS if the block is full
+
+ */
+static u8 EventLog_ScanBlock(const u32* words, u8 add)
+{
+  u8 tag = (u8)(words[0] & 0xF);
+  u8 i;
+
+  for (i = 1; i < EEPROM_BLOCK_WORDS; i++)
+  {
+    if ((words[i] == EEPROM_ERASED_WORD) || (EVENTLOG_TAG(words[i]) != tag))
+    {
+      break;
+    }
+    EventLog_Account(words[i], add);
+  }
+  return i;
+}
+
+/*
+  Description: This function shall move the end of the log to the next block,
+  the records of its previous round leave the totals
+
+  Input: void
+
+  Output: void
+
+ */
+static void EventLog_NextBlock(void)
+{
+  u32 words[EEPROM_BLOCK_WORDS];
+
+  eventLogBlock = (eventLogBlock + 1) % EVENTLOG_BLOCK_NUM;
+  eventLogSeq = (eventLogSeq + 1) & EVENTLOG_SEQ_MASK;
+  eventLogIndex = 1;
+  eventLogHeaderPending = 1;
+
+  if ((EEPROM_Read(EVENTLOG_ADDRESS(eventLogBlock, 0), words, EEPROM_BLOCK_WORDS) == ERR_STAT_OK) &&
+      ((words[0] & EVENTLOG_HEADER_MASK) == EVENTLOG_HEADER_MAGIC))
+  {
+    EventLog_ScanBlock(words, 0);
+  }
+}
+
+/*
+  Description: This function shall queue the error counters that changed since
+  they were last logged, as far as the queue has room
+
+  Input: void
+
+  Output: void
+
+ */
+static void EventLog_CheckErrorCounters(void)
+{
+  u16 count;
+  u8 i;
+
+  for (i = 0; i < MODULE_ID_NUM; i++)
+  {
+    ErrCnt_Get(i, &count);
+    if ((count != eventLogErrCnt[i]) &&
+        ((u8)(eventLogHead - eventLogTail) < EVENTLOG_QUEUE_SIZE))
+    {
+      EventLog_Put(EVENTLOG_REC_ERROR_COUNT, ((u32)i << 16) | count);
+      eventLogErrCnt[i] = count;
+    }
+  }
+}
+
+
+/*
+  Description: This function shall start the EEPROM, find the end of the log
+  and add up the records it holds, then queue the reset cause
+
+  Input: void
+
+  Output: errStat, ERR_STAT_NOK if the EEPROM is not usable, events are then
+  counted but not stored
+
+ */
+extern errStat EventLog_Init(void)
+{
+  errStat status;
+  u32 words[EEPROM_BLOCK_WORDS];
+  u32 newestSeq = 0;
+  u8 newest = EVENTLOG_BLOCK_NUM;
+  u8 newestIndex = 1;
+  u8 index;
+  u32 cause;
+  u8 i;
+
+  eventLogHead = 0;
+  eventLogTail = 0;
+  eventLogFlushing = 0;
+  eventLogReady = 0;
+  eventLogWrite = EVENTLOG_WRITE_NONE;
+  eventLogUsage.records = 0;
+  eventLogUsage.resets = 0;
+  eventLogUsage.lampOnSeconds = 0;
+  for (i = 0; i < EVENTLOG_DOOR_NUM; i++)
+  {
+    eventLogDoorOpens[i] = 0;
+  }
+  for (i = 0; i < EVENTLOG_LAMP_NUM; i++)
+  {
+    eventLogLampOn[i] = 0;
+  }
+  for (i = 0; i < MODULE_ID_NUM; i++)
+  {
+    eventLogErrCnt[i] = 0;
+  }
+  TimerWheel_GetTicks(&eventLogErrCntTicks);
+  eventLogLastPut = eventLogErrCntTicks;
+
+  status = EEPROM_Init();
+  for (i = 0; (i < EVENTLOG_BLOCK_NUM) && (status == ERR_STAT_OK); i++)
+  {
+    status = EEPROM_Read(EVENTLOG_ADDRESS(i, 0), words, EEPROM_BLOCK_WORDS);
+    if ((status != ERR_STAT_OK) || ((words[0] & EVENTLOG_HEADER_MASK) != EVENTLOG_HEADER_MAGIC))
+    {
+      continue;
+    }
+    index = EventLog_ScanBlock(words, 1);
+    /* Newer when less than half the sequence space ahead */
+    if ((newest == EVENTLOG_BLOCK_NUM) ||
+        ((((words[0] & EVENTLOG_SEQ_MASK) - newestSeq) & EVENTLOG_SEQ_MASK) < (EVENTLOG_SEQ_MASK / 2)))
+    {
+      newest = i;
+      newestSeq = words[0] & EVENTLOG_SEQ_MASK;
+      newestIndex = index;
+    }
+  }
+
+  if (status == ERR_STAT_OK)
+  {
+    if (newest == EVENTLOG_BLOCK_NUM)
+    {
+      /* Empty log, the first block gets its header with the first record */
+      eventLogBlock = 0;
+      eventLogSeq = 0;
+      eventLogIndex = 1;
+      eventLogHeaderPending = 1;
+    }
+    else
+    {
+      eventLogBlock = newest;
+      eventLogSeq = newestSeq;
+      eventLogIndex = newestIndex;
+      eventLogHeaderPending = 0;
+    }
+    eventLogReady = 1;
+  }
+  else
+  {
+    ErrCnt_Report(MODULE_ID_EVENTLOG);
+  }
+
+  /* Cleared so that the next reset reports only its own cause */
+  SYSCTL_getResetCause(&cause);
+  SYSCTL_clearResetCause(cause);
+  EventLog_Put(EVENTLOG_REC_RESET, cause);
+
+  return status;
+}
+
+/*
+  Description: This function shall queue a door open or close record
+
+  Input:
+        1- door the door index
+        2- opened 1 when the door opened, 0 when it closed
+
+  Output: void
+
+ */
+extern void EventLog_ReportDoorEdge(u8 door, u8 opened)
+{
+  u32 now;
+
+  TimerWheel_GetTicks(&now);
+  EventLog_Put(opened ? EVENTLOG_REC_DOOR_OPENED : EVENTLOG_REC_DOOR_CLOSED,
+               ((u32)door << 16) | ((now / 1000) & 0xFFFF));
+}
+
+/*
+  Description: This function shall track the on time of a lamp, a record with
+  the on time is queued when the lamp goes off
+
+  Input:
+        1- lamp the lamp index
+        2- on 1 when the lamp went on, 0 when it went off
+
+  Output: void
+
+ */
+extern void EventLog_ReportLampState(u8 lamp, u8 on)
+{
+  u32 now;
+  u32 seconds;
+
+  if ((lamp >= EVENTLOG_LAMP_NUM) || (eventLogLampOn[lamp] == on))
+  {
+    return;
+  }
+  TimerWheel_GetTicks(&now);
+  eventLogLampOn[lamp] = on;
+  if (on)
+  {
+    eventLogLampSince[lamp] = now;
+    return;
+  }
+
+  seconds = (now - eventLogLampSince[lamp]) / 1000;
+  EventLog_Put(EVENTLOG_REC_LAMP_ON_TIME, ((u32)lamp << 16) | ((seconds > 0xFFFF) ? 0xFFFF : seconds));
+}
+
+/*
+  Description: This function shall be called last in the main loop. It queues
+  the error counters that changed every EVENTLOG_ERRCNT_PERIOD_MS and starts
+  at most one EEPROM write per call, returning at once while the EEPROM is
+  busy.
+
+  Input: void
+
+  Output: void
+
+ */
+extern void EventLog_MainFunction(void)
+{
+  u32 now;
+  u32 eepromStatus;
+  u32 address;
+  u32 word;
+  u8 write;
+
+  TimerWheel_GetTicks(&now);
+  if ((now - eventLogErrCntTicks) >= EVENTLOG_ERRCNT_PERIOD_MS)
+  {
+    eventLogErrCntTicks = now;
+    EventLog_CheckErrorCounters();
+  }
+
+  if (!eventLogReady)
+  {
+    return;
+  }
+  eepromStatus = EEPROM_StatusGet();
+  if (eepromStatus & EEPROM_RC_WORKING)
+  {
+    return;
+  }
+
+  /* The previous write is over */
+  if (eventLogWrite != EVENTLOG_WRITE_NONE)
+  {
+    if (eepromStatus & (EEPROM_RC_NOPERM | EEPROM_RC_WRBUSY))
+    {
+      /* Retrying could wear the block out, the log stops until the next reset */
+      ErrCnt_Report(MODULE_ID_EVENTLOG);
+      eventLogReady = 0;
+      return;
+    }
+    if (eventLogWrite == EVENTLOG_WRITE_HEADER)
+    {
+      eventLogHeaderPending = 0;
+    }
+    else
+    {
+      eventLogTail++;
+      eventLogIndex++;
+    }
+    eventLogWrite = EVENTLOG_WRITE_NONE;
+  }
+
+  if (eventLogHead == eventLogTail)
+  {
+    eventLogFlushing = 0;
+    return;
+  }
+  if (!eventLogFlushing)
+  {
+    if (((u8)(eventLogHead - eventLogTail) < EVENTLOG_BATCH) &&
+        ((now - eventLogLastPut) < EVENTLOG_QUIET_MS))
+    {
+      return;
+    }
+    eventLogFlushing = 1;
+  }
+
+  if (eventLogIndex == EEPROM_BLOCK_WORDS)
+  {
+    EventLog_NextBlock();
+  }
+
+  if (eventLogHeaderPending)
+  {
+    address = EVENTLOG_ADDRESS(eventLogBlock, 0);
+    word = EVENTLOG_HEADER_MAGIC | eventLogSeq;
+    write = EVENTLOG_WRITE_HEADER;
+  }
+  else
+  {
+    address = EVENTLOG_ADDRESS(eventLogBlock, eventLogIndex);
+    word = ((eventLogSeq & 0xF) << 28) | eventLogQueue[eventLogTail & (EVENTLOG_QUEUE_SIZE - 1)];
+    write = EVENTLOG_WRITE_RECORD;
+  }
+
+  if (EEPROM_WriteStart(address, word) == ERR_STAT_OK)
+  {
+    eventLogWrite = write;
+  }
+}
+
+/*
+  Description: This function shall return the totals of the records in the log
+
+  Input: usage receives the totals
+
+  Output: errStat
+
+ */
+extern errStat EventLog_GetUsage(eventLogUsage_t* usage)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (usage == 0)
+  {
+    Det_ReportError(MODULE_ID_EVENTLOG, EVENTLOG_API_GET_USAGE, EVENTLOG_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  *usage = eventLogUsage;
+  return ERR_STAT_OK;
+}
+
+/*
+  Description: This function shall return how often a door opened according
+  to the records in the log
+
+  Input: door the door index, below EVENTLOG_DOOR_NUM
+
+  Output: number of EVENTLOG_REC_DOOR_OPENED records of the door
+
+ */
+extern u16 EventLog_GetDoorOpens(u8 door)
+{
+  return (door < EVENTLOG_DOOR_NUM) ? eventLogDoorOpens[door] : 0;
+}
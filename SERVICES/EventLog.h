@@ -0,0 +1,127 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+/*
+  Persistent usage log in the on-chip EEPROM.
+
+  Every record is one word, written in a single EEPROM write:
+      tag (4 bits) | type (4 bits) | data (24 bits)
+  The log takes EVENTLOG_BLOCK_NUM EEPROM blocks used round robin, so every
+  block (and every word of it) wears at the same rate. Word 0 of a block is
+  its header, EVENTLOG_HEADER_MAGIC and the 24 bit sequence number of the
+  block; the other 15 words hold records appended in order. A record carries
+  the low 4 bits of its block sequence as tag: records left over from the
+  previous round of a block have another tag, so reusing a block only costs
+  its header write and nothing has to be erased. After a reset the block
+  with the newest sequence is the current one and its first word without
+  the current tag is the next free one.
+
+  Reporting an event only queues the record in RAM. EventLog_MainFunction,
+  run last in the main loop, writes the queue out one word per call, never
+  waiting for the EEPROM: writing starts once EVENTLOG_BATCH records are
+  waiting or no record came in for EVENTLOG_QUIET_MS, and goes on until the
+  queue is empty. Records still queued when the power goes are lost.
+*/
+
+/* Record types */
+#define EVENTLOG_REC_DOOR_OPENED   0x1   /* data: door (8), seconds since reset (16) */
+#define EVENTLOG_REC_DOOR_CLOSED   0x2   /* data: door (8), seconds since reset (16) */
+#define EVENTLOG_REC_LAMP_ON_TIME  0x3   /* data: lamp (8), seconds on (16, saturated) */
+#define EVENTLOG_REC_RESET         0x4   /* data: SYSCTL_CAUSE_xxx bits */
+#define EVENTLOG_REC_ERROR_COUNT   0x5   /* data: module id (8), error count (16) */
+
+/* Header word of a log block, the sequence is in the low 24 bits */
+#define EVENTLOG_HEADER_MAGIC      0x4C000000
+#define EVENTLOG_HEADER_MASK       0xFF000000
+#define EVENTLOG_SEQ_MASK          0x00FFFFFF
+
+/* Fields of a record word */
+#define EVENTLOG_TAG(word)         ((u8)((word) >> 28))
+#define EVENTLOG_TYPE(word)        ((u8)(((word) >> 24) & 0xF))
+#define EVENTLOG_DATA(word)        ((word) & 0x00FFFFFF)
+
+/* API and error ids reported to the Development Error Tracer */
+#define EVENTLOG_API_GET_USAGE     0x00
+
+#define EVENTLOG_E_PARAM_POINTER   0x0A
+
+typedef struct
+{
+  u16 records;          /* records in the EEPROM and waiting in the queue */
+  u16 resets;           /* EVENTLOG_REC_RESET records */
+  u32 lampOnSeconds;    /* sum of the EVENTLOG_REC_LAMP_ON_TIME records */
+} eventLogUsage_t;
+
+
+/*
+  Description: This function shall start the EEPROM, find the end of the log
+  and add up the records it holds, then queue the reset cause
+
+  Input: void
+
+  Output: errStat, ERR_STAT_NOK if the EEPROM is not usable, events are then
+  counted but not stored
+
+ */
+extern errStat EventLog_Init(void);
+
+/*
+  Description: This function shall queue a door open or close record
+
+  Input:
+        1- door the door index
+        2- opened 1 when the door opened, 0 when it closed
+
+  Output: void
+
+ */
+extern void EventLog_ReportDoorEdge(u8 door, u8 opened);
+
+/*
+  Description: This function shall track the on time of a lamp, a record with
+  the on time is queued when the lamp goes off
+
+  Input:
+        1- lamp the lamp index
+        2- on 1 when the lamp went on, 0 when it went off
+
+  Output: void
+
+ */
+extern void EventLog_ReportLampState(u8 lamp, u8 on);
+
+/*
+  Description: This function shall be called last in the main loop. It queues
+  the error counters that changed every EVENTLOG_ERRCNT_PERIOD_MS and starts
+  at most one EEPROM write per call, returning at once while the EEPROM is
+  busy.
+
+  Input: void
+
+  Output: void
+
+ */
+extern void EventLog_MainFunction(void);
+
+/*
+  Description: This function shall return the totals of the records in the log
+
+  Input: usage receives the totals
+
+  Output: errStat
+
+ */
+extern errStat EventLog_GetUsage(eventLogUsage_t* usage);
+
+/*
+  Description: This function shall return how often a door opened according
+  to the records in the log
+
+  Input: door the door index, below EVENTLOG_DOOR_NUM
+
+  Output: number of EVENTLOG_REC_DOOR_OPENED records of the door
+
+ */
+extern u16 EventLog_GetDoorOpens(u8 door);
+
+#endif
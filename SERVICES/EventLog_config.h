@@ -0,0 +1,41 @@
+#ifndef EVENTLOG_CONFIG_H
+#define EVENTLOG_CONFIG_H
+
+/* EEPROM blocks of the log, no other data may live in them */
+#define EVENTLOG_FIRST_BLOCK        0
+#define EVENTLOG_BLOCK_NUM          8
+
+/* Records waiting for the EEPROM, a power of two */
+#define EVENTLOG_QUEUE_SIZE         16
+
+/* Writing starts with this many records waiting ... */
+#define EVENTLOG_BATCH              8
+
+/* ... or once no record came in for this long */
+#define EVENTLOG_QUIET_MS           2000
+
+/* Changed error counters are logged at most this often */
+#define EVENTLOG_ERRCNT_PERIOD_MS   60000
+
+/* Doors and lamps with their own totals */
+#define EVENTLOG_DOOR_NUM           2
+#define EVENTLOG_LAMP_NUM           1
+
+#if (EVENTLOG_QUEUE_SIZE & (EVENTLOG_QUEUE_SIZE - 1)) != 0
+#error "EVENTLOG_QUEUE_SIZE must be a power of two"
+#endif
+
+#if (EVENTLOG_BATCH == 0) || (EVENTLOG_BATCH > EVENTLOG_QUEUE_SIZE)
+#error "EVENTLOG_BATCH must be 1 to EVENTLOG_QUEUE_SIZE"
+#endif
+
+#if (EVENTLOG_BLOCK_NUM < 2) || ((EVENTLOG_FIRST_BLOCK + EVENTLOG_BLOCK_NUM) > EEPROM_BLOCK_NUM)
+#error "The log needs at least 2 blocks inside the EEPROM"
+#endif
+
+/* A record of the previous round of a block must not carry the current tag */
+#if (EVENTLOG_BLOCK_NUM % 16) == 0
+#error "EVENTLOG_BLOCK_NUM must not be a multiple of 16"
+#endif
+
+#endif
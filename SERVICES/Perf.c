@@ -0,0 +1,114 @@
+#include "STD_TYPES.h"
+#include "dwt.h"
+#include "Perf.h"
+
+
+static ECU_STATE perfStats_t perfStats;
+static ECU_STATE u32 perfLastMark;
+static ECU_STATE u8 perfStarted;
+
+
+/* 
+  Description: This function shall clear the statistics of the current window
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void Perf_ResetWindow(void)
+{
+  perfStats.loops = 0;
+  perfStats.minCycles = 0xFFFFFFFF;
+  perfStats.maxCycles = 0;
+  perfStats.totalCycles = 0;
+}
+
+/* 
+  Description: This function shall start the cycle counter and clear all statistics
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+extern errStat Perf_Init(void)
+{
+  Perf_ResetWindow();
+  perfStats.lifetimeMax = 0;
+  perfStarted = 0;
+  
+  return DWT_Init();
+}
+
+/* 
+  Description: This function shall be called once at the start of every main loop
+  iteration and accounts the time elapsed since the previous call
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Perf_LoopMark(void)
+{
+  u32 now = DWT_CycleCountGet();
+  u32 period = now - perfLastMark;
+  
+  perfLastMark = now;
+  
+  /* The first mark only sets the reference point */
+  if (!perfStarted)
+  {
+    perfStarted = 1;
+    return;
+  }
+  
+  perfStats.loops++;
+  perfStats.totalCycles += period;
+  if (period < perfStats.minCycles)
+  {
+    perfStats.minCycles = period;
+  }
+  if (period > perfStats.maxCycles)
+  {
+    perfStats.maxCycles = period;
+    if (period > perfStats.lifetimeMax)
+    {
+      perfStats.lifetimeMax = period;
+    }
+  }
+}
+
+/* 
+  Description: This function shall copy the current statistics
+  
+  Input: 
+        1- stats receives the statistics
+        2- reset PERF_RESET_WINDOW to start a new window after the copy
+        
+  Output: errStat
+
+ */
+extern errStat Perf_GetStats(perfStats_t* stats, u8 reset)
+{
+  errStat status = ERR_STAT_OK;
+  if (stats == 0)
+  {
+    return ERR_STAT_NOK;
+  }
+  
+  *stats = perfStats;
+  /* An empty window has no minimum */
+  if (stats->loops == 0)
+  {
+    stats->minCycles = 0;
+  }
+  
+  if (reset == PERF_RESET_WINDOW)
+  {
+    Perf_ResetWindow();
+  }
+  
+  return status;
+}
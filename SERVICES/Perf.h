@@ -0,0 +1,55 @@
+#ifndef PERF_H
+#define PERF_H
+
+/*
+  Main loop run time statistics, measured in core clock cycles between two
+  consecutive calls of Perf_LoopMark.
+*/
+typedef struct 
+{
+  u32 loops;          /* loop iterations in the current window */
+  u32 minCycles;      /* shortest loop period in the current window */
+  u32 maxCycles;      /* longest loop period in the current window */
+  u32 totalCycles;    /* sum of loop periods in the current window */
+  u32 lifetimeMax;    /* longest loop period since Perf_Init */
+} perfStats_t;
+
+/* Values of the reset argument of Perf_GetStats */
+#define PERF_KEEP_WINDOW   0
+#define PERF_RESET_WINDOW  1
+
+
+/* 
+  Description: This function shall start the cycle counter and clear all statistics
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+extern errStat Perf_Init(void);
+
+/* 
+  Description: This function shall be called once at the start of every main loop
+  iteration and accounts the time elapsed since the previous call
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Perf_LoopMark(void);
+
+/* 
+  Description: This function shall copy the current statistics
+  
+  Input: 
+        1- stats receives the statistics
+        2- reset PERF_RESET_WINDOW to start a new window after the copy
+        
+  Output: errStat
+
+ */
+extern errStat Perf_GetStats(perfStats_t* stats, u8 reset);
+
+#endif
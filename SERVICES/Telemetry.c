@@ -0,0 +1,289 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "nvic.h"
+#include "uart.h"
+#include "dwt.h"
+
+#include "COBS.h"
+#include "CRC8.h"
+
+#include "Perf.h"
+#include "Telemetry.h"
+#include "Telemetry_config.h"
+
+
+#define TELEMETRY_RING_MASK   (TELEMETRY_TX_RING_SIZE - 1)
+
+/* Encoded frame and its delimiter */
+#define TELEMETRY_ENCODED_MAX (COBS_ENCODED_MAX(TELEMETRY_FRAME_MAX) + 1)
+
+/*
+  Single producer (main loop) single consumer (UART TX interrupt) ring.
+  Only the producer writes txHead and only the consumer writes txTail, the
+  indexes run freely and are masked on access.
+*/
+static ECU_STATE volatile u8 txRing[TELEMETRY_TX_RING_SIZE];
+static ECU_STATE volatile u16 txHead;
+static ECU_STATE volatile u16 txTail;
+
+static ECU_STATE u8 txSequence;
+static ECU_STATE u16 txDropped;
+static ECU_STATE u32 perfLastReport;
+
+
+/* 
+  Description: This function shall move bytes from the ring into the UART FIFO
+  until the FIFO is full or the ring is empty
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void Telemetry_FillFifo(void)
+{
+  u16 tail = txTail;
+  
+  while (tail != txHead)
+  {
+    if (UART_CharPutNonBlocking(TELEMETRY_UART_BASE, txRing[tail & TELEMETRY_RING_MASK]) != ERR_STAT_OK)
+    {
+      break;
+    }
+    tail++;
+  }
+  txTail = tail;
+  
+  /* Nothing left to send, the next record restarts the transmission */
+  if (tail == txHead)
+  {
+    UART_IntDisable(TELEMETRY_UART_BASE, UART_INT_TX);
+  }
+}
+
+/* 
+  Description: This function shall be called from the UART interrupt when the
+  transmit FIFO drained below its trigger level
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void Telemetry_TxNotification(void)
+{
+  Telemetry_FillFifo();
+}
+
+/* 
+  Description: This function shall start the transmission of newly queued bytes.
+  The TX interrupt is masked while the main loop primes the FIFO so the ring
+  has a single consumer at any time. Once the FIFO is above its trigger level
+  the interrupt is unmasked and keeps draining the ring on its own.
+  
+  Input: void
+  
+  Output: void
+
+ */
+static void Telemetry_StartTx(void)
+{
+  UART_IntDisable(TELEMETRY_UART_BASE, UART_INT_TX);
+  Telemetry_FillFifo();
+  if (txTail != txHead)
+  {
+    UART_IntEnable(TELEMETRY_UART_BASE, UART_INT_TX);
+  }
+}
+
+/* 
+  Description: This function shall configure the UART, its pins and interrupt
+  and clear the transmit ring
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+extern errStat Telemetry_Init(void)
+{
+  errStat status = ERR_STAT_OK;
+  
+  txHead = 0;
+  txTail = 0;
+  txSequence = 0;
+  txDropped = 0;
+  perfLastReport = DWT_CycleCountGet();
+  
+  /* Enabling peripheral clocks of the UART and its port */
+  status |= SYSCTL_controlGPIO(TELEMETRY_GPIO_SYSCTL,SYSCTL_GPIO_ENABLE);
+  status |= SYSCTL_controlUART(TELEMETRY_UART_SYSCTL,SYSCTL_UART_ENABLE);
+  
+  /* Handing the pins over to the UART */
+  status |= GPIO_AltFunctionSet(TELEMETRY_GPIO_PORT,TELEMETRY_GPIO_PINS,TELEMETRY_GPIO_FUNC);
+  
+  status |= UART_Init(TELEMETRY_UART_BASE,SYSCTL_MAIN_OSCILLATOR_HZ,TELEMETRY_BAUD_RATE);
+  status |= UART_IntRegister(TELEMETRY_UART_BASE,UART_EVENT_TX,Telemetry_TxNotification);
+  
+  /* Below the door path so logging never delays it */
+  status |= NVIC_IntPrioritySet(TELEMETRY_UART_INT,TELEMETRY_UART_PRIORITY);
+  status |= NVIC_IntEnable(TELEMETRY_UART_INT);
+  
+  return status;
+}
+
+/* 
+  Description: This function shall queue a record for transmission without waiting,
+  the record is dropped if the transmit ring has no room for it.
+  Must only be called from the main loop, never from an interrupt.
+  
+  Input: 
+        1- type the record type
+        2- payload the record payload
+        3- len the number of payload bytes, at most TELEMETRY_PAYLOAD_MAX
+        
+  Output: errStat, ERR_STAT_NOK if the record was dropped
+
+ */
+extern errStat Telemetry_SendRecord(u8 type, const u8* payload, u8 len)
+{
+  u8 frame[TELEMETRY_FRAME_MAX];
+  u8 encoded[TELEMETRY_ENCODED_MAX];
+  u16 encodedLen;
+  u16 head;
+  u16 i;
+  u32 timestamp = DWT_CycleCountGet();
+  
+  if (len > TELEMETRY_PAYLOAD_MAX)
+  {
+    return ERR_STAT_NOK;
+  }
+  
+  /* Building the raw record */
+  frame[0] = type;
+  frame[1] = txSequence++;
+  frame[2] = (u8)(timestamp);
+  frame[3] = (u8)(timestamp >> 8);
+  frame[4] = (u8)(timestamp >> 16);
+  frame[5] = (u8)(timestamp >> 24);
+  for (i = 0; i < len; i++)
+  {
+    frame[TELEMETRY_HEADER_LEN + i] = payload[i];
+  }
+  frame[TELEMETRY_HEADER_LEN + len] = CRC8_Update(CRC8_INIT, frame, TELEMETRY_HEADER_LEN + len);
+  
+  encodedLen = COBS_Encode(frame, TELEMETRY_HEADER_LEN + len + 1, encoded);
+  encoded[encodedLen++] = COBS_DELIMITER;
+  
+  /* Whole frames only, a partial frame would corrupt the next one too */
+  head = txHead;
+  if ((u16)(TELEMETRY_TX_RING_SIZE - (u16)(head - txTail)) < encodedLen)
+  {
+    txDropped++;
+    return ERR_STAT_NOK;
+  }
+  for (i = 0; i < encodedLen; i++)
+  {
+    txRing[(head + i) & TELEMETRY_RING_MASK] = encoded[i];
+  }
+  txHead = head + encodedLen;
+  
+  Telemetry_StartTx();
+  
+  return ERR_STAT_OK;
+}
+
+/* 
+  Description: This function shall report a change of a door state
+  
+  Input: 
+        1- doorId the switch index of the door
+        2- doorState DOOR_OPENED or DOOR_CLOSED
+        
+  Output: errStat
+
+ */
+extern errStat Telemetry_ReportDoorEdge(u8 doorId, u8 doorState)
+{
+  u8 payload[2];
+  
+  payload[0] = doorId;
+  payload[1] = doorState;
+  
+  return Telemetry_SendRecord(TELEMETRY_REC_DOOR_EDGE, payload, 2);
+}
+
+/* 
+  Description: This function shall report a change of a lamp state
+  
+  Input: 
+        1- lampNum the index of the lamp in the lamp array
+        2- lampState 1 for on and 0 for off
+        
+  Output: errStat
+
+ */
+extern errStat Telemetry_ReportLampState(u8 lampNum, u8 lampState)
+{
+  u8 payload[2];
+  
+  payload[0] = lampNum;
+  payload[1] = lampState;
+  
+  return Telemetry_SendRecord(TELEMETRY_REC_LAMP_STATE, payload, 2);
+}
+
+/* 
+  Description: This function shall be called from the main loop and sends the
+  perf counter record every TELEMETRY_PERF_PERIOD_CYCLES
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Telemetry_MainFunction(void)
+{
+  perfStats_t stats;
+  u8 payload[14];
+  u32 now = DWT_CycleCountGet();
+  
+  if ((u32)(now - perfLastReport) < TELEMETRY_PERF_PERIOD_CYCLES)
+  {
+    return;
+  }
+  perfLastReport = now;
+  
+  Perf_GetStats(&stats, PERF_RESET_WINDOW);
+  
+  payload[0]  = (u8)(stats.loops);
+  payload[1]  = (u8)(stats.loops >> 8);
+  payload[2]  = (u8)(stats.loops >> 16);
+  payload[3]  = (u8)(stats.loops >> 24);
+  payload[4]  = (u8)(stats.minCycles);
+  payload[5]  = (u8)(stats.minCycles >> 8);
+  payload[6]  = (u8)(stats.minCycles >> 16);
+  payload[7]  = (u8)(stats.minCycles >> 24);
+  payload[8]  = (u8)(stats.maxCycles);
+  payload[9]  = (u8)(stats.maxCycles >> 8);
+  payload[10] = (u8)(stats.maxCycles >> 16);
+  payload[11] = (u8)(stats.maxCycles >> 24);
+  payload[12] = (u8)(txDropped);
+  payload[13] = (u8)(txDropped >> 8);
+  
+  Telemetry_SendRecord(TELEMETRY_REC_PERF, payload, 14);
+}
+
+/* 
+  Description: This function shall return the number of records dropped since init
+  
+  Input: void
+  
+  Output: dropped record count
+
+ */
+extern u16 Telemetry_GetDroppedCount(void)
+{
+  return txDropped;
+}
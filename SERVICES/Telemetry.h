@@ -0,0 +1,97 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/*
+  Telemetry record format, shared with the host decoder.
+
+  Every record is built as
+      type (1) | sequence (1) | timestamp (4, little endian, DWT cycles) |
+      payload (0..TELEMETRY_PAYLOAD_MAX) | CRC-8 over all previous bytes (1)
+  then COBS encoded and terminated by a 0x00 delimiter.
+
+  The sequence number advances on every record, including records dropped
+  because the transmit ring was full, so the receiver can count losses.
+*/
+#define TELEMETRY_HEADER_LEN       6
+#define TELEMETRY_PAYLOAD_MAX      40
+#define TELEMETRY_FRAME_MAX        (TELEMETRY_HEADER_LEN + TELEMETRY_PAYLOAD_MAX + 1)
+
+/* Record types */
+#define TELEMETRY_REC_DOOR_EDGE    0x01   /* payload: doorId, state */
+#define TELEMETRY_REC_LAMP_STATE   0x02   /* payload: lampNum, state */
+#define TELEMETRY_REC_PERF         0x03   /* payload: loops, minCycles, maxCycles (u32 LE), dropped (u16 LE) */
+#define TELEMETRY_REC_DIAG_RESPONSE 0x10  /* payload: diagnostic response, see Diag.h */
+
+
+/* 
+  Description: This function shall configure the UART, its pins and interrupt
+  and clear the transmit ring
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+extern errStat Telemetry_Init(void);
+
+/* 
+  Description: This function shall queue a record for transmission without waiting,
+  the record is dropped if the transmit ring has no room for it.
+  Must only be called from the main loop, never from an interrupt.
+  
+  Input: 
+        1- type the record type
+        2- payload the record payload
+        3- len the number of payload bytes, at most TELEMETRY_PAYLOAD_MAX
+        
+  Output: errStat, ERR_STAT_NOK if the record was dropped
+
+ */
+extern errStat Telemetry_SendRecord(u8 type, const u8* payload, u8 len);
+
+/* 
+  Description: This function shall report a change of a door state
+  
+  Input: 
+        1- doorId the switch index of the door
+        2- doorState DOOR_OPENED or DOOR_CLOSED
+        
+  Output: errStat
+
+ */
+extern errStat Telemetry_ReportDoorEdge(u8 doorId, u8 doorState);
+
+/* 
+  Description: This function shall report a change of a lamp state
+  
+  Input: 
+        1- lampNum the index of the lamp in the lamp array
+        2- lampState 1 for on and 0 for off
+        
+  Output: errStat
+
+ */
+extern errStat Telemetry_ReportLampState(u8 lampNum, u8 lampState);
+
+/* 
+  Description: This function shall be called from the main loop and sends the
+  perf counter record every TELEMETRY_PERF_PERIOD_CYCLES
+  
+  Input: void
+  
+  Output: void
+
+ */
+extern void Telemetry_MainFunction(void);
+
+/* 
+  Description: This function shall return the number of records dropped since init
+  
+  Input: void
+  
+  Output: dropped record count
+
+ */
+extern u16 Telemetry_GetDroppedCount(void);
+
+#endif
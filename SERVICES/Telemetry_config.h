@@ -0,0 +1,26 @@
+#ifndef TELEMETRY_CONFIG_H
+#define TELEMETRY_CONFIG_H
+
+/* UART0 on PA0/PA1 is routed to the ICDI virtual COM port of the LaunchPad */
+#define TELEMETRY_UART_BASE            UART0_BASE
+#define TELEMETRY_UART_SYSCTL          SYSCTL_UART_0
+#define TELEMETRY_UART_INT             NVIC_INT_UART0
+#define TELEMETRY_UART_PRIORITY        6
+#define TELEMETRY_BAUD_RATE            115200
+
+#define TELEMETRY_GPIO_SYSCTL          SYSCTL_GPIO_A
+#define TELEMETRY_GPIO_PORT            GPIO_PORTA_BASE
+#define TELEMETRY_GPIO_PINS            (GPIO_PIN_0 | GPIO_PIN_1)
+#define TELEMETRY_GPIO_FUNC            1
+
+/* Size of the transmit ring in bytes, must be a power of two */
+#define TELEMETRY_TX_RING_SIZE         256
+
+/* Period of the perf counter records in core clock cycles (1 s) */
+#define TELEMETRY_PERF_PERIOD_CYCLES   SYSCTL_MAIN_OSCILLATOR_HZ
+
+#if (TELEMETRY_TX_RING_SIZE & (TELEMETRY_TX_RING_SIZE - 1)) != 0
+#error "TELEMETRY_TX_RING_SIZE must be a power of two"
+#endif
+
+#endif
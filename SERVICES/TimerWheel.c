@@ -0,0 +1,517 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "nvic.h"
+#include "gpt.h"
+#include "MODULE_IDS.h"
+#include "ErrCnt.h"
+#include "Det.h"
+#include "Det_config.h"
+
+#include "TimerWheel.h"
+#include "TimerWheel_config.h"
+
+
+/*
+  Four levels of 64 slots. A level 0 slot holds the timers expiring in one
+  tick, a level L slot the timers expiring in a range of 64^L ticks, which
+  are spread into the lower levels when the wheel time enters that range.
+*/
+#define TIMERWHEEL_LEVEL_BITS   6
+#define TIMERWHEEL_LEVEL_NUM    4
+#define TIMERWHEEL_SLOT_NUM     (1 << TIMERWHEEL_LEVEL_BITS)
+#define TIMERWHEEL_SLOT_MASK    (TIMERWHEEL_SLOT_NUM - 1)
+
+/* End of a list, and slot of a timer that is not running */
+#define TIMERWHEEL_NIL          0xFFFF
+
+/* Timers, linked into the list of their slot or into the free list */
+static ECU_STATE timerWheelCallback_t twCallback[TIMERWHEEL_TIMER_NUM];
+static ECU_STATE u32 twExpires[TIMERWHEEL_TIMER_NUM];
+static ECU_STATE u32 twPeriod[TIMERWHEEL_TIMER_NUM];
+static ECU_STATE u16 twNext[TIMERWHEEL_TIMER_NUM];
+static ECU_STATE u16 twPrev[TIMERWHEEL_TIMER_NUM];
+static ECU_STATE u16 twSlot[TIMERWHEEL_TIMER_NUM];
+static ECU_STATE u16 twFree;
+
+/* First timer of every slot and one bit per non empty slot */
+static ECU_STATE u16 twHead[TIMERWHEEL_LEVEL_NUM * TIMERWHEEL_SLOT_NUM];
+static ECU_STATE u32 twOccupied[TIMERWHEEL_LEVEL_NUM][2];
+
+/*
+  Wheel time in ticks and the counter value at its start. The wheel time
+  only moves in the interrupt, the current time is derived from the counter.
+*/
+static ECU_STATE u32 twNow;
+static ECU_STATE u32 twBaseCycles;
+static ECU_STATE u8 twInNotification;
+
+
+/*
+  Description: This function shall find the lowest set bit of a word
+
+  Input: word a non zero 32 bit value
+
+  Output: u8 index of the bit
+
+ */
+static u8 TimerWheel_LowestBit(u32 word)
+{
+  static const u8 deBruijnIndex[32] =
+  {
+    0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+  };
+
+  return deBruijnIndex[(u32)((word & (0 - word)) * 0x077CB531UL) >> 27];
+}
+
+/*
+  Description: This function shall find the first non empty slot of a level,
+  searching circularly from a slot
+
+  Input:
+        1- level the level to search
+        2- from the first slot to look at
+
+  Output: u8 number of slots from "from" to the first non empty one, or
+  TIMERWHEEL_SLOT_NUM when the level is empty
+
+ */
+static u8 TimerWheel_NextSlot(u8 level, u8 from)
+{
+  u32 low = twOccupied[level][0];
+  u32 high = twOccupied[level][1];
+  u32 masked;
+  u8 slot;
+
+  if ((low | high) == 0)
+  {
+    return TIMERWHEEL_SLOT_NUM;
+  }
+
+  if (from < 32)
+  {
+    masked = low & (u32)(0xFFFFFFFFUL << from);
+    slot = (masked != 0) ? TimerWheel_LowestBit(masked) :
+           (high != 0) ? (32 + TimerWheel_LowestBit(high)) : TimerWheel_LowestBit(low);
+  }
+  else
+  {
+    masked = high & (u32)(0xFFFFFFFFUL << (from - 32));
+    slot = (masked != 0) ? (32 + TimerWheel_LowestBit(masked)) :
+           (low != 0) ? TimerWheel_LowestBit(low) : (32 + TimerWheel_LowestBit(high));
+  }
+  return (slot - from) & TIMERWHEEL_SLOT_MASK;
+}
+
+/*
+  Description: This function shall insert a timer into the slot matching its
+  expiry, relative to the wheel time
+
+  Input: timerId the timer, not linked into any slot
+
+  Output: void
+
+ */
+static void TimerWheel_Link(u16 timerId)
+{
+  u32 delta = twExpires[timerId] - twNow;
+  u8 level = 0;
+  u16 slot;
+
+  while ((level < (TIMERWHEEL_LEVEL_NUM - 1)) &&
+         (delta >= (1UL << (TIMERWHEEL_LEVEL_BITS * (level + 1)))))
+  {
+    level++;
+  }
+  slot = (level * TIMERWHEEL_SLOT_NUM) +
+         ((twExpires[timerId] >> (TIMERWHEEL_LEVEL_BITS * level)) & TIMERWHEEL_SLOT_MASK);
+
+  twSlot[timerId] = slot;
+  twPrev[timerId] = TIMERWHEEL_NIL;
+  twNext[timerId] = twHead[slot];
+  if (twHead[slot] != TIMERWHEEL_NIL)
+  {
+    twPrev[twHead[slot]] = timerId;
+  }
+  twHead[slot] = timerId;
+  twOccupied[level][(slot & TIMERWHEEL_SLOT_MASK) >> 5] |= (1UL << (slot & 31));
+}
+
+/*
+  Description: This function shall remove a timer from the list of its slot
+
+  Input: timerId a running timer
+
+  Output: void
+
+ */
+static void TimerWheel_Unlink(u16 timerId)
+{
+  u16 slot = twSlot[timerId];
+
+  if (twPrev[timerId] == TIMERWHEEL_NIL)
+  {
+    twHead[slot] = twNext[timerId];
+  }
+  else
+  {
+    twNext[twPrev[timerId]] = twNext[timerId];
+  }
+  if (twNext[timerId] != TIMERWHEEL_NIL)
+  {
+    twPrev[twNext[timerId]] = twPrev[timerId];
+  }
+  if (twHead[slot] == TIMERWHEEL_NIL)
+  {
+    twOccupied[slot / TIMERWHEEL_SLOT_NUM][(slot & TIMERWHEEL_SLOT_MASK) >> 5] &= ~(1UL << (slot & 31));
+  }
+  twSlot[timerId] = TIMERWHEEL_NIL;
+}
+
+/*
+  Description: This function shall compute the next time the wheel has work:
+  the first non empty level 0 slot, or the start of the range of the first
+  non empty slot of a higher level
+
+  Input: void
+
+  Output: u32 ticks from the wheel time to that event, 0xFFFFFFFF when no
+  timer runs
+
+ */
+static u32 TimerWheel_NextEvent(void)
+{
+  u32 best = 0xFFFFFFFF;
+  u32 distance;
+  u32 index;
+  u8 level, shift, slots;
+
+  for (level = 0; level < TIMERWHEEL_LEVEL_NUM; level++)
+  {
+    shift = TIMERWHEEL_LEVEL_BITS * level;
+    index = twNow >> shift;
+    slots = TimerWheel_NextSlot(level, (index + 1) & TIMERWHEEL_SLOT_MASK);
+    if (slots < TIMERWHEEL_SLOT_NUM)
+    {
+      distance = ((index + slots + 1) << shift) - twNow;
+      if (distance < best)
+      {
+        best = distance;
+      }
+    }
+  }
+  return best;
+}
+
+/*
+  Description: This function shall do the work due at the wheel time: spread
+  the higher level slots whose range starts now, then expire level 0
+
+  Input: void
+
+  Output: void
+
+ */
+static void TimerWheel_Process(void)
+{
+  u16 timerId;
+  u16 slot;
+  u8 level, shift;
+
+  for (level = TIMERWHEEL_LEVEL_NUM - 1; level > 0; level--)
+  {
+    shift = TIMERWHEEL_LEVEL_BITS * level;
+    if ((twNow & ((1UL << shift) - 1)) == 0)
+    {
+      slot = (level * TIMERWHEEL_SLOT_NUM) + ((twNow >> shift) & TIMERWHEEL_SLOT_MASK);
+      while (twHead[slot] != TIMERWHEEL_NIL)
+      {
+        timerId = twHead[slot];
+        TimerWheel_Unlink(timerId);
+        TimerWheel_Link(timerId);
+      }
+    }
+  }
+
+  /*
+    Timers are taken one by one so a callback may stop or start any timer.
+    Rescheduled timers never land in the slot being expired.
+  */
+  slot = twNow & TIMERWHEEL_SLOT_MASK;
+  while (twHead[slot] != TIMERWHEEL_NIL)
+  {
+    timerId = twHead[slot];
+    TimerWheel_Unlink(timerId);
+    if (twPeriod[timerId] != TIMERWHEEL_ONE_SHOT)
+    {
+      twExpires[timerId] += twPeriod[timerId];
+      TimerWheel_Link(timerId);
+    }
+    twCallback[timerId](timerId);
+  }
+}
+
+/*
+  Description: This function shall read the current time from the counter
+
+  Input: void
+
+  Output: u32 current time in ticks, never behind the wheel time
+
+ */
+static u32 TimerWheel_CurrentTicks(void)
+{
+  u32 cycles;
+
+  GPT_CounterGet(TIMERWHEEL_GPT_BASE, &cycles);
+  return twNow + ((cycles - twBaseCycles) / TIMERWHEEL_TICK_CYCLES);
+}
+
+/*
+  Description: This function shall move the wheel time forward, doing the
+  work of every event on the way. Ticks without work are skipped at once.
+
+  Input: target the new wheel time
+
+  Output: void
+
+ */
+static void TimerWheel_Advance(u32 target)
+{
+  u32 distance;
+
+  for (;;)
+  {
+    distance = TimerWheel_NextEvent();
+    if (distance > (target - twNow))
+    {
+      break;
+    }
+    twNow += distance;
+    twBaseCycles += distance * TIMERWHEEL_TICK_CYCLES;
+    TimerWheel_Process();
+  }
+  twBaseCycles += (target - twNow) * TIMERWHEEL_TICK_CYCLES;
+  twNow = target;
+}
+
+/*
+  Description: This function shall arm the match interrupt for the next
+  event, at the latest TIMERWHEEL_WAKE_MAX_TICKS away
+
+  Input: void
+
+  Output: u8 1 when the counter already passed the event, so the interrupt
+  would not fire in time
+
+ */
+static u8 TimerWheel_Program(void)
+{
+  u32 distance = TimerWheel_NextEvent();
+  u32 cycles;
+
+  if (distance > TIMERWHEEL_WAKE_MAX_TICKS)
+  {
+    distance = TIMERWHEEL_WAKE_MAX_TICKS;
+  }
+  distance *= TIMERWHEEL_TICK_CYCLES;
+  GPT_MatchSet(TIMERWHEEL_GPT_BASE, twBaseCycles + distance);
+
+  GPT_CounterGet(TIMERWHEEL_GPT_BASE, &cycles);
+  return ((cycles - twBaseCycles) >= distance) ? 1 : 0;
+}
+
+/*
+  Description: This function shall be called from the timer interrupt on a
+  match and catch up with the current time
+
+  Input: void
+
+  Output: void
+
+ */
+static void TimerWheel_GptNotification(void)
+{
+  twInNotification = 1;
+  do
+  {
+    TimerWheel_Advance(TimerWheel_CurrentTicks());
+  } while (TimerWheel_Program() != 0);
+  twInNotification = 0;
+}
+
+errStat TimerWheel_Init(void)
+{
+  u16 timerId;
+  u16 slot;
+
+  NVIC_IntDisable(TIMERWHEEL_GPT_INT);
+
+  for (timerId = 0; timerId < TIMERWHEEL_TIMER_NUM; timerId++)
+  {
+    twCallback[timerId] = 0;
+    twSlot[timerId] = TIMERWHEEL_NIL;
+    twNext[timerId] = timerId + 1;
+  }
+  twNext[TIMERWHEEL_TIMER_NUM - 1] = TIMERWHEEL_NIL;
+  twFree = 0;
+
+  for (slot = 0; slot < (TIMERWHEEL_LEVEL_NUM * TIMERWHEEL_SLOT_NUM); slot++)
+  {
+    twHead[slot] = TIMERWHEEL_NIL;
+  }
+  for (slot = 0; slot < TIMERWHEEL_LEVEL_NUM; slot++)
+  {
+    twOccupied[slot][0] = 0;
+    twOccupied[slot][1] = 0;
+  }
+
+  if (SYSCTL_controlTimer(TIMERWHEEL_GPT_SYSCTL, SYSCTL_TIMER_ENABLE) != ERR_STAT_OK)
+  {
+    return ERR_STAT_NOK;
+  }
+  if (GPT_Init(TIMERWHEEL_GPT_BASE) != ERR_STAT_OK)
+  {
+    return ERR_STAT_NOK;
+  }
+
+  twNow = 0;
+  twInNotification = 0;
+  GPT_CounterGet(TIMERWHEEL_GPT_BASE, &twBaseCycles);
+
+  GPT_IntRegister(TIMERWHEEL_GPT_BASE, TimerWheel_GptNotification);
+  NVIC_IntPrioritySet(TIMERWHEEL_GPT_INT, TIMERWHEEL_GPT_PRIORITY);
+  TimerWheel_Program();
+  NVIC_IntEnable(TIMERWHEEL_GPT_INT);
+
+  return ERR_STAT_OK;
+}
+
+errStat TimerWheel_Create(timerWheelCallback_t callback, u16* timerId)
+{
+  u32 priMask;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((callback == 0) || (timerId == 0))
+  {
+    Det_ReportError(MODULE_ID_TIMERWHEEL, TIMERWHEEL_API_CREATE, TIMERWHEEL_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  priMask = NVIC_IntMasterDisable();
+  if (twFree == TIMERWHEEL_NIL)
+  {
+    NVIC_IntMasterRestore(priMask);
+    ErrCnt_Report(MODULE_ID_TIMERWHEEL);
+    return ERR_STAT_NOK;
+  }
+  *timerId = twFree;
+  twFree = twNext[twFree];
+  twCallback[*timerId] = callback;
+  twSlot[*timerId] = TIMERWHEEL_NIL;
+  NVIC_IntMasterRestore(priMask);
+
+  return ERR_STAT_OK;
+}
+
+errStat TimerWheel_Start(u16 timerId, u32 delayTicks, u32 periodTicks)
+{
+  u32 priMask;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((timerId >= TIMERWHEEL_TIMER_NUM) || (twCallback[timerId] == 0))
+  {
+    Det_ReportError(MODULE_ID_TIMERWHEEL, TIMERWHEEL_API_START, TIMERWHEEL_E_PARAM_TIMER);
+    return ERR_STAT_NOK;
+  }
+  if ((delayTicks == 0) || (delayTicks > TIMERWHEEL_DELAY_MAX) || (periodTicks > TIMERWHEEL_DELAY_MAX))
+  {
+    Det_ReportError(MODULE_ID_TIMERWHEEL, TIMERWHEEL_API_START, TIMERWHEEL_E_PARAM_DELAY);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  priMask = NVIC_IntMasterDisable();
+  if (twSlot[timerId] != TIMERWHEEL_NIL)
+  {
+    TimerWheel_Unlink(timerId);
+  }
+  twExpires[timerId] = TimerWheel_CurrentTicks() + delayTicks;
+  twPeriod[timerId] = periodTicks;
+  TimerWheel_Link(timerId);
+
+  /* The interrupt reprograms the match itself before returning */
+  if (twInNotification == 0)
+  {
+    if (TimerWheel_Program() != 0)
+    {
+      NVIC_IntPend(TIMERWHEEL_GPT_INT);
+    }
+  }
+  NVIC_IntMasterRestore(priMask);
+
+  return ERR_STAT_OK;
+}
+
+errStat TimerWheel_Stop(u16 timerId)
+{
+  u32 priMask;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((timerId >= TIMERWHEEL_TIMER_NUM) || (twCallback[timerId] == 0))
+  {
+    Det_ReportError(MODULE_ID_TIMERWHEEL, TIMERWHEEL_API_STOP, TIMERWHEEL_E_PARAM_TIMER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  /* The match stays armed, waking up for nothing costs less than rescanning */
+  priMask = NVIC_IntMasterDisable();
+  if (twSlot[timerId] != TIMERWHEEL_NIL)
+  {
+    TimerWheel_Unlink(timerId);
+  }
+  NVIC_IntMasterRestore(priMask);
+
+  return ERR_STAT_OK;
+}
+
+errStat TimerWheel_IsRunning(u16 timerId, u8* running)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((timerId >= TIMERWHEEL_TIMER_NUM) || (twCallback[timerId] == 0))
+  {
+    Det_ReportError(MODULE_ID_TIMERWHEEL, TIMERWHEEL_API_IS_RUNNING, TIMERWHEEL_E_PARAM_TIMER);
+    return ERR_STAT_NOK;
+  }
+  if (running == 0)
+  {
+    Det_ReportError(MODULE_ID_TIMERWHEEL, TIMERWHEEL_API_IS_RUNNING, TIMERWHEEL_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  *running = (twSlot[timerId] != TIMERWHEEL_NIL) ? TIMERWHEEL_RUNNING : TIMERWHEEL_STOPPED;
+  return ERR_STAT_OK;
+}
+
+errStat TimerWheel_GetTicks(u32* ticks)
+{
+  u32 priMask;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (ticks == 0)
+  {
+    Det_ReportError(MODULE_ID_TIMERWHEEL, TIMERWHEEL_API_GET_TICKS, TIMERWHEEL_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  priMask = NVIC_IntMasterDisable();
+  *ticks = TimerWheel_CurrentTicks();
+  NVIC_IntMasterRestore(priMask);
+
+  return ERR_STAT_OK;
+}
@@ -0,0 +1,108 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+/*
+  Software timers in a hierarchical timing wheel. Start, stop and expiry are
+  O(1) whatever the number of running timers, and the wheel is tickless: the
+  hardware timer only interrupts at the next expiry (or the next time a
+  coarse wheel slot has to be spread into a finer one).
+  
+  Callbacks run in the timer interrupt and shall be short, typically setting
+  a flag or starting/stopping timers.
+*/
+typedef void (*timerWheelCallback_t)(u16 timerId);
+
+/* Value of the periodTicks argument of TimerWheel_Start for one-shot timers */
+#define TIMERWHEEL_ONE_SHOT          0
+
+/* Values returned by TimerWheel_IsRunning */
+#define TIMERWHEEL_STOPPED           0
+#define TIMERWHEEL_RUNNING           1
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define TIMERWHEEL_API_CREATE        0x00
+#define TIMERWHEEL_API_START         0x01
+#define TIMERWHEEL_API_STOP          0x02
+#define TIMERWHEEL_API_IS_RUNNING    0x03
+#define TIMERWHEEL_API_GET_TICKS     0x04
+
+#define TIMERWHEEL_E_PARAM_TIMER     0x0A  /* Timer id not created          */
+#define TIMERWHEEL_E_PARAM_POINTER   0x0B  /* Null pointer                  */
+#define TIMERWHEEL_E_PARAM_DELAY     0x0C  /* Delay or period out of range  */
+
+
+/* 
+  Description: This function shall start the hardware time base and empty the
+  wheel, all timers created before are lost
+  
+  Input: void
+  
+  Output: errStat
+
+ */
+extern errStat TimerWheel_Init(void);
+
+/* 
+  Description: This function shall allocate a stopped timer
+  
+  Input: 
+        1- callback called from the timer interrupt on every expiry
+        2- timerId receives the id of the new timer
+        
+  Output: errStat, ERR_STAT_NOK when all TIMERWHEEL_TIMER_NUM timers are in use
+
+ */
+extern errStat TimerWheel_Create(timerWheelCallback_t callback, u16* timerId);
+
+/* 
+  Description: This function shall (re)start a timer, a running timer is
+  rescheduled
+  
+  Input: 
+        1- timerId the timer to start
+        2- delayTicks ticks until the first expiry, 1 to TIMERWHEEL_DELAY_MAX
+        3- periodTicks ticks between later expiries, or TIMERWHEEL_ONE_SHOT
+        
+  Output: errStat
+
+ */
+extern errStat TimerWheel_Start(u16 timerId, u32 delayTicks, u32 periodTicks);
+
+/* 
+  Description: This function shall stop a timer, stopping a stopped timer
+  has no effect
+  
+  Input: timerId the timer to stop
+  
+  Output: errStat
+
+ */
+extern errStat TimerWheel_Stop(u16 timerId);
+
+/* 
+  Description: This function shall tell whether a timer is running
+  
+  Input: 
+        1- timerId the timer to query
+        2- running receives TIMERWHEEL_RUNNING or TIMERWHEEL_STOPPED
+        
+  Output: errStat
+
+ */
+extern errStat TimerWheel_IsRunning(u16 timerId, u8* running);
+
+/* 
+  Description: This function shall read the time since TimerWheel_Init
+  
+  Input: ticks receives the time in ticks, wrapping at 2^32
+  
+  Output: errStat
+
+ */
+extern errStat TimerWheel_GetTicks(u32* ticks);
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef TIMERWHEEL_CONFIG_H
+#define TIMERWHEEL_CONFIG_H
+
+/* Timer 0A runs as the free running time base and wakes the wheel on match */
+#define TIMERWHEEL_GPT_BASE          TIMER0_BASE
+#define TIMERWHEEL_GPT_SYSCTL        SYSCTL_TIMER_0
+#define TIMERWHEEL_GPT_INT           NVIC_INT_TIMER0A
+#define TIMERWHEEL_GPT_PRIORITY      3
+
+/* Length of one tick in core clock cycles (1 ms) */
+#define TIMERWHEEL_TICK_CYCLES       (SYSCTL_MAIN_OSCILLATOR_HZ / 1000)
+
+/* Number of software timers that can be created */
+#define TIMERWHEEL_TIMER_NUM         256
+
+/*
+  Longest sleep between two wheel interrupts in ticks, also when no timer
+  runs. Keeps the elapsed cycle count well inside the 32 bit counter.
+*/
+#define TIMERWHEEL_WAKE_MAX_TICKS    60000
+
+/* Longest delay or period accepted by TimerWheel_Start (about 4.6 h) */
+#define TIMERWHEEL_DELAY_MAX         ((1UL << 24) - TIMERWHEEL_WAKE_MAX_TICKS - 1)
+
+#if (TIMERWHEEL_TIMER_NUM >= 0xFFFF)
+#error "TIMERWHEEL_TIMER_NUM must be below 0xFFFF"
+#endif
+
+#if ((TIMERWHEEL_WAKE_MAX_TICKS * TIMERWHEEL_TICK_CYCLES) >= 0x80000000)
+#error "TIMERWHEEL_WAKE_MAX_TICKS too long for the 32 bit time base"
+#endif
+
+#endif
@@ -0,0 +1,282 @@
+#include "STD_TYPES.h"
+#include "sysctl.h"
+#include "gpio.h"
+#include "dwt.h"
+#include "MODULE_IDS.h"
+#include "Det.h"
+#include "Det_config.h"
+#include "SWITCH.h"
+#include "SWITCH_config.h"
+
+#include "Trace.h"
+#include "Trace_config.h"
+
+
+#define TRACE_RING_MASK   (TRACE_RING_SIZE - 1)
+
+/*
+  Records between traceTail (oldest) and traceHead, both free running.
+  Only the main loop touches the trace, no locking.
+*/
+static ECU_STATE u8 traceRing[TRACE_RING_SIZE];
+static ECU_STATE u16 traceHead;
+static ECU_STATE u16 traceTail;
+static ECU_STATE u16 traceDropped;
+static ECU_STATE u8 traceFrozen;
+
+/* Last recorded state, cycles since that record and time of the last sample */
+static ECU_STATE u8 traceState;
+static ECU_STATE u32 traceDelta;
+static ECU_STATE u32 traceLastSample;
+
+
+/*
+  Description: This function shall drop the oldest record to make room
+
+  Input: void
+
+  Output: void
+
+ */
+static void Trace_DropOldest(void)
+{
+  u8 record[TRACE_RECORD_MAX_LEN];
+  u16 used = (u16)(traceHead - traceTail);
+  u32 delta;
+  u8 state;
+  u8 recordLength;
+  u8 i;
+
+  for (i = 0; (i < TRACE_RECORD_MAX_LEN) && (i < used); i++)
+  {
+    record[i] = traceRing[(u16)(traceTail + i) & TRACE_RING_MASK];
+  }
+  if (Trace_DecodeRecord(record, i, &delta, &state, &recordLength) != ERR_STAT_OK)
+  {
+    /* Cannot happen with records written by Trace_Append, start over */
+    recordLength = (u8)used;
+  }
+  traceTail += recordLength;
+  traceDropped++;
+}
+
+/*
+  Description: This function shall append a record, dropping the oldest ones
+  when the ring is full
+
+  Input:
+        1- delta cycles since the previous record
+        2- state of the traced pins
+
+  Output: void
+
+ */
+static void Trace_Append(u32 delta, u8 state)
+{
+  u8 record[TRACE_RECORD_MAX_LEN];
+  u8 length = 0;
+  u8 i;
+
+  while (delta >= 0x80)
+  {
+    record[length++] = (u8)(delta | 0x80);
+    delta >>= 7;
+  }
+  record[length++] = (u8)delta;
+  record[length++] = state;
+
+  while ((u16)(traceHead - traceTail) > (TRACE_RING_SIZE - length))
+  {
+    Trace_DropOldest();
+  }
+  for (i = 0; i < length; i++)
+  {
+    traceRing[traceHead & TRACE_RING_MASK] = record[i];
+    traceHead++;
+  }
+}
+
+/*
+  Description: This function shall empty the ring and record the current state
+  of the traced pins, the port must already be initiated by the switches
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Init(void)
+{
+  Trace_Restart();
+}
+
+/*
+  Description: This function shall be called once per main loop, it samples the
+  traced pins and records a change
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Sample(void)
+{
+  u32 now;
+  u8 state;
+
+  if (traceFrozen)
+  {
+    return;
+  }
+  now = DWT_CycleCountGet();
+  GPIO_PinRead(TRACE_PORT, TRACE_PINS, &state);
+  traceDelta += (u32)(now - traceLastSample);
+  traceLastSample = now;
+
+  if ((state != traceState) || (traceDelta >= TRACE_DELTA_LIMIT))
+  {
+    Trace_Append(traceDelta, state);
+    traceState = state;
+    traceDelta = 0;
+  }
+}
+
+/*
+  Description: This function shall stop recording so the ring can be read out
+  consistently, changes while frozen are not recorded
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Freeze(void)
+{
+  traceFrozen = 1;
+}
+
+/*
+  Description: This function shall empty the ring and start recording again
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Restart(void)
+{
+  traceHead = 0;
+  traceTail = 0;
+  traceDropped = 0;
+  traceFrozen = 0;
+  traceDelta = 0;
+  traceLastSample = DWT_CycleCountGet();
+  GPIO_PinRead(TRACE_PORT, TRACE_PINS, &traceState);
+  Trace_Append(0, traceState);
+}
+
+/*
+  Description: This function shall return the fill state of the ring
+
+  Input: info receives the trace information
+
+  Output: errStat
+
+ */
+extern errStat Trace_GetInfo(traceInfo_t* info)
+{
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (info == 0)
+  {
+    Det_ReportError(MODULE_ID_TRACE, TRACE_API_GET_INFO, TRACE_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  info->length = (u16)(traceHead - traceTail);
+  info->dropped = traceDropped;
+  info->pins = TRACE_PINS;
+  info->frozen = traceFrozen;
+  return ERR_STAT_OK;
+}
+
+/*
+  Description: This function shall copy recorded bytes, oldest first
+
+  Input:
+        1- offset of the first byte from the oldest recorded byte
+        2- data receives the bytes
+        3- length number of bytes, offset + length at most the recorded length
+
+  Output: errStat
+
+ */
+extern errStat Trace_Read(u16 offset, u8* data, u16 length)
+{
+  u16 i;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if (data == 0)
+  {
+    Det_ReportError(MODULE_ID_TRACE, TRACE_API_READ, TRACE_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+  /* Also a runtime condition, the tool may ask beyond the end */
+  if (((u32)offset + length) > (u16)(traceHead - traceTail))
+  {
+    return ERR_STAT_NOK;
+  }
+
+  for (i = 0; i < length; i++)
+  {
+    data[i] = traceRing[(u16)(traceTail + offset + i) & TRACE_RING_MASK];
+  }
+  return ERR_STAT_OK;
+}
+
+/*
+  Description: This function shall decode one record, used by the ring and by
+  host tools reading an extracted trace
+
+  Input:
+        1- data the encoded record
+        2- length number of bytes available in data
+        3- delta receives the cycles since the previous record
+        4- state receives the pin state
+        5- recordLength receives the number of bytes of the record
+
+  Output: errStat, ERR_STAT_NOK when the record is truncated or malformed
+
+ */
+extern errStat Trace_DecodeRecord(const u8* data, u16 length, u32* delta, u8* state, u8* recordLength)
+{
+  u32 value = 0;
+  u8 i;
+
+#if (DET_DEV_ERROR_DETECT == 1)
+  if ((data == 0) || (delta == 0) || (state == 0) || (recordLength == 0))
+  {
+    Det_ReportError(MODULE_ID_TRACE, TRACE_API_DECODE, TRACE_E_PARAM_POINTER);
+    return ERR_STAT_NOK;
+  }
+#endif
+
+  for (i = 0; (i < TRACE_DELTA_MAX_LEN) && (i < length); i++)
+  {
+    value |= (u32)(data[i] & 0x7F) << (7 * i);
+    if ((data[i] & 0x80) == 0)
+    {
+      break;
+    }
+  }
+  /* The delta must end inside the record and be followed by the state */
+  if ((i == TRACE_DELTA_MAX_LEN) || ((i + 1) >= length))
+  {
+    return ERR_STAT_NOK;
+  }
+  *delta = value;
+  *state = data[i + 1];
+  *recordLength = i + 2;
+  return ERR_STAT_OK;
+}
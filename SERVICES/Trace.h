@@ -0,0 +1,130 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+  Input trace recorder. The traced pins are sampled once per main loop and
+  only changes are stored, so long quiet periods cost nothing:
+      delta (1..5) | state (1)
+  delta is the number of core clock cycles since the previous record,
+  7 bits per byte with the least significant group first and bit 7 set on
+  all bytes but the last; state holds the traced pins as read from the port.
+  A record with an unchanged state only carries time, it is written when
+  the delta would otherwise get close to 2^32 cycles.
+
+  The records are kept in a RAM ring; when it is full the oldest records are
+  dropped. The delta of the oldest record refers to a dropped one and shall
+  be ignored. The first record after Trace_Init or Trace_Restart holds the
+  initial state.
+
+  The trace is read out oldest byte first with Trace_Read while it is frozen
+  (Diag: DIAG_DID_TRACE_INFO then DIAG_SID_READ_MEMORY_BY_ADDRESS), and
+  replayed on the host by HOST/trace_replay.c.
+*/
+
+/* Longest encoding of a record */
+#define TRACE_DELTA_MAX_LEN   5
+#define TRACE_RECORD_MAX_LEN  (TRACE_DELTA_MAX_LEN + 1)
+
+typedef struct
+{
+  u16 length;    /* bytes in the ring       */
+  u16 dropped;   /* oldest records dropped  */
+  u8 pins;       /* traced pins of the port */
+  u8 frozen;     /* 1 while frozen          */
+} traceInfo_t;
+
+/******************************************************************************/
+/*
+/* API and error ids reported to the Development Error Tracer.
+/*
+/******************************************************************************/
+#define TRACE_API_GET_INFO      0x00
+#define TRACE_API_READ          0x01
+#define TRACE_API_DECODE        0x02
+
+#define TRACE_E_PARAM_POINTER   0x0A  /* Null pointer                    */
+
+
+/*
+  Description: This function shall empty the ring and record the current state
+  of the traced pins, the port must already be initiated by the switches
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Init(void);
+
+/*
+  Description: This function shall be called once per main loop, it samples the
+  traced pins and records a change
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Sample(void);
+
+/*
+  Description: This function shall stop recording so the ring can be read out
+  consistently, changes while frozen are not recorded
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Freeze(void);
+
+/*
+  Description: This function shall empty the ring and start recording again
+
+  Input: void
+
+  Output: void
+
+ */
+extern void Trace_Restart(void);
+
+/*
+  Description: This function shall return the fill state of the ring
+
+  Input: info receives the trace information
+
+  Output: errStat
+
+ */
+extern errStat Trace_GetInfo(traceInfo_t* info);
+
+/*
+  Description: This function shall copy recorded bytes, oldest first
+
+  Input:
+        1- offset of the first byte from the oldest recorded byte
+        2- data receives the bytes
+        3- length number of bytes, offset + length at most the recorded length
+
+  Output: errStat
+
+ */
+extern errStat Trace_Read(u16 offset, u8* data, u16 length);
+
+/*
+  Description: This function shall decode one record, used by the ring and by
+  host tools reading an extracted trace
+
+  Input:
+        1- data the encoded record
+        2- length number of bytes available in data
+        3- delta receives the cycles since the previous record
+        4- state receives the pin state
+        5- recordLength receives the number of bytes of the record
+
+  Output: errStat, ERR_STAT_NOK when the record is truncated or malformed
+
+ */
+extern errStat Trace_DecodeRecord(const u8* data, u16 length, u32* delta, u8* state, u8* recordLength);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef TRACE_CONFIG_H
+#define TRACE_CONFIG_H
+
+/* The door switches, both on the same port */
+#define TRACE_PORT            SWITCH_LEFTDOOR_PORT
+#define TRACE_PINS            (SWITCH_LEFTDOOR_PIN | SWITCH_RIGHTDOOR_PIN)
+
+/* Size of the ring in bytes, must be a power of two */
+#define TRACE_RING_SIZE       2048
+
+/*
+  Longest delta stored in a record, a time only record is written before
+  the time since the last record reaches it. Leaves room for one main loop
+  period below 2^32 cycles.
+*/
+#define TRACE_DELTA_LIMIT     0xF0000000UL
+
+#if (SWITCH_LEFTDOOR_PORT != SWITCH_RIGHTDOOR_PORT)
+#error "Traced pins must be on one port"
+#endif
+
+#if (TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) != 0
+#error "TRACE_RING_SIZE must be a power of two"
+#endif
+
+#if (TRACE_RING_SIZE > 0x8000)
+#error "TRACE_RING_SIZE must fit the 16 bit ring indexes"
+#endif
+
+#endif